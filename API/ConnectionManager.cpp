@@ -20,17 +20,22 @@
 #include "azure_c_shared_utility/azure_c_shared_utility/base64.h" 
 #include "azure_c_shared_utility/azure_c_shared_utility/xlogging.h" 
 #include "azure_c_shared_utility/azure_c_shared_utility/crt_abstractions.h" 
+#include "azure_c_shared_utility/azure_c_shared_utility/gballoc.h"
+#include "azure_c_shared_utility/azure_c_shared_utility/threadapi.h"
 
 #define INDEFINITE_TIME ((time_t)-1)
 
 bool _timeout_triggered;
 
-void device_to_system_timeout(void);
-void system_to_device_timeout();
 void system_to_device_message_handler(MQTTMessage *msg, void *param);
 static char payload[1548];
+static char heap_stats[HEAP_STATS_MAX_LENGTH];
+#if defined(PUBLISH_MODEM_STATS)
+static char modem_stats[MODEM_STATS_MAX_LENGTH];
+#endif
+static const char modem_owner[] = "ConnectionManager";
 
-ConnectionManager::ConnectionManager(BG96Interface *bg96, Mutex * bg96mutex)
+ConnectionManager::ConnectionManager(BG96Interface *bg96, ModemArbiter *arbiter)
 {
     _bg96 = bg96;
     _mqtt = _bg96->getBG96MQTTClient(NULL);
@@ -39,7 +44,10 @@ ConnectionManager::ConnectionManager(BG96Interface *bg96, Mutex * bg96mutex)
     _conn_state = DISCONNECTED;
     _msg_sent = false;
     _msg_received = false;
-    _connect_mutex = bg96mutex;
+    _arbiter = arbiter;
+    _sas_key_ready = false;
+    _sas_key_source = NULL;
+    _sas_token_expiry = 0;
 //    _connect_thread = NULL;
 }
 
@@ -49,25 +57,37 @@ ConnectionManager::~ConnectionManager()
     _bg96->powerDown();
 }
 
-/* This function looks for every occurrences of the token in initial string and replaces each one by replacement */
-size_t ConnectionManager::replace_str(char * initial, char * token, char * replacement) {
-    if ( initial == NULL || token == NULL || replacement == NULL ) return 0;
+/* This function looks for every occurrences of the token in initial string and replaces each one by replacement.
+initial is a buffer of size bytes, it is left untouched and -1 is returned if the result does not fit */
+int ConnectionManager::replace_str(char * initial, size_t size, const char * token, const char * replacement) {
+    if ( initial == NULL || token == NULL || replacement == NULL || token[0] == 0 ) return -1;
     printf("SAS before replacement:\r\n");
     printf("%s\r\n",initial);
-    STRING_HANDLE buffer = STRING_new();
-    char * str = initial;
-    char * ptr = NULL;
-    ptr = strtok(str,token);
-    if (ptr != NULL) STRING_concat(buffer, ptr);
-    while( (ptr = strtok(NULL,token)) != NULL) {
-        STRING_concat(buffer,replacement);
-        STRING_concat(buffer,ptr);
-    }
-    strcpy(initial,STRING_c_str(buffer));
-    STRING_delete(buffer);
-    printf("SAS after replacement:\r\n");
-    printf("%s\r\n",initial);
-    return strlen(initial);
+    size_t token_len = strlen(token);
+    STRING_BUILDER_HANDLE buffer = STRING_BUILDER_create(strlen(initial) + 16);
+    if (buffer == NULL) return -1;
+    const char * start = initial;
+    const char * found;
+    int rc = 0;
+    while (rc == 0 && (found = strstr(start, token)) != NULL) {
+        if (STRING_BUILDER_append_n(buffer, start, found - start) != 0 ||
+            STRING_BUILDER_append(buffer, replacement) != 0) rc = -1;
+        start = found + token_len;
+    }
+    if (rc == 0 && STRING_BUILDER_append(buffer, start) != 0) rc = -1;
+    size_t length = STRING_BUILDER_length(buffer);
+    if (rc == 0 && length >= size) {
+        printf("The replacement needs %u bytes, only %u available.\r\n", (unsigned int)length + 1, (unsigned int)size);
+        rc = -1;
+    }
+    if (rc == 0) {
+        memcpy(initial, STRING_BUILDER_c_str(buffer), length + 1);
+        rc = (int)length;
+        printf("SAS after replacement:\r\n");
+        printf("%s\r\n",initial);
+    }
+    STRING_BUILDER_destroy(buffer);
+    return rc;
 }
 
 int ConnectionManager::get_seconds_since_epoch(size_t* seconds)
@@ -87,11 +107,11 @@ int ConnectionManager::get_seconds_since_epoch(size_t* seconds)
     return result;
 }
 
-int ConnectionManager::SignAuthPayload(const char* key, const char* stringToSign, unsigned char** output, size_t* len)
+/* Signs "<encodedUri>\n<expiry>", the parts are hashed in place instead of being joined first */
+int ConnectionManager::SignAuthPayload(const char* key, const char* encodedUri, const char* expiry, unsigned char** output, size_t* len)
 {
     int result;
-    size_t payload_len = strlen(stringToSign);
-    if (key == NULL || stringToSign == NULL)
+    if (key == NULL || encodedUri == NULL || expiry == NULL)
     {
         LogError("Invalid parameters passed to sign function");
         printf("Invalid parameters passed to sign function\r\n");
@@ -99,64 +119,71 @@ int ConnectionManager::SignAuthPayload(const char* key, const char* stringToSign
     }
     else
     {
-        BUFFER_HANDLE decoded_key;
-        BUFFER_HANDLE output_hash;
-
-        if ((decoded_key = Base64_Decoder(key)) == NULL)
-        {
-            LogError("Failed decoding symmetrical key");
-            printf("Failed decoding symmetrical key\r\n");
-            result = __FAILURE__;
-        }
-        else if ((output_hash = BUFFER_new()) == NULL)
+        if (!_sas_key_ready || _sas_key_source != key)
         {
-            LogError("Failed allocating output hash buffer");
-            printf("Failed allocating output hash buffer\r\n");
-            BUFFER_delete(decoded_key);
-            result = __FAILURE__;
+            // the key is decoded and hashed with the HMAC pads once, every
+            // token after that only hashes its own string to sign
+            BUFFER_HANDLE decoded_key;
+            _sas_key_ready = false;
+            if ((decoded_key = Base64_Decoder(key)) == NULL)
+            {
+                LogError("Failed decoding symmetrical key");
+                printf("Failed decoding symmetrical key\r\n");
+            }
+            else
+            {
+                if (HMACSHA256_PrepareKey(&_sas_key, BUFFER_u_char(decoded_key), BUFFER_length(decoded_key)) != HMACSHA256_OK)
+                {
+                    LogError("Failed preparing HMAC key");
+                    printf("Failed preparing HMAC key\r\n");
+                }
+                else
+                {
+                    _sas_key_ready = true;
+                    _sas_key_source = key;
+                }
+                BUFFER_delete(decoded_key);
+            }
         }
-        else if (HMACSHA256_ComputeHash(BUFFER_u_char(decoded_key), BUFFER_length(decoded_key), (const unsigned char*)stringToSign, payload_len, output_hash) != HMACSHA256_OK)
+
+        if (!_sas_key_ready)
         {
-            LogError("Failed computing HMAC Hash");
-            printf("Failed computing HMAC Hash\r\n");
-            BUFFER_delete(decoded_key);
-            BUFFER_delete(output_hash);
             result = __FAILURE__;
         }
         else
         {
-            *len = BUFFER_length(output_hash);
-            if (*len > 80)
+            HMACSHA256_CONTEXT hmac_ctx;
+            if ((HMACSHA256_InitWithKey(&hmac_ctx, &_sas_key) != HMACSHA256_OK) ||
+                (HMACSHA256_Update(&hmac_ctx, (const unsigned char*)encodedUri, strlen(encodedUri)) != HMACSHA256_OK) ||
+                (HMACSHA256_Update(&hmac_ctx, (const unsigned char*)"\n", 1) != HMACSHA256_OK) ||
+                (HMACSHA256_Update(&hmac_ctx, (const unsigned char*)expiry, strlen(expiry)) != HMACSHA256_OK) ||
+                (HMACSHA256_Final(&hmac_ctx, generated_sig) != HMACSHA256_OK))
             {
-                LogError("Generated signature token length longer than storage buffer");
-                printf("Generated signature token length longer than storage buffer\r\n");
+                LogError("Failed computing HMAC Hash");
+                printf("Failed computing HMAC Hash\r\n");
                 result = __FAILURE__;
             }
             else
             {
-                memcpy(generated_sig, BUFFER_u_char(output_hash), *len+1);
+                *len = SHA256HashSize;
                 *output = generated_sig;
                 result = 0;
             }
-            BUFFER_delete(decoded_key);
-            BUFFER_delete(output_hash);
         }
     }
     return result;
 }
 
+/* The token is built in place in out, the URI and the signature are encoded straight into it */
 size_t ConnectionManager::generate_sas_token(char *out, const char * resourceUri, const char * key, const char * policyName, int expiryInSeconds)
 {
-    size_t result = 1;
+    size_t result = 0;
     size_t sec_since_epoch;
-    STRING_HANDLE scope = STRING_construct(resourceUri);
-    STRING_HANDLE encoded_uri = URL_Encode(scope);
     if (get_seconds_since_epoch(&sec_since_epoch) != 0)
     {
         /* Codes_SRS_IoTHub_Authorization_07_020: [ If any error is encountered IoTHubClient_Auth_Get_ConnString shall return NULL. ] */
         LogError("failure getting seconds from epoch");
         printf("failure getting seconds from epoch\r\n");
-        result = 0;
     }
     else 
     {
@@ -165,66 +192,57 @@ size_t ConnectionManager::generate_sas_token(char *out, const char * resourceUri
         if (size_tToString(expiry_token, sizeof(expiry_token), expiry_time) != 0) {
             LogError("Failure when creating expire token");
             printf("Failure when creating expire token\r\n");
-            result = 0;
         } else {
+            const size_t out_size = BG96MQTTCLIENT_MAX_SAS_TOKEN_LENGTH;
+            size_t len = sizeof("SharedAccessSignature sr=") - 1;
+            char *encoded_uri = out + len;
             unsigned char* data_value;
             size_t data_len;
-            STRING_HANDLE string_to_sign = STRING_construct_sprintf("%s\n%s",STRING_c_str(encoded_uri),expiry_token);
-            if (SignAuthPayload(key, STRING_c_str(string_to_sign), &data_value, &data_len) == 0) {
-                STRING_HANDLE urlEncodedSignature = NULL;
-                STRING_HANDLE signature = NULL;
-                signature = Base64_Encode_Bytes(data_value, data_len);
-                if (signature == NULL)
+            char signature[(SHA256HashSize + 2) / 3 * 4 + 1];
+            strcpy(out, "SharedAccessSignature sr=");
+            if (URL_EncodeString_Into(resourceUri, encoded_uri, out_size - len) != 0) {
+                printf("Error - the generated SAS token is longer than the storage buffer.\r\n");
+            } else if (SignAuthPayload(key, encoded_uri, expiry_token, &data_value, &data_len) == 0) {
+                len += strlen(encoded_uri);
+                if (Base64_Encode_Bytes_Into(data_value, data_len, signature, sizeof(signature)) != 0)
                 {
-                    result = 0;
                     LogError("Failure constructing encoding.");
                     printf("Failure constructing encoding.\r\n");
                 }
-                else if ((urlEncodedSignature = URL_Encode(signature)) == NULL)
+                else if (len + 5 >= out_size ||
+                         URL_EncodeString_Into(signature, out + len + 5, out_size - len - 5) != 0)
                 {
-                    result = 0;
-                    LogError("Failure constructing url Signature.");
-                    printf("Failure constructing url Signature.\r\n");
-                }
-                // char * buffer = (char *)malloc(25+STRING_length(encoded_uri)+1+
-                //                         5+STRING_length(urlEncodedSignature)+1+
-                //                         4+strlen(expiry_token)+1+
-                //                         5+strlen(policyName))+1+8;
-                // if (buffer == NULL) {
-                //     LogError("Failure allocating the buffer for the sas_token.");
-                //     printf("Failure allocating the buffer for the sas_token.\r\n");
-                //     result = 0;
-                // } 
-                if (34+STRING_length(encoded_uri)+STRING_length(urlEncodedSignature)+strlen(expiry_token)+5+strlen(policyName) > BG96MQTTCLIENT_MAX_SAS_TOKEN_LENGTH-1) {
                     printf("Error - the generated SAS token is longer than the storage buffer.\r\n");
-                    result = 0;
-                } else {
-                    sprintf(out,"SharedAccessSignature sr=%s&sig=%s&se=%s", STRING_c_str(encoded_uri), 
-                                                                                      STRING_c_str(urlEncodedSignature),
-                                                                                      expiry_token);
-                    if (policyName != NULL) {
-                        strcat(out, "&skn=");
-                        strcat(out, policyName);
+                }
+                else
+                {
+                    memcpy(out + len, "&sig=", 5);
+                    len += strlen(out + len);
+                    if (len + 4 + strlen(expiry_token) + (policyName != NULL ? 5 + strlen(policyName) : 0) > out_size - 1) {
+                        printf("Error - the generated SAS token is longer than the storage buffer.\r\n");
+                    } else {
+                        sprintf(out + len, "&se=%s", expiry_token);
+                        if (policyName != NULL) {
+                            strcat(out, "&skn=");
+                            strcat(out, policyName);
+                        }
+                        _sas_token_expiry = expiry_time;
+                        result = strlen(out);
                     }
-                    result = 1;
-                }   
-                STRING_delete(urlEncodedSignature);
-                STRING_delete(signature);
+                }
             }
-            STRING_delete(string_to_sign);
         }     
     }
-    STRING_delete(encoded_uri);
-    STRING_delete(scope);
-    return result ? result:strlen(out);
+    if (result == 0) out[0] = 0;
+    return result;
 }
 
 void ConnectionManager::newSystemMessage(char *msg, size_t len)
 {
-    _connect_mutex->lock();
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return;
     _system_message = msg;
     _msg_received = true;
-    _connect_mutex->unlock();
 }
 
 void system_to_device_message_handler(MQTTMessage *msg, void *param)
@@ -241,9 +259,18 @@ void system_to_device_message_handler(MQTTMessage *msg, void *param)
     conn_m->newSystemMessage(msg->msg.payload, msg->msg.len);
 }
 
-void system_to_device_timeout()
+/* Runs in interrupt context */
+void ConnectionManager::sessionTimeout(void)
 {
     _timeout_triggered = true;
+    _cancel.cancel();
+}
+
+bool ConnectionManager::cancelledBefore(const char *step)
+{
+    if (!_cancel.isCancelled()) return false;
+    printf("ConnectionManager: session cancelled before %s.\r\n", step);
+    return true;
 }
 
 void ConnectionManager::getRSSI(double &rssi)
@@ -270,20 +297,24 @@ int ConnectionManager::connectToServer()
     pdp_ctx.username = apn_username;
     pdp_ctx.password = apn_password;
 
+    if (cancelledBefore("configuring the PDP context")) return -1;
     printf("Configuring PDP context...\r\n");
-    _connect_mutex->lock();
-    rc = _mqtt->configure_pdp_context(&pdp_ctx);
-    _connect_mutex->unlock();
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        rc = modem.locked() ? _mqtt->configure_pdp_context(&pdp_ctx) : -1;
+    }
     if (rc < 0) {
         printf("Error when configuring pdp context %d.\r\n", pdp_ctx.pdp_id);
         return -1;
     }
     printf("Succesfully configured pdp context %d.\r\n", pdp_ctx.pdp_id);
 
+    if (cancelledBefore("activating the PDP context")) return -1;
     printf("Activate PDP context...\r\n");
-    _connect_mutex->lock();
-    rc= _bg96->connect();
-    _connect_mutex->unlock();
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        rc = modem.locked() && _bg96->connect();
+    }
     if (!rc){
         printf("Error when activating the PDP context.\r\n");
         return -1;
@@ -293,16 +324,19 @@ int ConnectionManager::connectToServer()
 
     
 
+    if (cancelledBefore("setting the system time")) return -1;
     printf("Now trying to set system time...\r\n");
 
     time_t current_time;
-    _connect_mutex->lock();
-    if (_bg96->getNetworkGMTTime(&current_time) != NSAPI_ERROR_OK) {
-        NetworkInterface *itf = (NetworkInterface *)&_bg96; // We need a NetworkInterface reference for NTPClient
-        NTPClient ntp = NTPClient(itf);
-        current_time = ntp.get_timestamp();
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        if (!modem.locked()) return -1;
+        if (_bg96->getNetworkGMTTime(&current_time) != NSAPI_ERROR_OK) {
+            NetworkInterface *itf = (NetworkInterface *)&_bg96; // We need a NetworkInterface reference for NTPClient
+            NTPClient ntp = NTPClient(itf);
+            current_time = ntp.get_timestamp();
+        }
     }
-    _connect_mutex->unlock();
     set_time(current_time);
     char buffer[32];
     current_time = time(NULL);
@@ -316,10 +350,12 @@ int ConnectionManager::connectToServer()
     mqtt_options.cleansession   = 0;
     mqtt_options.sslenable      = 1;
 
+    if (cancelledBefore("configuring MQTT")) return -1;
     printf("Configuring MQTT options...\r\n");
-    _connect_mutex->lock();
-    rc = _mqtt->configure_mqtt(&mqtt_options);
-    _connect_mutex->unlock();
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        rc = modem.locked() ? _mqtt->configure_mqtt(&mqtt_options) : -1;
+    }
     if (rc < 0 ) {
         printf("Error when configuring MQTT options (%d)\r\n", rc);
         return -1;
@@ -341,10 +377,12 @@ int ConnectionManager::connectToServer()
     network_ctx.hostname.payload = (const char*)MQTT_SERVER_HOST_NAME;
     network_ctx.port = MQTT_SERVER_PORT;
 
+    if (cancelledBefore("opening the network socket")) return -1;
     printf("Opening a network socket to %s:%d\r\n", network_ctx.hostname.payload, network_ctx.port);
-    _connect_mutex->lock();
-    rc = _mqtt->open(&network_ctx);
-    _connect_mutex->unlock();
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        rc = modem.locked() ? _mqtt->open(&network_ctx) : -1;
+    }
     if (rc < 0) {
         printf("Error opening the network socket (%d)\r\n", rc);
 //        tls = bg96->getBG96TLSSocket();
@@ -353,20 +391,33 @@ int ConnectionManager::connectToServer()
     }
     printf("Successfully opened a network socket.\r\n");
 
-    char scope[80] = {0};
- 
-    printf("Generating SAS token...\r\n");
-
-    sprintf(scope,"%s/devices/%s", MQTT_SERVER_HOST_NAME, DEVICE_ID);
-    //STRING_HANDLE scope = STRING_construct_sprintf("%s/devices/%s", MQTT_SERVER_HOST_NAME, DEVICE_ID);
-    generate_sas_token(sas_token, scope, DEVICE_KEY, NULL, AZURE_IOTHUB_SAS_TOKEN_DEFAULT_EXPIRY_TIME);
-    if (sas_token == NULL){
-        printf("Error when generating SAS token.\r\n");
-        return -1;
-    } 
-    printf("Generated a new SAS Token: \r\n");
-    printf("%s\r\n", sas_token);
-    replace_str(sas_token, (char *)"%", (char *)"%%");
+    size_t now;
+    if (_sas_token_expiry != 0 && get_seconds_since_epoch(&now) == 0 && now + SAS_TOKEN_REFRESH_MARGIN < _sas_token_expiry) {
+        // still valid, sas_token already has its '%' escaped
+        printf("Reusing the SAS token, it expires in %u seconds.\r\n", (unsigned int)(_sas_token_expiry - now));
+    } else {
+        char scope[80] = {0};
+
+        printf("Generating SAS token...\r\n");
+
+        sprintf(scope,"%s/devices/%s", MQTT_SERVER_HOST_NAME, DEVICE_ID);
+        //STRING_HANDLE scope = STRING_construct_sprintf("%s/devices/%s", MQTT_SERVER_HOST_NAME, DEVICE_ID);
+        _sas_token_expiry = 0;
+        generate_sas_token(sas_token, scope, DEVICE_KEY, NULL, AZURE_IOTHUB_SAS_TOKEN_DEFAULT_EXPIRY_TIME);
+        if (_sas_token_expiry == 0){
+            printf("Error when generating SAS token.\r\n");
+            sas_token[0] = 0;
+            return -1;
+        }
+        printf("Generated a new SAS Token: \r\n");
+        printf("%s\r\n", sas_token);
+        if (replace_str(sas_token, sizeof(sas_token), "%", "%%") < 0) {
+            printf("Error when escaping the SAS token.\r\n");
+            _sas_token_expiry = 0;
+            sas_token[0] = 0;
+            return -1;
+        }
+    }
 
     strcpy(clientid, DEVICE_ID);
     MQTTConnect_Ctx connect_ctx;
@@ -382,94 +433,104 @@ int ConnectionManager::connectToServer()
     connect_ctx.password.payload = sas_token;
     connect_ctx.password.len = strlen(connect_ctx.password.payload);
 
+    if (cancelledBefore("connecting to the IoT Hub server")) return -1;
     printf("Connecting to the IoT Hub server %s...\r\n",network_ctx.hostname.payload);
-    _connect_mutex->lock();
-    rc = _mqtt->connect(&connect_ctx);
-        _connect_mutex->unlock();
-    return rc;
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return -1;
+    return _mqtt->connect(&connect_ctx);
 
 }
 
 void ConnectionManager::setConnectionStatus(CONN_STATE status)
 {
-    _connect_mutex->lock();
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return;
     _conn_state = status;
-    _connect_mutex->unlock();
 }
 
 int ConnectionManager::subscribe(char *topic, int qos, MQTTMessageHandler handler)
 {
-    int rc;
-    _connect_mutex->lock();
-    rc = _mqtt->subscribe(topic, qos, handler, this);
-    _connect_mutex->unlock();
-    return rc;
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return -1;
+    return _mqtt->subscribe(topic, qos, handler, this);
 }
 
-void get_system_to_device(ConnectionManager *conn_m) 
+/* The connection tasks run on the ThreadAPI worker pool and return when done, the caller joins them */
+int get_system_to_device(void *context)
 {
-    if (conn_m == NULL) return;
+    ConnectionManager *conn_m = (ConnectionManager *)context;
+    if (conn_m == NULL) return -1;
     conn_m->setConnectionStatus(TRYING_TO_CONNECT);
     if (conn_m->connectToServer()==0) {
         conn_m->setConnectionStatus(CONNECTED_TO_SERVER);
         printf("ConnectionManager: Publishing HELLO message.\r\n");
         std::string msg("HELLO");
         conn_m->publish(msg);
+        conn_m->publishHeapStats();
+        conn_m->publishModemStats();
         char topictoreadfrom[128] = "devices/";
         strcat(topictoreadfrom, DEVICE_ID);
         strcat(topictoreadfrom,"/messages/devicebound/#");
+        if (conn_m->isCancelled()) return -1;
         if (conn_m->subscribe(topictoreadfrom, 0, system_to_device_message_handler) < 0) {
             printf("Error while subcribing to topic %s.\r\n", topictoreadfrom);
         } else {
             printf("Successfully subscribred to topic %s\r\n", topictoreadfrom);
-            conn_m->trackSystemToDeviceMessages();
+            if (!conn_m->isCancelled()) conn_m->trackSystemToDeviceMessages();
         }
     } else {
         conn_m->setConnectionStatus(CONNECTION_FAILED);
     }
-    while(true) {wait(10);}
+    return 0;
 }
 
 void ConnectionManager::disconnect(void)
 {
     setConnectionStatus(DISCONNECTING);
-    _connect_mutex->lock();
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return;
     if (_mqtt->disconnect()) setConnectionStatus(DISCONNECTED);
     _bg96->powerDown();
     wait(1);
-    _connect_mutex->unlock();
 }
 
 bool ConnectionManager::getSystemToDeviceMessage(std::string &system_message, int timeout)
 {
     int rc;
     printf("trying to get system to device message.\r\n");
-    Thread s1;
+    THREAD_HANDLE task;
     _msg_received = false;
-    _connect_mutex->lock();
-    rc = _mqtt->startMQTTClient();
-    _connect_mutex->unlock();
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        rc = modem.locked() && _mqtt->startMQTTClient();
+    }
     if (!rc) return false;
-    _connect_mutex->lock();
-    _bg96->disallowPowerOff();
-    _rssi = (double) _bg96->get_rssi();
-    _connect_mutex->unlock();
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        if (!modem.locked()) return false;
+        _bg96->disallowPowerOff();
+        _rssi = (double) _bg96->get_rssi();
+    }
     _timeout_triggered = false;
-    _timeout.attach(system_to_device_timeout, timeout);
-    s1.start(callback(get_system_to_device,this));
-   // _connect_thread.start(callback(get_system_to_device,this));
-    while(!_timeout_triggered) { if (_msg_received) break;};
+    _cancel.reset();
+    _timeout.attach(callback(this, &ConnectionManager::sessionTimeout), timeout);
+    if (ThreadAPI_Submit(&task, get_system_to_device, this) == THREADAPI_OK) {
+        while(!_timeout_triggered) { if (_msg_received) break;};
+        printf("timeout triggered or message received\r\n");
+        _cancel.cancel();
+        ThreadAPI_Join(task, NULL);
+    } else {
+        printf("ConnectionManager: could not queue the connection task.\r\n");
+    }
+    _timeout.detach();
+    _cancel.reset();
     printf("ConnectionManager: Publishing BYE message.\r\n");
     std::string msg("BYE");
     publish(msg);
-    printf("timeout triggered or message received\r\n");
-    s1.terminate();
-    s1.join();
-    //_connect_thread.terminate();
-    _timeout.detach();
-    _connect_mutex->lock();
-    _bg96->allowPowerOff();
-    _connect_mutex->unlock();
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        if (modem.locked()) _bg96->allowPowerOff();
+    }
     printf("shutting down modem\r\n");
     disconnect();
     if (_msg_received) {
@@ -483,14 +544,8 @@ bool ConnectionManager::getSystemToDeviceMessage(std::string &system_message, in
 
 void ConnectionManager::trackSystemToDeviceMessages()
 {
-    _connect_mutex->lock();
-    _mqtt->dowork();
-    _connect_mutex->unlock();
-}
-
-void device_to_system_timeout(void)
-{
-    _timeout_triggered = true;
+    ModemLock modem(_arbiter, modem_owner);
+    if (modem.locked()) _mqtt->dowork();
 }
 
 void ConnectionManager::publish(void)
@@ -506,13 +561,16 @@ void ConnectionManager::publish(void)
     msgtopublish.msg.len = _device_message.length();
     strcpy(payload, _device_message.c_str());
     msgtopublish.msg.payload = payload;
-    _connect_mutex->lock();
-    if (_mqtt->publish(&msgtopublish)) {
+    if (cancelledBefore("publishing")) {
+        _msg_sent = false;
+        return;
+    }
+    ModemLock modem(_arbiter, modem_owner);
+    if (modem.locked() && _mqtt->publish(&msgtopublish)) {
         _msg_sent = true;
     } else {
         _msg_sent = false;
     }
-    _connect_mutex->unlock();
 }
 
 void ConnectionManager::publish(std::string &msg)
@@ -528,24 +586,60 @@ void ConnectionManager::publish(std::string &msg)
     msgtopublish.msg.len = msg.length();
     strcpy(payload,msg.c_str());
     msgtopublish.msg.payload = payload;
-    _connect_mutex->lock();
-    if (_mqtt->publish(&msgtopublish)) {
+    if (cancelledBefore("publishing")) {
+        _msg_sent = false;
+        return;
+    }
+    ModemLock modem(_arbiter, modem_owner);
+    if (modem.locked() && _mqtt->publish(&msgtopublish)) {
         _msg_sent = true;
     } else {
         _msg_sent = false;
     }    
-    _connect_mutex->unlock();
 }
 
-void send_device_to_system(ConnectionManager *conn_m)
+/* Sends what gballoc knows about the heap, so resets in the field can be matched with who allocated what.
+Nothing is sent unless the build measures memory (GB_DEBUG_ALLOC). */
+void ConnectionManager::publishHeapStats(void)
 {
-    if (conn_m==NULL) return;
+    static const char prefix[] = "{\"type\":\"HEAP\",\"heap\":";
+    size_t len;
+    strcpy(heap_stats, prefix);
+    len = gballoc_exportStats(GBALLOC_EXPORT_JSON, (unsigned char *)heap_stats + sizeof(prefix) - 1,
+                              sizeof(heap_stats) - sizeof(prefix) - 1);
+    if (len == 0) return;
+    strcat(heap_stats, "}");
+    std::string msg(heap_stats);
+    publish(msg);
+}
+
+/* Sends how long every manager waited for the modem and how long it kept it.
+Nothing is sent unless the build defines PUBLISH_MODEM_STATS, it costs an uplink per session. */
+void ConnectionManager::publishModemStats(void)
+{
+#if defined(PUBLISH_MODEM_STATS)
+    static const char prefix[] = "{\"type\":\"MODEM\",\"owners\":";
+    size_t len;
+    strcpy(modem_stats, prefix);
+    len = _arbiter->exportStats(modem_stats + sizeof(prefix) - 1, sizeof(modem_stats) - sizeof(prefix) - 1);
+    if (len == 0) return;
+    strcat(modem_stats, "}");
+    std::string msg(modem_stats);
+    publish(msg);
+#endif
+}
+
+int send_device_to_system(void *context)
+{
+    ConnectionManager *conn_m = (ConnectionManager *)context;
+    if (conn_m==NULL) return -1;
     conn_m->setConnectionStatus(TRYING_TO_CONNECT);
     if (conn_m->connectToServer()==0) {
         conn_m->setConnectionStatus(CONNECTED_TO_SERVER);
         char topictoreadfrom[128] = "devices/";
         strcat(topictoreadfrom, DEVICE_ID);
         strcat(topictoreadfrom,"/messages/devicebound/#");
+        if (conn_m->isCancelled()) return -1;
         if (conn_m->subscribe(topictoreadfrom, 0, system_to_device_message_handler) < 0) {
             printf("Error while subcribing to topic %s.\r\n", topictoreadfrom);
         } else {
@@ -555,60 +649,71 @@ void send_device_to_system(ConnectionManager *conn_m)
     } else {
         conn_m->setConnectionStatus(CONNECTION_FAILED);
     }
-    while(true) {wait(10);}    
+    return 0;
 }
 
-void send_all_device_to_system(ConnectionManager *conn_m)
+int send_all_device_to_system(void *context)
 {
-    if (conn_m==NULL) return;
+    ConnectionManager *conn_m = (ConnectionManager *)context;
+    if (conn_m==NULL) return -1;
     conn_m->setConnectionStatus(TRYING_TO_CONNECT);
     if (conn_m->connectToServer()==0) {
         conn_m->setConnectionStatus(CONNECTED_TO_SERVER);
         char topictoreadfrom[128] = "devices/";
         strcat(topictoreadfrom, DEVICE_ID);
         strcat(topictoreadfrom,"/messages/devicebound/#");
+        if (conn_m->isCancelled()) return -1;
         if (conn_m->subscribe(topictoreadfrom, 0, system_to_device_message_handler) < 0) {
             printf("Error while subcribing to topic %s.\r\n", topictoreadfrom);
         } else {
             printf("Successfully subscribred to topic %s\r\n", topictoreadfrom);
         }
+        if (conn_m->isCancelled()) return -1;
         conn_m->trackSystemToDeviceMessages();
         LogManager *log_m = conn_m->getLogManager();
         FILE_HANDLE fh;
         std::string dts;
         log_m->startDeviceToSystemDumpSession(fh);
-        while (log_m->getNextDeviceToSystemMessage(fh, dts)) conn_m->publish(dts);
-        log_m->flushDeviceToSystemFile(fh);
+        while (!conn_m->isCancelled() && log_m->getNextDeviceToSystemMessage(fh, dts)) conn_m->publish(dts);
+        /* a cancelled dump keeps the file, what was not sent goes with the next session */
+        if (!conn_m->isCancelled()) log_m->flushDeviceToSystemFile(fh);
         log_m->stopDeviceSystemDumpSession(fh);
     } else {
         conn_m->setConnectionStatus(CONNECTION_FAILED);
     }
-    while(true) {wait(10);}      
+    return 0;
 }
 
 bool ConnectionManager::sendAllMessages(LogManager *log_m, int timeout)
 {
     int rc;
     _msg_sent = false;
-    Thread s1;
+    THREAD_HANDLE task;
     _log_m = log_m;
-    _connect_mutex->lock();
-    rc = _mqtt->startMQTTClient();
-    _connect_mutex->unlock();
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        rc = modem.locked() && _mqtt->startMQTTClient();
+    }
     if (!rc) return false;
-    _connect_mutex->lock();
-    _bg96->disallowPowerOff();
-    _connect_mutex->unlock();
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        if (!modem.locked()) return false;
+        _bg96->disallowPowerOff();
+    }
     _timeout_triggered = false;
-    _timeout.attach(device_to_system_timeout, timeout);
-    s1.start(callback(send_all_device_to_system,this));
-    while(!_timeout_triggered) { if (_msg_sent) break;};
-    s1.terminate();
-    s1.join();
+    _cancel.reset();
+    _timeout.attach(callback(this, &ConnectionManager::sessionTimeout), timeout);
+    /* the timeout cancels the task, it returns between two messages */
+    if (ThreadAPI_Submit(&task, send_all_device_to_system, this) == THREADAPI_OK) {
+        ThreadAPI_Join(task, NULL);
+    } else {
+        printf("ConnectionManager: could not queue the connection task.\r\n");
+    }
     _timeout.detach();
-    _connect_mutex->lock();
-    _bg96->allowPowerOff();
-    _connect_mutex->unlock();
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        if (modem.locked()) _bg96->allowPowerOff();
+    }
     disconnect();
     if (_msg_sent) {
         return true;
@@ -621,25 +726,31 @@ bool ConnectionManager::sendDeviceToSystemMessage(std::string &device_to_system_
 {
     int rc;
     _msg_sent = false;
-    Thread s1;
-    _connect_mutex->lock();
-    rc = _mqtt->startMQTTClient();
-    _connect_mutex->unlock();
+    THREAD_HANDLE task;
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        rc = modem.locked() && _mqtt->startMQTTClient();
+    }
     if (!rc) return false;
-    _connect_mutex->lock();
-    _bg96->disallowPowerOff();
-    _connect_mutex->unlock();
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        if (!modem.locked()) return false;
+        _bg96->disallowPowerOff();
+    }
     _timeout_triggered = false;
-    _timeout.attach(device_to_system_timeout, timeout);
+    _cancel.reset();
+    _timeout.attach(callback(this, &ConnectionManager::sessionTimeout), timeout);
     _device_message = device_to_system_message;
-    s1.start(callback(send_device_to_system,this));
-    while(!_timeout_triggered) { if (_msg_sent) break;};
-    s1.terminate();
-    s1.join();
+    if (ThreadAPI_Submit(&task, send_device_to_system, this) == THREADAPI_OK) {
+        ThreadAPI_Join(task, NULL);
+    } else {
+        printf("ConnectionManager: could not queue the connection task.\r\n");
+    }
     _timeout.detach();
-    _connect_mutex->lock();
-    _bg96->allowPowerOff();
-    _connect_mutex->unlock();
+    {
+        ModemLock modem(_arbiter, modem_owner);
+        if (modem.locked()) _bg96->allowPowerOff();
+    }
     disconnect();
     if (_msg_sent) {
         return true;
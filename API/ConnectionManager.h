@@ -2,10 +2,41 @@
 #define __CONNECTION_MANAGER_H__
 #include "mbed.h"
 #include "LogManager.h"
+#include "ModemArbiter.h"
 #include <string>
 #include "mbed-os/drivers/LowPowerTimeout.h"
 #include "BG96Interface.h"
 #include "BG96MQTTClient.h"
+#include "azure_c_shared_utility/azure_c_shared_utility/hmacsha256.h"
+
+/* A cached SAS token is generated again when it has less than this many seconds left */
+#if !defined(SAS_TOKEN_REFRESH_MARGIN)
+#define SAS_TOKEN_REFRESH_MARGIN 300
+#endif
+
+/* Room for the gballoc heap stats published on every connection, publish() copies at most 1548 bytes */
+#if !defined(HEAP_STATS_MAX_LENGTH)
+#define HEAP_STATS_MAX_LENGTH 1536
+#endif
+
+/* Room for the modem arbiter counters, published with the heap stats when the build defines PUBLISH_MODEM_STATS */
+#if !defined(MODEM_STATS_MAX_LENGTH)
+#define MODEM_STATS_MAX_LENGTH 1024
+#endif
+
+/* Set by the owner of a session when it stops waiting for it, or by the session timeout. The connection task
+checks it between modem commands and returns, so the modem and its mutex are left in a known state */
+class CancellationToken
+{
+public:
+    CancellationToken() : _cancelled(false) {}
+    void reset(void) { _cancelled = false; }
+    void cancel(void) { _cancelled = true; }
+    bool isCancelled(void) const { return _cancelled; }
+
+private:
+    volatile bool _cancelled;
+};
 
 typedef enum {
     TRYING_TO_CONNECT, CONNECTION_FAILED, DISCONNECTING, DISCONNECTED, CONNECTED_TO_SERVER
@@ -16,7 +47,7 @@ typedef enum {
 class ConnectionManager
 {
 public:
-    ConnectionManager(BG96Interface *bg96, Mutex * bg96mutex);
+    ConnectionManager(BG96Interface *bg96, ModemArbiter *arbiter);
     ~ConnectionManager();
 
     bool sendDeviceToSystemMessage(std::string &device_to_system_message, int timeout);
@@ -31,18 +62,24 @@ public:
     int  subscribe(char *topic, int qos, MQTTMessageHandler handler);
     void publish(void);
     void publish(std::string &msg);
+    void publishHeapStats(void);
+    void publishModemStats(void);
     void disconnect(void);
     void newSystemMessage(char * msg, size_t len);
     bool sendAllMessages(LogManager *log_m, int timeout);
     LogManager * getLogManager(){ return _log_m;};
+    bool isCancelled(void) const { return _cancel.isCancelled(); }
 
 private:
-    size_t  replace_str(char * initial, char * token, char * replacement);
+    int     replace_str(char * initial, size_t size, const char * token, const char * replacement);
     int     get_seconds_since_epoch(size_t* seconds);
-    int     SignAuthPayload(const char* key, const char* stringToSign, unsigned char** output, size_t* len);
+    int     SignAuthPayload(const char* key, const char* encodedUri, const char* expiry, unsigned char** output, size_t* len);
     size_t  generate_sas_token(char *out, const char * resourceUri, const char * key, const char * policyName, int expiryInSeconds);
+    bool    cancelledBefore(const char *step);
+    void    sessionTimeout(void);
 
     LowPowerTimeout _timeout;
+    CancellationToken _cancel;
     BG96Interface *_bg96;
     BG96MQTTClient * _mqtt;
     LogManager *_log_m;
@@ -50,12 +87,16 @@ private:
     char username[256]={0};
     char clientid[80] = {0};
     char sas_token[BG96MQTTCLIENT_MAX_SAS_TOKEN_LENGTH] = {0};
+    size_t _sas_token_expiry;
+    HMACSHA256_KEY _sas_key;
+    bool _sas_key_ready;
+    const char * _sas_key_source;
     std::string _system_message;
     std::string _device_message;
     bool _msg_received;
     bool _msg_sent;
 //    Thread *_connect_thread;
-    Mutex * _connect_mutex;
+    ModemArbiter * _arbiter;
     CONN_STATE _conn_state;
     double _rssi;
 };
@@ -0,0 +1,190 @@
+#include "DisplayManager.h"
+#include "epd1in54.h"
+#include <string.h>
+
+DisplayManager::DisplayManager(Epd *epd)
+{
+    _epd = epd;
+    _count = 0;
+    _awake = false;
+    memset(_frame_buffer, 0xFF, sizeof(_frame_buffer));
+}
+
+/**
+* Full refresh of the panel, then switches it to partial updates.
+* Both frame memories of the panel are cleared and every widget is drawn again.
+**/
+int DisplayManager::begin(void)
+{
+    if (_epd->Init(lut_full_update) != 0) return -1;
+    _epd->ClearFrameMemory(0xFF);
+    _epd->DisplayFrame();
+    _epd->ClearFrameMemory(0xFF);
+    _epd->DisplayFrame();
+    if (_epd->Init(lut_partial_update) != 0) return -1;
+    _awake = true;
+    memset(_frame_buffer, 0xFF, sizeof(_frame_buffer));
+    for (int i = 0; i < _count; i++) {
+        _widgets[i].dirty = true;
+        _widgets[i].pending = false;
+        _widgets[i].resend = false;
+    }
+    return 0;
+}
+
+int DisplayManager::addWidget(WIDGET_TYPE type, int x, int y, int width, int height)
+{
+    if (_count >= DISPLAY_MAX_WIDGETS) return -1;
+    Widget &widget = _widgets[_count];
+    memset(&widget, 0, sizeof(Widget));
+    widget.type = type;
+    widget.x = x;
+    widget.y = y;
+    widget.width = width;
+    widget.height = height;
+    widget.visible = true;
+    widget.dirty = true;
+    return _count++;
+}
+
+int DisplayManager::addText(int x, int y, int max_chars, sFONT *font)
+{
+    if (font == NULL || max_chars <= 0 || max_chars > DISPLAY_MAX_TEXT_LENGTH) return -1;
+    int id = addWidget(WIDGET_TEXT, x, y, max_chars * font->Width, font->Height);
+    if (id >= 0) _widgets[id].font = font;
+    return id;
+}
+
+int DisplayManager::addBar(int x, int y, int width, int height, int min, int max)
+{
+    if (max <= min || width < 3 || height < 3) return -1;
+    int id = addWidget(WIDGET_BAR, x, y, width, height);
+    if (id >= 0) {
+        _widgets[id].min = min;
+        _widgets[id].max = max;
+    }
+    return id;
+}
+
+int DisplayManager::addIcon(int x, int y, int width, int height, const unsigned char *bitmap)
+{
+    if (bitmap == NULL) return -1;
+    int id = addWidget(WIDGET_ICON, x, y, width, height);
+    if (id >= 0) _widgets[id].bitmap = bitmap;
+    return id;
+}
+
+void DisplayManager::setText(int id, const char *text)
+{
+    if (id < 0 || id >= _count || _widgets[id].type != WIDGET_TEXT || text == NULL) return;
+    Widget &widget = _widgets[id];
+    char truncated[DISPLAY_MAX_TEXT_LENGTH+1];
+    int max_chars = widget.width / widget.font->Width;
+    strncpy(truncated, text, max_chars);
+    truncated[max_chars] = 0;
+    if (strcmp(truncated, widget.text) == 0) return;
+    strcpy(widget.text, truncated);
+    widget.dirty = true;
+}
+
+/**
+* Only the number of filled pixels matters for what is drawn, values that
+* land on the same pixel do not trigger a redraw.
+**/
+void DisplayManager::setValue(int id, int value)
+{
+    if (id < 0 || id >= _count || _widgets[id].type != WIDGET_BAR) return;
+    Widget &widget = _widgets[id];
+    int inner = widget.width - 2;
+    if (value < widget.min) value = widget.min;
+    if (value > widget.max) value = widget.max;
+    int fill = (value - widget.min) * inner / (widget.max - widget.min);
+    if (fill == widget.fill) return;
+    widget.fill = fill;
+    widget.dirty = true;
+}
+
+void DisplayManager::setVisible(int id, bool visible)
+{
+    if (id < 0 || id >= _count || _widgets[id].visible == visible) return;
+    _widgets[id].visible = visible;
+    _widgets[id].dirty = true;
+}
+
+void DisplayManager::draw(Widget &widget)
+{
+    switch (widget.type) {
+    case WIDGET_TEXT:
+        _epd->DrawStringAt(_frame_buffer, widget.x, widget.y, widget.text, widget.font, COLORED);
+        break;
+    case WIDGET_BAR:
+        _epd->DrawRectangle(_frame_buffer, widget.x, widget.y,
+                            widget.x + widget.width - 1, widget.y + widget.height - 1, COLORED);
+        if (widget.fill > 0) {
+            _epd->DrawFilledRectangle(_frame_buffer, widget.x + 1, widget.y + 1,
+                                      widget.x + widget.fill, widget.y + widget.height - 2, COLORED);
+        }
+        break;
+    case WIDGET_ICON: {
+        // an icon is drawn as the single glyph of a one character font
+        sFONT icon = { widget.bitmap, (uint16_t)widget.width, (uint16_t)widget.height, NULL, NULL };
+        _epd->DrawCharAt(_frame_buffer, widget.x, widget.y, ' ', &icon, COLORED);
+        break;
+    }
+    }
+}
+
+/**
+* Draws the widgets that changed into the frame buffer, without touching the panel.
+* Returns true if anything was drawn.
+**/
+bool DisplayManager::render(void)
+{
+    bool rendered = false;
+    for (int i = 0; i < _count; i++) {
+        Widget &widget = _widgets[i];
+        if (!widget.dirty) continue;
+        _epd->DrawFilledRectangle(_frame_buffer, widget.x, widget.y,
+                                  widget.x + widget.width - 1, widget.y + widget.height - 1, UNCOLORED);
+        if (widget.visible) draw(widget);
+        widget.dirty = false;
+        widget.pending = true;
+        rendered = true;
+    }
+    return rendered;
+}
+
+/**
+* Renders the changed widgets and sends the areas they cover to the panel.
+* The panel swaps between two frame memories on every refresh, so an area is
+* sent again on the following update to bring the other memory up to date.
+* Returns false, leaving the panel alone, when nothing changed.
+**/
+bool DisplayManager::update(void)
+{
+    bool sent = false;
+    if (!_awake && begin() != 0) return false;
+    render();
+    for (int i = 0; i < _count; i++) {
+        Widget &widget = _widgets[i];
+        if (widget.pending || widget.resend) {
+            _epd->SetFrameMemoryArea(_frame_buffer, widget.x, widget.y, widget.width, widget.height);
+            sent = true;
+        }
+        widget.resend = widget.pending;
+        widget.pending = false;
+    }
+    if (sent) _epd->DisplayFrame();
+    return sent;
+}
+
+/**
+* Puts the panel in deep sleep. Its memory is not trusted afterwards, the next
+* update starts with a full refresh.
+**/
+void DisplayManager::sleep(void)
+{
+    if (!_awake) return;
+    _epd->Sleep();
+    _awake = false;
+}
@@ -0,0 +1,68 @@
+#ifndef __DISPLAY_MANAGER_H__
+#define __DISPLAY_MANAGER_H__
+#include "mbed.h"
+#include "epd1in54.h"
+
+#if !defined(DISPLAY_MAX_WIDGETS)
+#define DISPLAY_MAX_WIDGETS 16
+#endif
+#if !defined(DISPLAY_MAX_TEXT_LENGTH)
+#define DISPLAY_MAX_TEXT_LENGTH 16
+#endif
+
+typedef enum {
+    WIDGET_TEXT, WIDGET_BAR, WIDGET_ICON
+} WIDGET_TYPE;
+
+typedef struct {
+    WIDGET_TYPE         type;
+    int                 x;
+    int                 y;
+    int                 width;
+    int                 height;
+    sFONT               *font;                      // WIDGET_TEXT
+    char                text[DISPLAY_MAX_TEXT_LENGTH+1];
+    int                 min;                        // WIDGET_BAR
+    int                 max;
+    int                 fill;                       // filled pixels currently drawn
+    const unsigned char *bitmap;                    // WIDGET_ICON, 1 bpp rows, msb first
+    bool                visible;
+    bool                dirty;                      // value changed, not rendered yet
+    bool                pending;                    // rendered, not sent to the panel yet
+    bool                resend;                     // sent on the last update, due for the other frame memory
+} Widget;
+
+/**
+ * Retained-mode layer over the e-paper display. Widgets keep their area and
+ * value, only those whose rendered content changed are drawn again and only
+ * the area they cover is sent to the panel with a partial update.
+ **/
+class DisplayManager
+{
+public:
+    DisplayManager(Epd *epd);
+    ~DisplayManager(){};
+    int  begin(void);
+    int  addText(int x, int y, int max_chars, sFONT *font);
+    int  addBar(int x, int y, int width, int height, int min, int max);
+    int  addIcon(int x, int y, int width, int height, const unsigned char *bitmap);
+    void setText(int id, const char *text);
+    void setValue(int id, int value);
+    void setVisible(int id, bool visible);
+    bool render(void);
+    bool update(void);
+    void sleep(void);
+    const unsigned char * getFrameBuffer(){ return _frame_buffer; };
+
+private:
+    int  addWidget(WIDGET_TYPE type, int x, int y, int width, int height);
+    void draw(Widget &widget);
+
+    Epd             *_epd;
+    Widget          _widgets[DISPLAY_MAX_WIDGETS];
+    int             _count;
+    bool            _awake;
+    unsigned char   _frame_buffer[EPD_WIDTH*EPD_HEIGHT/8];
+};
+
+#endif //__DISPLAY_MANAGER_H__
@@ -3,10 +3,12 @@
 #include "BG96Interface.h"
 #include <string.h>
 
-LocationManager::LocationManager(BG96Interface *bg96, Mutex * bg96mutex)
+static const char modem_owner[] = "LocationManager";
+
+LocationManager::LocationManager(BG96Interface *bg96, ModemArbiter *arbiter)
 {
     _bg96 = bg96;
-    _loc_m_mutex = bg96mutex;
+    _arbiter = arbiter;
 }
 
 LocationManager::~LocationManager()
@@ -15,8 +17,9 @@ LocationManager::~LocationManager()
 
 bool LocationManager::tryGetGNSSLocation(GNSSLoc &current_location, int tries)
 {
-    bool done;
-    _loc_m_mutex->lock();
+    bool done = false;
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return false;
     _bg96->initializeGNSS();
     _bg96->disallowPowerOff();
     for (int i = 0; i < tries; i++) {
@@ -26,17 +29,14 @@ bool LocationManager::tryGetGNSSLocation(GNSSLoc &current_location, int tries)
     _bg96->allowPowerOff();
     _bg96->powerDown();
     wait(1);
-    _loc_m_mutex->unlock();
     return done;
 }
 
 bool LocationManager::getGNSSLocation(GNSSLoc &current_location)
 {
-    bool rc;
-    _loc_m_mutex->lock();
-    rc = _bg96->getGNSSLocation(current_location);
-    _loc_m_mutex->unlock();
-    return rc;
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return false;
+    return _bg96->getGNSSLocation(current_location);
 }
 
 void LocationManager::getCurrentLatitude(double &latitude)
@@ -4,11 +4,12 @@
 #include <string>
 #include "GNSSLoc.h"
 #include "BG96Interface.h"
+#include "ModemArbiter.h"
 
 class LocationManager
 {
 public:
-    LocationManager(BG96Interface *bg96, Mutex * bg96mutex);
+    LocationManager(BG96Interface *bg96, ModemArbiter *arbiter);
     ~LocationManager();
     bool tryGetGNSSLocation(GNSSLoc &current_location, int tries);
     void getCurrentLatitude(double &latitude);
@@ -19,7 +20,7 @@ private:
     Timer _timeout;
     BG96Interface *_bg96;
     GNSSLoc _current_loc;
-    Mutex * _loc_m_mutex;
+    ModemArbiter *_arbiter;
 };
 
 #endif //__LOCATION_MANAGER_H__
\ No newline at end of file
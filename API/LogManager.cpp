@@ -4,8 +4,9 @@
 #include <string>
 
 char dts[BG96_MQTT_CLIENT_MAX_PUBLISH_MSG_SIZE];
+static const char modem_owner[] = "LogManager";
 
-LogManager::LogManager(BG96Interface *bg96, Mutex * bg96mutex)
+LogManager::LogManager(BG96Interface *bg96, ModemArbiter *arbiter)
 {
     _bg96 = bg96;
     _dts_file_offset = 0;
@@ -13,12 +14,13 @@ LogManager::LogManager(BG96Interface *bg96, Mutex * bg96mutex)
     _dts_file_handle = 0;
     _events_file_handle = 0;
     _location_events_file_handle = 0;
-    _log_m_mutex = bg96mutex;
+    _arbiter = arbiter;
 }
 
 bool LogManager::append(std::string filename, void *data, size_t length, bool initialize, bool powerOff)
 {
-    _log_m_mutex->lock();
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return false;
     if (initialize) _bg96->initializeBG96();
     _bg96->disallowPowerOff();
     FILE_HANDLE fh;
@@ -37,7 +39,6 @@ bool LogManager::append(std::string filename, void *data, size_t length, bool in
         _bg96->powerDown();
         wait(1);
     }
-    _log_m_mutex->unlock();
     return true;
 }
 
@@ -47,27 +48,27 @@ bool LogManager::appendDeviceToSystemMessage(std::string &dts_string)
     char eol = '\n';
     strcpy(dts, dts_string.c_str());
     std::string filename = DEVICE_TO_SYSTEM_MSG_FILENAME;
-    _log_m_mutex->lock();
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return false;
     if (append(filename, (void *) dts, strlen(dts)+1, true, false)) {
         rc = append(filename, (void *) &eol, 1, false, true);
     } else {
         rc = false;
     }
-    _log_m_mutex->unlock();
     return rc;
 }
 
 bool LogManager::startDeviceToSystemDumpSession(FILE_HANDLE &fh)
 {
     bool rc = false;
-    _log_m_mutex->lock();
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return false;
     _bg96->disallowPowerOff();
     if (_bg96->fs_open(DEVICE_TO_SYSTEM_MSG_FILENAME, EXISTONLY_RO, fh)) {
         rc = _bg96->fs_rewind(fh);
     } else {
         rc = false;
     }
-    _log_m_mutex->unlock();
     return rc;
 }
 
@@ -75,13 +76,13 @@ bool LogManager::getNextDeviceToSystemMessage(FILE_HANDLE &fh, std::string &dts_
 {
     bool rc;
     char buffer[BG96_MQTT_CLIENT_MAX_PUBLISH_MSG_SIZE] = {0};
-    _log_m_mutex->lock();
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return false;
     for (int i = 0; i < BG96_MQTT_CLIENT_MAX_PUBLISH_MSG_SIZE; i++) {
         rc = _bg96->fs_read(fh,1,&buffer[i]);
         if (!rc) return false; //reading past the eof will return an error;
         if (buffer[i] == '\n') break;
     }
-    _log_m_mutex->unlock();
 
     dts_string = buffer;
     return true;
@@ -89,22 +90,22 @@ bool LogManager::getNextDeviceToSystemMessage(FILE_HANDLE &fh, std::string &dts_
 
 bool LogManager::flushDeviceToSystemFile(FILE_HANDLE &fh)
 {
-    _log_m_mutex->lock();
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return false;
     bool rc = _bg96->fs_rewind(fh);
     if (rc) {
         rc = _bg96->fs_truncate(fh, 0);
     }
-    _log_m_mutex->unlock();
 
     return rc;
 }
 
 void LogManager::stopDeviceSystemDumpSession(FILE_HANDLE &fh)
 {
-    _log_m_mutex->unlock();
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return;
     _bg96->fs_close(fh);
     _bg96->allowPowerOff();
-    _log_m_mutex->unlock();
 }
 
 bool LogManager::logAnError(std::string error)
@@ -112,13 +113,13 @@ bool LogManager::logAnError(std::string error)
     bool rc;
     char eol = '\n';
     std::string filename = ERRORS_FILENAME;
-    _log_m_mutex->lock();
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return false;
     if (append(filename, (void *)(error.c_str()), error.length()+1, true, false)) {
         rc = append(filename, (void *) &eol, 1, false, true);
     } else {
         rc = false;
     }
-    _log_m_mutex->unlock();
     return rc;
 }
 
@@ -128,7 +129,8 @@ bool LogManager::logNewLocation(GNSSLoc &loc)
     char eol = '\n';
     char location_line[80];
     std::string filename(LOCATION_HISTORY_FILENAME);
-    _log_m_mutex->lock();
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return false;
     time_t loctime = loc.getGNSSTime();
     sprintf(location_line, "%s: %3.6f, %3.6f", ctime(&loctime), loc.getGNSSLatitude(), loc.getGNSSLongitude());
     if (append(filename, (void *)location_line, strlen(location_line)+1, true, false)) {
@@ -136,7 +138,6 @@ bool LogManager::logNewLocation(GNSSLoc &loc)
     } else {
         rc = false;
     }
-    _log_m_mutex->unlock();
     return rc;    
 }
 
@@ -157,13 +158,13 @@ bool LogManager::logSystemStartEvent()
     bool rc;
     char eol = '\n';
     std::string filename(EVENTS_FILENAME);
-    _log_m_mutex->lock();
+    ModemLock modem(_arbiter, modem_owner);
+    if (!modem.locked()) return false;
     if (append(filename, (void *)fevent.c_str(), fevent.length()+1, true, false)) {
         rc = append(filename, (void *) &eol, (size_t)1, false, true);
     } else {
         rc = false;
     }
-    _log_m_mutex->unlock();
     return rc;  
 }
 
@@ -2,6 +2,7 @@
 #define __LOG_MANAGER_H__
 #include "BG96Interface.h"
 #include "FSInterface.h"
+#include "ModemArbiter.h"
 #include "mbed.h"
 #include "Thread.h"
 #include <string>
@@ -22,7 +23,7 @@
 class LogManager
 {
 public:
-    LogManager(BG96Interface *bg96, Mutex *bg96mutex);
+    LogManager(BG96Interface *bg96, ModemArbiter *arbiter);
     ~LogManager(){};
     bool logAnError(std::string error);
     bool logNewLocation(GNSSLoc &loc);
@@ -36,7 +37,7 @@ public:
     bool flushDeviceToSystemFile(FILE_HANDLE &fh);
 private:
     bool append(std::string filename, void *data, size_t length, bool initialize, bool powerOff);
-    Mutex           * _log_m_mutex;
+    ModemArbiter    * _arbiter;
     BG96Interface   * _bg96;
     size_t          _dts_file_offset;
     FILE_HANDLE     _dts_file_handle;
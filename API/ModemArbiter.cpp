@@ -0,0 +1,130 @@
+#include "ModemArbiter.h"
+#include <stdio.h>
+#include <string.h>
+
+ModemArbiter::ModemArbiter()
+{
+    _owner = NULL;
+    _holder = NULL;
+    _depth = 0;
+    _held_since = 0;
+    _owners = 0;
+    memset(_stats, 0, sizeof(_stats));
+    _clock.start();
+}
+
+/* _stats_mutex must be held */
+ModemOwnerStats * ModemArbiter::ownerStats(const char *owner)
+{
+    for (int i = 0; i < _owners; i++) {
+        if (_stats[i].owner == owner || strcmp(_stats[i].owner, owner) == 0) return &_stats[i];
+    }
+    if (_owners == MODEM_ARBITER_MAX_OWNERS) return &_stats[MODEM_ARBITER_MAX_OWNERS-1];
+    _stats[_owners].owner = owner;
+    return &_stats[_owners++];
+}
+
+bool ModemArbiter::acquire(const char *owner, uint32_t timeout_ms)
+{
+    uint32_t start = _clock.read_ms();
+    bool contended = false;
+    if (!_mutex.trylock()) {
+        contended = true;
+        if (_mutex.lock(timeout_ms) != osOK) {
+            _stats_mutex.lock();
+            const char *holder = _owner;
+            uint32_t held = _clock.read_ms() - _held_since;
+            ownerStats(owner)->timeouts++;
+            _stats_mutex.unlock();
+            if (holder != NULL) {
+                printf("ModemArbiter: %s gave up on the modem after %u ms, %s holds it for %u ms.\r\n",
+                       owner, (unsigned int)timeout_ms, holder, (unsigned int)held);
+            } else {
+                printf("ModemArbiter: %s gave up on the modem after %u ms.\r\n", owner, (unsigned int)timeout_ms);
+            }
+            return false;
+        }
+    }
+    if (_depth++ > 0) return true;
+
+    uint32_t now = _clock.read_ms();
+    uint32_t waited = now - start;
+    _stats_mutex.lock();
+    _owner = owner;
+    _holder = Thread::gettid();
+    _held_since = now;
+    ModemOwnerStats *stats = ownerStats(owner);
+    stats->acquisitions++;
+    if (contended) stats->contended++;
+    stats->wait_ms += waited;
+    if (waited > stats->max_wait_ms) stats->max_wait_ms = waited;
+    _stats_mutex.unlock();
+    return true;
+}
+
+void ModemArbiter::release(void)
+{
+    _stats_mutex.lock();
+    bool holds = (_holder == Thread::gettid());
+    _stats_mutex.unlock();
+    if (!holds) {
+        printf("ModemArbiter: release by a thread that does not hold the modem.\r\n");
+        return;
+    }
+    if (--_depth == 0) {
+        _stats_mutex.lock();
+        uint32_t held = _clock.read_ms() - _held_since;
+        ModemOwnerStats *stats = ownerStats(_owner);
+        stats->hold_ms += held;
+        if (held > stats->max_hold_ms) stats->max_hold_ms = held;
+        _owner = NULL;
+        _holder = NULL;
+        _stats_mutex.unlock();
+    }
+    _mutex.unlock();
+}
+
+bool ModemArbiter::getOwnerStats(int index, ModemOwnerStats &stats)
+{
+    bool rc = false;
+    _stats_mutex.lock();
+    if (index >= 0 && index < _owners) {
+        stats = _stats[index];
+        rc = true;
+    }
+    _stats_mutex.unlock();
+    return rc;
+}
+
+/**
+* Writes the counters of every owner as a 0 terminated JSON array.
+* Returns its length, or 0 and an empty string if it does not fit in size bytes.
+**/
+size_t ModemArbiter::exportStats(char *out, size_t size)
+{
+    size_t len = 0;
+    int n;
+    if (out == NULL || size == 0) return 0;
+    _stats_mutex.lock();
+    n = snprintf(out, size, "[");
+    for (int i = 0; i < _owners && n >= 0 && len + n < size; i++) {
+        len += n;
+        ModemOwnerStats &stats = _stats[i];
+        n = snprintf(out + len, size - len,
+                     "%s{\"owner\":\"%s\",\"acquisitions\":%u,\"contended\":%u,\"timeouts\":%u,"
+                     "\"wait_ms\":%u,\"max_wait_ms\":%u,\"hold_ms\":%u,\"max_hold_ms\":%u}",
+                     (i > 0) ? "," : "", stats.owner, (unsigned int)stats.acquisitions,
+                     (unsigned int)stats.contended, (unsigned int)stats.timeouts, (unsigned int)stats.wait_ms,
+                     (unsigned int)stats.max_wait_ms, (unsigned int)stats.hold_ms, (unsigned int)stats.max_hold_ms);
+    }
+    _stats_mutex.unlock();
+    if (n >= 0 && len + n < size) {
+        len += n;
+        n = snprintf(out + len, size - len, "]");
+    }
+    if (n < 0 || len + n >= size) {
+        out[0] = 0;
+        return 0;
+    }
+    return len + n;
+}
@@ -0,0 +1,72 @@
+#ifndef __MODEM_ARBITER_H__
+#define __MODEM_ARBITER_H__
+#include "mbed.h"
+#include "mbed-os/drivers/LowPowerTimer.h"
+
+/* How long a manager waits for the modem before giving up, longer than the slowest BG96 command
+(150 seconds to activate a PDP context) */
+#if !defined(MODEM_ARBITER_TIMEOUT_MS)
+#define MODEM_ARBITER_TIMEOUT_MS 180000
+#endif
+/* Owners past this count share the counters of the last one */
+#if !defined(MODEM_ARBITER_MAX_OWNERS)
+#define MODEM_ARBITER_MAX_OWNERS 8
+#endif
+
+typedef struct {
+    const char *owner;
+    uint32_t acquisitions;
+    uint32_t contended;     // acquisitions that had to wait for another owner
+    uint32_t timeouts;
+    uint32_t wait_ms;       // total over all acquisitions
+    uint32_t max_wait_ms;
+    uint32_t hold_ms;
+    uint32_t max_hold_ms;
+} ModemOwnerStats;
+
+/**
+* Serialises the managers on the BG96. The lock is an rtos Mutex, which RTX creates recursive
+* and with priority inheritance: a low priority holder runs at the priority of the highest
+* waiter until it lets go. Acquisition is timed, so an owner that never lets go shows up as a
+* logged failure naming it instead of a hang. Nested acquisitions count for the outermost owner.
+**/
+class ModemArbiter
+{
+public:
+    ModemArbiter();
+    bool acquire(const char *owner, uint32_t timeout_ms = MODEM_ARBITER_TIMEOUT_MS);
+    void release(void);
+    bool getOwnerStats(int index, ModemOwnerStats &stats);
+    size_t exportStats(char *out, size_t size);
+private:
+    ModemOwnerStats * ownerStats(const char *owner);
+    Mutex           _mutex;
+    Mutex           _stats_mutex;   // guards the counters and who holds the modem
+    LowPowerTimer   _clock;
+    const char      * _owner;
+    osThreadId      _holder;
+    int             _depth;         // only touched by the holder
+    uint32_t        _held_since;
+    int             _owners;
+    ModemOwnerStats _stats[MODEM_ARBITER_MAX_OWNERS];
+};
+
+/**
+* Holds the modem for the scope it lives in. locked() is false when the
+* arbiter gave up waiting, the modem must not be used then.
+**/
+class ModemLock
+{
+public:
+    ModemLock(ModemArbiter *arbiter, const char *owner, uint32_t timeout_ms = MODEM_ARBITER_TIMEOUT_MS)
+        : _arbiter(arbiter), _locked(arbiter->acquire(owner, timeout_ms)) {}
+    ~ModemLock() { if (_locked) _arbiter->release(); }
+    bool locked(void) const { return _locked; }
+private:
+    ModemLock(const ModemLock &);
+    ModemLock &operator=(const ModemLock &);
+    ModemArbiter    * _arbiter;
+    bool            _locked;
+};
+
+#endif //__MODEM_ARBITER_H__
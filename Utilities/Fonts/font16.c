@@ -38,6 +38,9 @@
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
+/* packed copy in font16_rle.c, see fontpack.py */
+#if !defined(FONTS_COMPRESSED)
+
 // 
 //  Font data for Courier New 12pt
 // 
@@ -1761,5 +1764,7 @@ sFONT Font16 = {
   16, /* Height */
 };
 
+#endif /* FONTS_COMPRESSED */
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
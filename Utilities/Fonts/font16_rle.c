@@ -0,0 +1,153 @@
+/* Generated by fontpack.py from font16.c, do not edit. */
+#include "fonts.h"
+
+#if defined(FONTS_COMPRESSED)
+
+/* 2153 bytes, 3040 bytes as raw bitmaps */
+static const uint8_t Font16_Rle_Table[] =
+{
+  0x9F, 0x00, 0x02, 0x00, 0x00, 0x0C, 0x8E, 0x00, 0x04, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x88, 0x00,
+  0x83, 0x00, 0x05, 0x1D, 0xC0, 0x00, 0x00, 0x15, 0x40, 0x83, 0x00, 0x01, 0x08, 0x80, 0x8F, 0x00,
+  0x03, 0x00, 0x00, 0x0D, 0x80, 0x85, 0x00, 0x07, 0x32, 0x40, 0x24, 0xC0, 0x24, 0xC0, 0x24, 0xC0,
+  0x85, 0x00, 0x00, 0x1B, 0x86, 0x00, 0x04, 0x04, 0x00, 0x1B, 0x80, 0x2E, 0x82, 0x00, 0x08, 0x09,
+  0x80, 0x26, 0x00, 0x11, 0x00, 0x0C, 0x80, 0x32, 0x82, 0x00, 0x02, 0x0E, 0x80, 0x3B, 0x82, 0x00,
+  0x00, 0x04, 0x84, 0x00, 0x04, 0x00, 0x00, 0x18, 0x00, 0x3C, 0x82, 0x00, 0x0F, 0x3C, 0xC0, 0x1F,
+  0x40, 0x19, 0x80, 0x2F, 0x80, 0x33, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0x80, 0x87, 0x00, 0x83,
+  0x00, 0x02, 0x0F, 0x00, 0x17, 0x84, 0x00, 0x0B, 0x14, 0x00, 0x11, 0x80, 0x2A, 0x80, 0x04, 0x00,
+  0x2E, 0x80, 0x1D, 0x80, 0x87, 0x00, 0x83, 0x00, 0x00, 0x07, 0x82, 0x00, 0x00, 0x05, 0x84, 0x00,
+  0x00, 0x02, 0x90, 0x00, 0x02, 0x00, 0x00, 0x03, 0x82, 0x00, 0x04, 0x05, 0x00, 0x08, 0x00, 0x02,
+  0x86, 0x00, 0x04, 0x02, 0x00, 0x08, 0x00, 0x05, 0x82, 0x00, 0x00, 0x03, 0x84, 0x00, 0x02, 0x00,
+  0x00, 0x18, 0x82, 0x00, 0x02, 0x14, 0x00, 0x0A, 0x8A, 0x00, 0x06, 0x0A, 0x00, 0x10, 0x00, 0x04,
+  0x00, 0x18, 0x84, 0x00, 0x02, 0x00, 0x00, 0x06, 0x82, 0x00, 0x0B, 0x39, 0xC0, 0x00, 0x00, 0x30,
+  0xC0, 0x10, 0x80, 0x06, 0x00, 0x19, 0x80, 0x8D, 0x00, 0x85, 0x00, 0x00, 0x04, 0x84, 0x00, 0x03,
+  0x3B, 0x80, 0x3B, 0x80, 0x83, 0x00, 0x00, 0x04, 0x8A, 0x00, 0x91, 0x00, 0x06, 0x06, 0x00, 0x02,
+  0x00, 0x08, 0x00, 0x04, 0x82, 0x00, 0x00, 0x08, 0x82, 0x00, 0x8B, 0x00, 0x03, 0x3F, 0x80, 0x3F,
+  0x80, 0x8F, 0x00, 0x91, 0x00, 0x00, 0x0C, 0x82, 0x00, 0x00, 0x0C, 0x88, 0x00, 0x0E, 0x00, 0xC0,
+  0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x05, 0x00, 0x0A, 0x82, 0x00, 0x00,
+  0x14, 0x82, 0x00, 0x00, 0x28, 0x82, 0x00, 0x00, 0x30, 0x84, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00,
+  0x15, 0x00, 0x2A, 0x80, 0x89, 0x00, 0x04, 0x2A, 0x80, 0x15, 0x00, 0x0E, 0x88, 0x00, 0x06, 0x00,
+  0x00, 0x06, 0x00, 0x38, 0x00, 0x38, 0x8C, 0x00, 0x03, 0x39, 0xC0, 0x3F, 0xC0, 0x87, 0x00, 0x06,
+  0x00, 0x00, 0x0F, 0x00, 0x16, 0x80, 0x28, 0x82, 0x00, 0x0D, 0x32, 0x80, 0x05, 0x00, 0x0A, 0x00,
+  0x14, 0x00, 0x28, 0x00, 0x0F, 0x80, 0x3F, 0x80, 0x87, 0x00, 0x0E, 0x00, 0x00, 0x3F, 0x00, 0x5E,
+  0x80, 0x60, 0x00, 0x02, 0x80, 0x1C, 0x00, 0x1C, 0x80, 0x02, 0x82, 0x00, 0x04, 0x60, 0x00, 0x5E,
+  0x80, 0x3F, 0x88, 0x00, 0x02, 0x00, 0x00, 0x07, 0x82, 0x00, 0x11, 0x08, 0x00, 0x04, 0x00, 0x10,
+  0x00, 0x08, 0x00, 0x20, 0x00, 0x0C, 0x80, 0x3C, 0x80, 0x0C, 0x80, 0x0F, 0x80, 0x87, 0x00, 0x05,
+  0x00, 0x00, 0x1F, 0x80, 0x07, 0x80, 0x83, 0x00, 0x04, 0x07, 0x00, 0x0E, 0x80, 0x10, 0x82, 0x00,
+  0x04, 0x20, 0x00, 0x3E, 0x80, 0x1F, 0x88, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x80, 0x1B, 0x80, 0x04,
+  0x00, 0x28, 0x00, 0x07, 0x00, 0x0E, 0x80, 0x08, 0x82, 0x00, 0x04, 0x28, 0x00, 0x16, 0x80, 0x0F,
+  0x88, 0x00, 0x08, 0x00, 0x00, 0x7F, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x05, 0x86, 0x00, 0x00, 0x0A,
+  0x84, 0x00, 0x00, 0x0C, 0x88, 0x00, 0x05, 0x00, 0x00, 0x1F, 0x00, 0x2E, 0x80, 0x83, 0x00, 0x03,
+  0x2E, 0x80, 0x2E, 0x80, 0x85, 0x00, 0x02, 0x2E, 0x80, 0x1F, 0x88, 0x00, 0x16, 0x00, 0x00, 0x1E,
+  0x00, 0x2D, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x2E, 0x00, 0x1C, 0x00, 0x02, 0x80, 0x04,
+  0x00, 0x3B, 0x00, 0x3C, 0x88, 0x00, 0x87, 0x00, 0x00, 0x0C, 0x82, 0x00, 0x00, 0x0C, 0x84, 0x00,
+  0x00, 0x0C, 0x82, 0x00, 0x00, 0x0C, 0x88, 0x00, 0x87, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03,
+  0x84, 0x00, 0x04, 0x06, 0x00, 0x02, 0x00, 0x0C, 0x82, 0x00, 0x00, 0x08, 0x84, 0x00, 0x84, 0x00,
+  0x12, 0xC0, 0x03, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x78, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x07, 0x00,
+  0x03, 0xC0, 0x00, 0xC0, 0x87, 0x00, 0x89, 0x00, 0x07, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F,
+  0xC0, 0x8D, 0x00, 0x83, 0x00, 0x12, 0x60, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x03, 0xC0,
+  0x03, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x78, 0x00, 0x60, 0x88, 0x00, 0x83, 0x00, 0x0A, 0x1F, 0x00,
+  0x2E, 0x80, 0x00, 0x00, 0x30, 0x00, 0x06, 0x80, 0x0B, 0x82, 0x00, 0x04, 0x0C, 0x00, 0x0C, 0x00,
+  0x0C, 0x88, 0x00, 0x06, 0x00, 0x00, 0x0E, 0x00, 0x1F, 0x00, 0x30, 0x82, 0x00, 0x02, 0x06, 0x00,
+  0x0E, 0x82, 0x00, 0x08, 0x0E, 0x00, 0x07, 0x00, 0x31, 0x00, 0x1F, 0x00, 0x0E, 0x86, 0x00, 0x83,
+  0x00, 0x13, 0x3F, 0x00, 0x30, 0x00, 0x06, 0x00, 0x10, 0x80, 0x00, 0x00, 0x06, 0x00, 0x2F, 0x40,
+  0x00, 0x00, 0x49, 0x20, 0x79, 0xE0, 0x87, 0x00, 0x83, 0x00, 0x03, 0x7F, 0x00, 0x4E, 0x80, 0x83,
+  0x00, 0x03, 0x0E, 0x80, 0x0E, 0x80, 0x83, 0x00, 0x02, 0x4E, 0x80, 0x7F, 0x88, 0x00, 0x83, 0x00,
+  0x07, 0x1F, 0x40, 0x2F, 0x80, 0x50, 0x80, 0x00, 0x40, 0x84, 0x00, 0x05, 0x40, 0x50, 0xC0, 0x2F,
+  0x80, 0x1F, 0x88, 0x00, 0x83, 0x00, 0x05, 0x7F, 0x00, 0x4E, 0x80, 0x01, 0x40, 0x87, 0x00, 0x04,
+  0x01, 0x40, 0x4E, 0x80, 0x7F, 0x88, 0x00, 0x83, 0x00, 0x02, 0x7F, 0x80, 0x4F, 0x82, 0x00, 0x0D,
+  0x02, 0x80, 0x0C, 0x00, 0x0C, 0x00, 0x02, 0x80, 0x00, 0x00, 0x4F, 0x00, 0x7F, 0x80, 0x87, 0x00,
+  0x83, 0x00, 0x0C, 0x7F, 0xC0, 0x4F, 0x80, 0x00, 0x00, 0x02, 0x40, 0x0C, 0x00, 0x0C, 0x00, 0x02,
+  0x82, 0x00, 0x02, 0x4C, 0x00, 0x7C, 0x88, 0x00, 0x83, 0x00, 0x12, 0x1E, 0x80, 0x2F, 0x00, 0x51,
+  0x00, 0x00, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x06, 0x40, 0x50, 0x00, 0x2E, 0x80, 0x1F, 0x88, 0x00,
+  0x83, 0x00, 0x03, 0x7B, 0xC0, 0x4A, 0x40, 0x83, 0x00, 0x02, 0x0E, 0x00, 0x0E, 0x84, 0x00, 0x03,
+  0x4A, 0x40, 0x7B, 0xC0, 0x87, 0x00, 0x83, 0x00, 0x03, 0x3F, 0xC0, 0x39, 0xC0, 0x8B, 0x00, 0x03,
+  0x39, 0xC0, 0x3F, 0xC0, 0x87, 0x00, 0x83, 0x00, 0x03, 0x1F, 0xC0, 0x1C, 0xC0, 0x85, 0x00, 0x00,
+  0x60, 0x84, 0x00, 0x02, 0x5D, 0x00, 0x3E, 0x88, 0x00, 0x83, 0x00, 0x13, 0x7B, 0xC0, 0x4A, 0x40,
+  0x02, 0x80, 0x05, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x0D, 0x00, 0x02, 0x80, 0x48, 0x40, 0x79, 0xC0,
+  0x87, 0x00, 0x83, 0x00, 0x02, 0x7E, 0x00, 0x66, 0x87, 0x00, 0x00, 0x40, 0x83, 0x00, 0x03, 0x67,
+  0x80, 0x7F, 0xC0, 0x87, 0x00, 0x83, 0x00, 0x13, 0xE0, 0xE0, 0x80, 0x20, 0x11, 0x00, 0x0A, 0x00,
+  0x11, 0x00, 0x04, 0x00, 0x0A, 0x00, 0x04, 0x00, 0x9B, 0x20, 0xFB, 0xE0, 0x87, 0x00, 0x83, 0x00,
+  0x13, 0x73, 0xC0, 0x42, 0x40, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02,
+  0x00, 0x48, 0x00, 0x79, 0x80, 0x87, 0x00, 0x83, 0x00, 0x05, 0x1F, 0x00, 0x2E, 0x80, 0x51, 0x40,
+  0x87, 0x00, 0x04, 0x51, 0x40, 0x2E, 0x80, 0x1F, 0x88, 0x00, 0x83, 0x00, 0x03, 0x7F, 0x00, 0x4E,
+  0x80, 0x85, 0x00, 0x02, 0x0E, 0x80, 0x0F, 0x82, 0x00, 0x02, 0x4E, 0x00, 0x7E, 0x88, 0x00, 0x83,
+  0x00, 0x05, 0x1F, 0x00, 0x2E, 0x80, 0x51, 0x40, 0x87, 0x00, 0x09, 0x51, 0x40, 0x2E, 0x80, 0x13,
+  0xC0, 0x13, 0x40, 0x1F, 0x80, 0x83, 0x00, 0x83, 0x00, 0x03, 0x7F, 0x00, 0x4E, 0x80, 0x83, 0x00,
+  0x0B, 0x0F, 0x80, 0x0D, 0x00, 0x02, 0x80, 0x00, 0x00, 0x4D, 0x60, 0x7C, 0xE0, 0x87, 0x00, 0x83,
+  0x00, 0x02, 0x1F, 0x80, 0x2E, 0x82, 0x00, 0x06, 0x09, 0x80, 0x27, 0x00, 0x1C, 0x80, 0x32, 0x82,
+  0x00, 0x02, 0x0E, 0x80, 0x3F, 0x88, 0x00, 0x83, 0x00, 0x02, 0x7F, 0x80, 0x33, 0x84, 0x00, 0x01,
+  0x40, 0x80, 0x85, 0x00, 0x02, 0x33, 0x00, 0x3F, 0x88, 0x00, 0x83, 0x00, 0x03, 0x7B, 0xC0, 0x4A,
+  0x40, 0x8B, 0x00, 0x02, 0x2E, 0x80, 0x1F, 0x88, 0x00, 0x83, 0x00, 0x07, 0x7B, 0xC0, 0x4A, 0x40,
+  0x00, 0x00, 0x2A, 0x80, 0x83, 0x00, 0x02, 0x11, 0x00, 0x04, 0x82, 0x00, 0x00, 0x0E, 0x88, 0x00,
+  0x83, 0x00, 0x06, 0xFB, 0xE0, 0x9B, 0x20, 0x04, 0x00, 0x0A, 0x82, 0x00, 0x02, 0x44, 0x40, 0x11,
+  0x82, 0x00, 0x03, 0x0A, 0x00, 0x31, 0x80, 0x87, 0x00, 0x83, 0x00, 0x06, 0x7B, 0xC0, 0x4A, 0x40,
+  0x2A, 0x80, 0x15, 0x84, 0x00, 0x07, 0x15, 0x00, 0x2A, 0x80, 0x4A, 0x40, 0x7B, 0xC0, 0x87, 0x00,
+  0x83, 0x00, 0x08, 0x79, 0xE0, 0x49, 0x20, 0x29, 0x40, 0x16, 0x80, 0x09, 0x86, 0x00, 0x03, 0x19,
+  0x80, 0x1F, 0x80, 0x87, 0x00, 0x83, 0x00, 0x13, 0x3F, 0x80, 0x1E, 0x00, 0x02, 0x80, 0x25, 0x00,
+  0x02, 0x00, 0x08, 0x00, 0x14, 0x80, 0x28, 0x00, 0x0F, 0x00, 0x3F, 0x80, 0x87, 0x00, 0x05, 0x00,
+  0x00, 0x07, 0x80, 0x01, 0x80, 0x91, 0x00, 0x03, 0x01, 0x80, 0x07, 0x80, 0x83, 0x00, 0x00, 0x30,
+  0x82, 0x00, 0x00, 0x28, 0x82, 0x00, 0x00, 0x14, 0x82, 0x00, 0x02, 0x0A, 0x00, 0x05, 0x82, 0x00,
+  0x05, 0x02, 0x80, 0x00, 0x00, 0x01, 0x40, 0x82, 0x00, 0x00, 0xC0, 0x83, 0x00, 0x04, 0x00, 0x00,
+  0x1E, 0x00, 0x18, 0x92, 0x00, 0x02, 0x18, 0x00, 0x1E, 0x84, 0x00, 0x02, 0x04, 0x00, 0x0E, 0x82,
+  0x00, 0x07, 0x1B, 0x00, 0x31, 0x80, 0x00, 0x00, 0x20, 0x80, 0x91, 0x00, 0x9D, 0x00, 0x01, 0xFF,
+  0xE0, 0x06, 0x08, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x02, 0x98, 0x00, 0x87, 0x00, 0x0F, 0x1F, 0x00,
+  0x1E, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x2E, 0x00, 0x02, 0x00, 0x2E, 0x40, 0x1D, 0xC0, 0x87, 0x00,
+  0x04, 0x00, 0x00, 0x70, 0x00, 0x40, 0x82, 0x00, 0x05, 0x07, 0x00, 0x0E, 0x80, 0x09, 0x40, 0x83,
+  0x00, 0x04, 0x09, 0x40, 0x4E, 0x80, 0x77, 0x88, 0x00, 0x87, 0x00, 0x0E, 0x1E, 0x80, 0x2F, 0x00,
+  0x51, 0x00, 0x00, 0x80, 0x00, 0x80, 0x51, 0x00, 0x2E, 0x80, 0x1F, 0x88, 0x00, 0x04, 0x00, 0x00,
+  0x03, 0x80, 0x02, 0x82, 0x00, 0x04, 0x1C, 0x00, 0x2E, 0x00, 0x52, 0x84, 0x00, 0x05, 0x52, 0x00,
+  0x2E, 0x40, 0x1D, 0xC0, 0x87, 0x00, 0x87, 0x00, 0x0F, 0x1F, 0x00, 0x2E, 0x80, 0x51, 0x40, 0x1F,
+  0x00, 0x1F, 0xC0, 0x50, 0xC0, 0x2F, 0x40, 0x1F, 0x80, 0x87, 0x00, 0x0B, 0x00, 0x00, 0x07, 0xE0,
+  0x0B, 0xE0, 0x00, 0x00, 0x33, 0x80, 0x33, 0x80, 0x87, 0x00, 0x03, 0x33, 0x80, 0x3F, 0x80, 0x87,
+  0x00, 0x87, 0x00, 0x04, 0x1D, 0xC0, 0x2E, 0x40, 0x52, 0x84, 0x00, 0x04, 0x52, 0x00, 0x2E, 0x00,
+  0x1C, 0x82, 0x00, 0x02, 0x1E, 0x80, 0x1F, 0x82, 0x00, 0x04, 0x00, 0x00, 0x70, 0x00, 0x40, 0x82,
+  0x00, 0x04, 0x07, 0x00, 0x0E, 0x80, 0x08, 0x86, 0x00, 0x03, 0x4A, 0x40, 0x7B, 0xC0, 0x87, 0x00,
+  0x02, 0x00, 0x00, 0x06, 0x82, 0x00, 0x04, 0x06, 0x00, 0x1E, 0x00, 0x18, 0x88, 0x00, 0x03, 0x39,
+  0xC0, 0x3F, 0xC0, 0x87, 0x00, 0x02, 0x00, 0x00, 0x06, 0x82, 0x00, 0x04, 0x06, 0x00, 0x3F, 0x00,
+  0x3C, 0x8E, 0x00, 0x02, 0x3D, 0x00, 0x3E, 0x82, 0x00, 0x04, 0x00, 0x00, 0x70, 0x00, 0x40, 0x82,
+  0x00, 0x04, 0x07, 0x80, 0x01, 0x80, 0x0A, 0x82, 0x00, 0x07, 0x0A, 0x00, 0x05, 0x00, 0x44, 0xC0,
+  0x77, 0xC0, 0x87, 0x00, 0x04, 0x00, 0x00, 0x1E, 0x00, 0x18, 0x8E, 0x00, 0x03, 0x39, 0xC0, 0x3F,
+  0xC0, 0x87, 0x00, 0x87, 0x00, 0x03, 0x7F, 0x80, 0x49, 0x40, 0x87, 0x00, 0x03, 0x40, 0x20, 0x76,
+  0xE0, 0x87, 0x00, 0x87, 0x00, 0x04, 0x77, 0x00, 0x4E, 0x80, 0x08, 0x86, 0x00, 0x03, 0x4A, 0x40,
+  0x7B, 0xC0, 0x87, 0x00, 0x87, 0x00, 0x05, 0x1F, 0x00, 0x2E, 0x80, 0x51, 0x40, 0x83, 0x00, 0x04,
+  0x51, 0x40, 0x2E, 0x80, 0x1F, 0x88, 0x00, 0x87, 0x00, 0x05, 0x77, 0x00, 0x4E, 0x80, 0x09, 0x40,
+  0x83, 0x00, 0x04, 0x09, 0x40, 0x0E, 0x80, 0x07, 0x82, 0x00, 0x02, 0x4C, 0x00, 0x7C, 0x82, 0x00,
+  0x87, 0x00, 0x04, 0x1D, 0xC0, 0x2E, 0x40, 0x52, 0x84, 0x00, 0x04, 0x52, 0x00, 0x2E, 0x00, 0x1C,
+  0x82, 0x00, 0x05, 0x06, 0x40, 0x07, 0xC0, 0x00, 0x00, 0x87, 0x00, 0x05, 0x7B, 0x80, 0x67, 0x40,
+  0x04, 0xC0, 0x85, 0x00, 0x02, 0x67, 0x00, 0x7F, 0x88, 0x00, 0x87, 0x00, 0x0E, 0x1F, 0x80, 0x2E,
+  0x00, 0x0D, 0x80, 0x23, 0x00, 0x1C, 0x80, 0x32, 0x00, 0x0E, 0x80, 0x3F, 0x88, 0x00, 0x02, 0x00,
+  0x00, 0x18, 0x84, 0x00, 0x02, 0x67, 0x00, 0x67, 0x87, 0x00, 0x03, 0x80, 0x17, 0x80, 0x0F, 0x88,
+  0x00, 0x87, 0x00, 0x02, 0x73, 0x80, 0x42, 0x86, 0x00, 0x05, 0x02, 0x00, 0x2E, 0x40, 0x1D, 0xC0,
+  0x87, 0x00, 0x87, 0x00, 0x0A, 0x7B, 0xC0, 0x4A, 0x40, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x15,
+  0x82, 0x00, 0x00, 0x0E, 0x88, 0x00, 0x87, 0x00, 0x0F, 0xF1, 0xE0, 0x91, 0x20, 0x04, 0x00, 0x0A,
+  0x00, 0x55, 0x40, 0x00, 0x00, 0x0A, 0x00, 0x31, 0x80, 0x87, 0x00, 0x87, 0x00, 0x04, 0x7B, 0xC0,
+  0x60, 0xC0, 0x15, 0x84, 0x00, 0x05, 0x15, 0x00, 0x60, 0xC0, 0x7B, 0xC0, 0x87, 0x00, 0x87, 0x00,
+  0x0C, 0x79, 0xE0, 0x49, 0x20, 0x29, 0x40, 0x00, 0x00, 0x12, 0x80, 0x04, 0x00, 0x09, 0x82, 0x00,
+  0x04, 0x0A, 0x00, 0x32, 0x00, 0x3E, 0x82, 0x00, 0x87, 0x00, 0x0F, 0x3F, 0x80, 0x1E, 0x00, 0x22,
+  0x80, 0x0D, 0x00, 0x16, 0x00, 0x28, 0x80, 0x0F, 0x00, 0x3F, 0x80, 0x87, 0x00, 0x04, 0x00, 0x00,
+  0x06, 0x00, 0x0A, 0x88, 0x00, 0x02, 0x14, 0x00, 0x14, 0x86, 0x00, 0x02, 0x0A, 0x00, 0x06, 0x84,
+  0x00, 0x02, 0x00, 0x00, 0x06, 0x96, 0x00, 0x00, 0x06, 0x84, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00,
+  0x0A, 0x88, 0x00, 0x02, 0x05, 0x00, 0x05, 0x86, 0x00, 0x02, 0x0A, 0x00, 0x0C, 0x84, 0x00, 0x89,
+  0x00, 0x06, 0x18, 0x00, 0x3C, 0x80, 0x27, 0x80, 0x03, 0x8E, 0x00,
+};
+
+static const uint16_t Font16_Rle_Index[] =
+{
+  0, 2, 16, 32, 54, 84, 111, 134, 148, 174, 196, 217,
+  234, 250, 259, 269, 299, 318, 335, 362, 388, 415, 440, 466,
+  486, 508, 534, 552, 574, 598, 611, 635, 659, 687, 712, 734,
+  756, 775, 800, 824, 848, 870, 886, 905, 930, 949, 974, 999,
+  1018, 1039, 1063, 1087, 1111, 1130, 1145, 1168, 1193, 1216, 1237, 1262,
+  1278, 1309, 1323, 1340, 1345, 1355, 1376, 1401, 1421, 1446, 1467, 1489,
+  1513, 1536, 1557, 1577, 1604, 1619, 1635, 1652, 1671, 1696, 1721, 1738,
+  1758, 1777, 1794, 1814, 1835, 1854, 1880, 1901, 1921, 1931, 1951,
+};
+
+sFONT Font16 = {
+  Font16_Rle_Table,
+  11, /* Width */
+  16, /* Height */
+  Font16_Rle_Index,
+};
+
+#endif /* FONTS_COMPRESSED */
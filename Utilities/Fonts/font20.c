@@ -38,6 +38,9 @@
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
+/* packed copy in font20_rle.c, see fontpack.py */
+#if !defined(FONTS_COMPRESSED)
+
 // Character bitmaps for Courier New 15pt
 const uint8_t Font20_Table[] = 
 {
@@ -2139,5 +2142,7 @@ sFONT Font20 = {
   20, /* Height */
 };
 
+#endif /* FONTS_COMPRESSED */
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
@@ -0,0 +1,184 @@
+/* Generated by fontpack.py from font20.c, do not edit. */
+#include "fonts.h"
+
+#if defined(FONTS_COMPRESSED)
+
+/* 2654 bytes, 3800 bytes as raw bitmaps */
+static const uint8_t Font20_Rle_Table[] =
+{
+  0xA7, 0x00, 0x02, 0x00, 0x00, 0x07, 0x8C, 0x00, 0x00, 0x05, 0x82, 0x00, 0x00, 0x02, 0x82, 0x00,
+  0x00, 0x07, 0x82, 0x00, 0x00, 0x07, 0x8A, 0x00, 0x83, 0x00, 0x01, 0x1C, 0xE0, 0x83, 0x00, 0x01,
+  0x14, 0xA0, 0x83, 0x00, 0x01, 0x08, 0x40, 0x95, 0x00, 0x01, 0x0C, 0xC0, 0x87, 0x00, 0x0D, 0x33,
+  0x30, 0x00, 0x00, 0x33, 0x30, 0x00, 0x00, 0x33, 0x30, 0x00, 0x00, 0x33, 0x30, 0x87, 0x00, 0x01,
+  0x0C, 0xC0, 0x85, 0x00, 0x00, 0x03, 0x82, 0x00, 0x17, 0x04, 0xE0, 0x08, 0x00, 0x17, 0x80, 0x00,
+  0x60, 0x07, 0x00, 0x10, 0xC0, 0x0F, 0x20, 0x18, 0x80, 0x00, 0x00, 0x07, 0xA0, 0x00, 0x40, 0x1C,
+  0x80, 0x83, 0x00, 0x00, 0x03, 0x86, 0x00, 0x04, 0x00, 0x00, 0x1C, 0x00, 0x3E, 0x84, 0x00, 0x0B,
+  0x3E, 0x60, 0x1D, 0x80, 0x0E, 0x60, 0x33, 0x80, 0x0D, 0xC0, 0x33, 0xE0, 0x83, 0x00, 0x03, 0x03,
+  0xE0, 0x01, 0xC0, 0x89, 0x00, 0x85, 0x00, 0x17, 0x03, 0xE0, 0x0C, 0x00, 0x03, 0xE0, 0x00, 0x00,
+  0x0A, 0x00, 0x09, 0x30, 0x10, 0xC0, 0x06, 0x10, 0x01, 0x20, 0x07, 0x30, 0x18, 0x40, 0x07, 0xB0,
+  0x89, 0x00, 0x83, 0x00, 0x01, 0x03, 0x80, 0x83, 0x00, 0x01, 0x02, 0x80, 0x83, 0x00, 0x00, 0x01,
+  0x96, 0x00, 0x82, 0x00, 0x04, 0xC0, 0x00, 0x00, 0x01, 0x40, 0x83, 0x00, 0x01, 0x02, 0x80, 0x89,
+  0x00, 0x01, 0x02, 0x80, 0x83, 0x00, 0x01, 0x01, 0x40, 0x82, 0x00, 0x00, 0xC0, 0x83, 0x00, 0x02,
+  0x00, 0x00, 0x0C, 0x82, 0x00, 0x00, 0x0A, 0x84, 0x00, 0x00, 0x05, 0x8A, 0x00, 0x00, 0x05, 0x84,
+  0x00, 0x00, 0x0A, 0x82, 0x00, 0x00, 0x0C, 0x84, 0x00, 0x02, 0x00, 0x00, 0x03, 0x84, 0x00, 0x0D,
+  0x18, 0x60, 0x04, 0x80, 0x18, 0x60, 0x00, 0x00, 0x08, 0x40, 0x03, 0x00, 0x0C, 0xC0, 0x91, 0x00,
+  0x85, 0x00, 0x00, 0x03, 0x86, 0x00, 0x05, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x85, 0x00, 0x00,
+  0x03, 0x8C, 0x00, 0x95, 0x00, 0x06, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x05, 0x82, 0x00, 0x02,
+  0x02, 0x00, 0x04, 0x84, 0x00, 0x8D, 0x00, 0x05, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x93, 0x00,
+  0x95, 0x00, 0x01, 0x03, 0x80, 0x83, 0x00, 0x01, 0x03, 0x80, 0x89, 0x00, 0x01, 0x00, 0x60, 0x82,
+  0x00, 0x00, 0xA0, 0x83, 0x00, 0x08, 0x01, 0x40, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x05, 0x82,
+  0x00, 0x00, 0x0A, 0x84, 0x00, 0x00, 0x14, 0x82, 0x00, 0x00, 0x18, 0x86, 0x00, 0x09, 0x00, 0x00,
+  0x0F, 0x80, 0x10, 0x40, 0x07, 0x00, 0x28, 0xA0, 0x8B, 0x00, 0x07, 0x28, 0xA0, 0x07, 0x00, 0x10,
+  0x40, 0x0F, 0x80, 0x89, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x1C, 0x82, 0x00, 0x00, 0x1C, 0x8E,
+  0x00, 0x05, 0x1C, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x89, 0x00, 0x1D, 0x00, 0x00, 0x0F, 0x80, 0x10,
+  0x40, 0x27, 0x20, 0x08, 0x80, 0x30, 0x00, 0x00, 0xA0, 0x01, 0x40, 0x02, 0x80, 0x05, 0x00, 0x0A,
+  0x00, 0x14, 0x00, 0x27, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x89, 0x00, 0x1D, 0x00, 0x00, 0x0F, 0x80,
+  0x30, 0x40, 0x0F, 0x20, 0x30, 0x80, 0x00, 0x80, 0x07, 0x20, 0x00, 0x00, 0x07, 0x20, 0x00, 0x80,
+  0x00, 0x00, 0x60, 0x80, 0x1F, 0x20, 0x40, 0x40, 0x3F, 0x80, 0x89, 0x00, 0x04, 0x00, 0x00, 0x01,
+  0xC0, 0x02, 0x82, 0x00, 0x02, 0x05, 0x00, 0x0A, 0x82, 0x00, 0x0F, 0x14, 0x00, 0x28, 0x00, 0x0F,
+  0x20, 0x00, 0x00, 0x3F, 0x20, 0x03, 0x20, 0x00, 0x00, 0x03, 0xE0, 0x89, 0x00, 0x11, 0x00, 0x00,
+  0x1F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x40, 0x07, 0x20, 0x18, 0x80,
+  0x83, 0x00, 0x07, 0x30, 0x80, 0x0F, 0x20, 0x20, 0x40, 0x1F, 0x80, 0x89, 0x00, 0x1D, 0x00, 0x00,
+  0x03, 0xE0, 0x0C, 0x00, 0x11, 0xE0, 0x06, 0x00, 0x20, 0x00, 0x0F, 0x80, 0x08, 0x40, 0x07, 0x20,
+  0x08, 0x80, 0x00, 0x00, 0x28, 0x80, 0x07, 0x20, 0x18, 0x40, 0x07, 0x80, 0x89, 0x00, 0x0B, 0x00,
+  0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x30, 0x00, 0x00, 0xA0, 0x83, 0x00, 0x01, 0x01, 0x40,
+  0x83, 0x00, 0x01, 0x02, 0x80, 0x83, 0x00, 0x00, 0x03, 0x8A, 0x00, 0x1D, 0x00, 0x00, 0x0F, 0x80,
+  0x10, 0x40, 0x27, 0x20, 0x08, 0x80, 0x08, 0x80, 0x27, 0x20, 0x00, 0x00, 0x27, 0x20, 0x08, 0x80,
+  0x00, 0x00, 0x08, 0x80, 0x27, 0x20, 0x10, 0x40, 0x0F, 0x80, 0x89, 0x00, 0x1C, 0x00, 0x00, 0x0F,
+  0x00, 0x10, 0xC0, 0x27, 0x00, 0x08, 0xA0, 0x00, 0x00, 0x08, 0x80, 0x27, 0x00, 0x10, 0x80, 0x0F,
+  0x80, 0x00, 0x20, 0x03, 0x00, 0x3C, 0x40, 0x01, 0x80, 0x3E, 0x8A, 0x00, 0x89, 0x00, 0x01, 0x03,
+  0x80, 0x83, 0x00, 0x01, 0x03, 0x80, 0x83, 0x00, 0x01, 0x03, 0x80, 0x83, 0x00, 0x01, 0x03, 0x80,
+  0x89, 0x00, 0x89, 0x00, 0x01, 0x01, 0xC0, 0x83, 0x00, 0x01, 0x01, 0xC0, 0x83, 0x00, 0x04, 0x03,
+  0x80, 0x00, 0x80, 0x05, 0x82, 0x00, 0x02, 0x02, 0x00, 0x04, 0x86, 0x00, 0x86, 0x00, 0x16, 0x30,
+  0x00, 0xC0, 0x03, 0x30, 0x04, 0xC0, 0x1B, 0x00, 0x64, 0x00, 0x64, 0x00, 0x1B, 0x00, 0x04, 0xC0,
+  0x03, 0x30, 0x00, 0xC0, 0x00, 0x30, 0x89, 0x00, 0x89, 0x00, 0x0D, 0x7F, 0xF0, 0x00, 0x00, 0x7F,
+  0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x8F, 0x00, 0x85, 0x00, 0x16, 0x30, 0x00,
+  0x0C, 0x00, 0x33, 0x00, 0x0C, 0x80, 0x03, 0x60, 0x00, 0x98, 0x00, 0x98, 0x03, 0x60, 0x0C, 0x80,
+  0x33, 0x00, 0x0C, 0x00, 0x30, 0x8A, 0x00, 0x83, 0x00, 0x10, 0x0F, 0x80, 0x10, 0x40, 0x07, 0xA0,
+  0x00, 0x00, 0x18, 0x00, 0x01, 0xA0, 0x02, 0x40, 0x00, 0x80, 0x03, 0x82, 0x00, 0x00, 0x07, 0x82,
+  0x00, 0x00, 0x07, 0x8A, 0x00, 0x08, 0x00, 0x00, 0x03, 0x80, 0x0F, 0x00, 0x04, 0xC0, 0x18, 0x82,
+  0x00, 0x03, 0x01, 0x80, 0x03, 0x80, 0x83, 0x00, 0x0B, 0x03, 0x80, 0x01, 0xC0, 0x18, 0x00, 0x00,
+  0x40, 0x0F, 0xC0, 0x07, 0x80, 0x87, 0x00, 0x83, 0x00, 0x19, 0x1F, 0x80, 0x00, 0x00, 0x1C, 0x00,
+  0x05, 0x40, 0x00, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x13, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0x48, 0x48,
+  0x00, 0x00, 0x78, 0x78, 0x89, 0x00, 0x83, 0x00, 0x05, 0x3F, 0x80, 0x00, 0x40, 0x27, 0xA0, 0x82,
+  0x00, 0x10, 0x80, 0x07, 0x20, 0x00, 0x20, 0x07, 0x90, 0x00, 0x40, 0x00, 0x00, 0x27, 0xC0, 0x00,
+  0x10, 0x3F, 0xE0, 0x89, 0x00, 0x83, 0x00, 0x09, 0x07, 0xB0, 0x08, 0x40, 0x13, 0x80, 0x24, 0x40,
+  0x08, 0x30, 0x85, 0x00, 0x09, 0x08, 0x30, 0x24, 0x40, 0x13, 0x90, 0x08, 0x20, 0x07, 0xC0, 0x89,
+  0x00, 0x83, 0x00, 0x09, 0x7F, 0x80, 0x00, 0x40, 0x4F, 0x20, 0x00, 0x90, 0x00, 0x40, 0x86, 0x00,
+  0x08, 0x40, 0x00, 0x90, 0x4F, 0x20, 0x00, 0x40, 0x7F, 0x80, 0x89, 0x00, 0x83, 0x00, 0x0A, 0x3F,
+  0xF0, 0x00, 0x00, 0x27, 0xC0, 0x00, 0x00, 0x01, 0xB0, 0x06, 0x82, 0x00, 0x0B, 0x06, 0x00, 0x01,
+  0xB0, 0x00, 0x00, 0x27, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x89, 0x00, 0x83, 0x00, 0x0A, 0x3F, 0xF0,
+  0x00, 0x00, 0x27, 0xC0, 0x00, 0x00, 0x01, 0xB0, 0x06, 0x82, 0x00, 0x06, 0x06, 0x00, 0x01, 0x80,
+  0x00, 0x00, 0x27, 0x82, 0x00, 0x00, 0x3F, 0x8A, 0x00, 0x83, 0x00, 0x19, 0x07, 0xB0, 0x18, 0x40,
+  0x07, 0x80, 0x28, 0x40, 0x00, 0x30, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xC8, 0x28, 0x00,
+  0x07, 0xC0, 0x18, 0x30, 0x07, 0xC0, 0x89, 0x00, 0x83, 0x00, 0x05, 0x3C, 0xF0, 0x00, 0x00, 0x24,
+  0x90, 0x83, 0x00, 0x05, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x83, 0x00, 0x05, 0x24, 0x90, 0x00,
+  0x00, 0x3C, 0xF0, 0x89, 0x00, 0x83, 0x00, 0x05, 0x1F, 0xE0, 0x00, 0x00, 0x1C, 0xE0, 0x8D, 0x00,
+  0x05, 0x1C, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x89, 0x00, 0x83, 0x00, 0x05, 0x03, 0xF8, 0x00, 0x00,
+  0x03, 0x98, 0x85, 0x00, 0x00, 0x30, 0x85, 0x00, 0x06, 0x80, 0x0F, 0x20, 0x30, 0x40, 0x0F, 0x80,
+  0x89, 0x00, 0x83, 0x00, 0x0F, 0x3E, 0xF8, 0x00, 0x00, 0x26, 0x18, 0x01, 0x60, 0x02, 0x80, 0x04,
+  0x00, 0x02, 0x80, 0x05, 0x40, 0x82, 0x00, 0x06, 0xA0, 0x26, 0x18, 0x00, 0x40, 0x3E, 0x38, 0x89,
+  0x00, 0x83, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x00, 0x33, 0x89, 0x00, 0x00, 0x30, 0x83, 0x00, 0x05,
+  0x33, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x89, 0x00, 0x83, 0x00, 0x0A, 0x78, 0x78, 0x00, 0x00, 0x40,
+  0x08, 0x04, 0x80, 0x08, 0x40, 0x03, 0x82, 0x00, 0x0B, 0x04, 0x80, 0x00, 0x00, 0x03, 0x00, 0x4C,
+  0xC8, 0x00, 0x00, 0x7C, 0xF8, 0x89, 0x00, 0x83, 0x00, 0x06, 0x39, 0xF0, 0x04, 0x00, 0x21, 0x90,
+  0x02, 0x82, 0x00, 0x00, 0x05, 0x82, 0x00, 0x0B, 0x02, 0x80, 0x00, 0x00, 0x01, 0x00, 0x26, 0x00,
+  0x00, 0x80, 0x3E, 0x60, 0x89, 0x00, 0x83, 0x00, 0x09, 0x07, 0x80, 0x08, 0x40, 0x13, 0x20, 0x24,
+  0x90, 0x08, 0x40, 0x85, 0x00, 0x09, 0x08, 0x40, 0x24, 0x90, 0x13, 0x20, 0x08, 0x40, 0x07, 0x80,
+  0x89, 0x00, 0x83, 0x00, 0x07, 0x3F, 0xC0, 0x00, 0x20, 0x27, 0x90, 0x00, 0x40, 0x82, 0x00, 0x09,
+  0x40, 0x07, 0x90, 0x00, 0x20, 0x07, 0xC0, 0x00, 0x00, 0x27, 0x82, 0x00, 0x00, 0x3F, 0x8A, 0x00,
+  0x83, 0x00, 0x09, 0x07, 0x80, 0x08, 0x40, 0x13, 0x20, 0x24, 0x90, 0x08, 0x40, 0x85, 0x00, 0x0F,
+  0x08, 0x40, 0x24, 0x90, 0x13, 0x20, 0x08, 0x40, 0x00, 0x30, 0x08, 0x40, 0x03, 0x10, 0x0C, 0xE0,
+  0x83, 0x00, 0x83, 0x00, 0x19, 0x3F, 0xC0, 0x00, 0x20, 0x27, 0x90, 0x00, 0x40, 0x00, 0x40, 0x07,
+  0x90, 0x00, 0x20, 0x07, 0x20, 0x00, 0x80, 0x00, 0x10, 0x26, 0x48, 0x00, 0x20, 0x3E, 0x18, 0x89,
+  0x00, 0x83, 0x00, 0x19, 0x0F, 0xB0, 0x10, 0x40, 0x27, 0x80, 0x08, 0x40, 0x08, 0x30, 0x27, 0x80,
+  0x18, 0x60, 0x07, 0x90, 0x30, 0x40, 0x08, 0x40, 0x07, 0x90, 0x08, 0x20, 0x37, 0xC0, 0x89, 0x00,
+  0x83, 0x00, 0x05, 0x3F, 0xF0, 0x00, 0x00, 0x0C, 0xC0, 0x83, 0x00, 0x01, 0x30, 0x30, 0x87, 0x00,
+  0x05, 0x0C, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x89, 0x00, 0x83, 0x00, 0x05, 0x3C, 0xF0, 0x00, 0x00,
+  0x24, 0x90, 0x8B, 0x00, 0x07, 0x04, 0x80, 0x13, 0x20, 0x08, 0x40, 0x07, 0x80, 0x89, 0x00, 0x83,
+  0x00, 0x0D, 0x78, 0xF0, 0x00, 0x00, 0x48, 0x90, 0x00, 0x00, 0x28, 0xA0, 0x00, 0x00, 0x15, 0x40,
+  0x83, 0x00, 0x01, 0x0A, 0x80, 0x83, 0x00, 0x00, 0x07, 0x8A, 0x00, 0x83, 0x00, 0x07, 0x7C, 0x7C,
+  0x00, 0x00, 0x4C, 0x64, 0x03, 0x80, 0x83, 0x00, 0x05, 0x05, 0x40, 0x20, 0x08, 0x0A, 0xA0, 0x83,
+  0x00, 0x03, 0x04, 0x40, 0x18, 0x30, 0x89, 0x00, 0x83, 0x00, 0x19, 0x78, 0xF0, 0x00, 0x00, 0x48,
+  0x90, 0x28, 0xA0, 0x15, 0x40, 0x0A, 0x80, 0x00, 0x00, 0x0A, 0x80, 0x15, 0x40, 0x28, 0xA0, 0x48,
+  0x90, 0x00, 0x00, 0x78, 0xF0, 0x89, 0x00, 0x83, 0x00, 0x0D, 0x3C, 0xF0, 0x00, 0x00, 0x24, 0x90,
+  0x14, 0xA0, 0x0B, 0x40, 0x00, 0x00, 0x04, 0x80, 0x85, 0x00, 0x05, 0x0C, 0xC0, 0x00, 0x00, 0x0F,
+  0xC0, 0x89, 0x00, 0x83, 0x00, 0x19, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0xA0, 0x19, 0x40,
+  0x02, 0x80, 0x00, 0x00, 0x05, 0x00, 0x0A, 0x60, 0x14, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1F, 0xE0,
+  0x89, 0x00, 0x03, 0x00, 0x00, 0x03, 0xC0, 0x82, 0x00, 0x00, 0xC0, 0x96, 0x00, 0x04, 0xC0, 0x00,
+  0x00, 0x03, 0xC0, 0x83, 0x00, 0x00, 0x18, 0x82, 0x00, 0x00, 0x14, 0x84, 0x00, 0x00, 0x0A, 0x82,
+  0x00, 0x00, 0x05, 0x82, 0x00, 0x05, 0x02, 0x80, 0x00, 0x00, 0x01, 0x40, 0x84, 0x00, 0x00, 0xA0,
+  0x82, 0x00, 0x00, 0x60, 0x85, 0x00, 0x02, 0x00, 0x00, 0x0F, 0x82, 0x00, 0x00, 0x0C, 0x96, 0x00,
+  0x00, 0x0C, 0x82, 0x00, 0x00, 0x0F, 0x84, 0x00, 0x0F, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0x0A,
+  0x80, 0x15, 0x40, 0x28, 0xA0, 0x10, 0x40, 0x20, 0x20, 0x97, 0x00, 0xA3, 0x00, 0x03, 0xFF, 0xFC,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x80, 0x9D, 0x00, 0x89,
+  0x00, 0x13, 0x0F, 0xC0, 0x10, 0x20, 0x1F, 0x80, 0x0F, 0x80, 0x10, 0x00, 0x27, 0x80, 0x08, 0x80,
+  0x0F, 0x10, 0x20, 0x80, 0x1F, 0x70, 0x89, 0x00, 0x02, 0x00, 0x00, 0x70, 0x82, 0x00, 0x00, 0x40,
+  0x82, 0x00, 0x07, 0x07, 0x80, 0x08, 0x60, 0x07, 0x80, 0x08, 0x50, 0x83, 0x00, 0x07, 0x08, 0x50,
+  0x47, 0x80, 0x08, 0x60, 0x77, 0x80, 0x89, 0x00, 0x89, 0x00, 0x13, 0x07, 0xB0, 0x18, 0x40, 0x07,
+  0xC0, 0x28, 0x00, 0x00, 0x30, 0x00, 0x00, 0x08, 0x30, 0x27, 0xC0, 0x10, 0x30, 0x0F, 0xC0, 0x89,
+  0x00, 0x82, 0x00, 0x00, 0x70, 0x82, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x07, 0x80, 0x18, 0x40, 0x07,
+  0x80, 0x28, 0x40, 0x83, 0x00, 0x07, 0x08, 0x40, 0x27, 0x88, 0x18, 0x40, 0x07, 0xB8, 0x89, 0x00,
+  0x89, 0x00, 0x13, 0x07, 0x80, 0x18, 0x60, 0x07, 0x80, 0x27, 0x90, 0x00, 0x00, 0x0F, 0xF0, 0x28,
+  0x30, 0x07, 0xC0, 0x18, 0x30, 0x07, 0xC0, 0x89, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xF0, 0x04, 0x00,
+  0x01, 0xF0, 0x00, 0x00, 0x19, 0xE0, 0x00, 0x00, 0x19, 0xE0, 0x87, 0x00, 0x05, 0x19, 0xE0, 0x00,
+  0x00, 0x1F, 0xE0, 0x89, 0x00, 0x89, 0x00, 0x07, 0x07, 0xB8, 0x18, 0x40, 0x07, 0x88, 0x28, 0x40,
+  0x83, 0x00, 0x11, 0x28, 0x40, 0x07, 0x80, 0x18, 0x40, 0x07, 0x80, 0x00, 0x40, 0x0F, 0x90, 0x00,
+  0x20, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x38, 0x82, 0x00, 0x00, 0x20, 0x82, 0x00, 0x06,
+  0x03, 0xC0, 0x04, 0x20, 0x03, 0x80, 0x04, 0x86, 0x00, 0x05, 0x24, 0x90, 0x00, 0x00, 0x3C, 0xF0,
+  0x89, 0x00, 0x02, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x1F, 0x82, 0x00,
+  0x00, 0x1C, 0x88, 0x00, 0x05, 0x1C, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x89, 0x00, 0x02, 0x00, 0x00,
+  0x03, 0x82, 0x00, 0x00, 0x03, 0x82, 0x00, 0x04, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0x8E, 0x00, 0x06,
+  0x01, 0x00, 0x3E, 0x40, 0x00, 0x80, 0x3F, 0x82, 0x00, 0x02, 0x00, 0x00, 0x38, 0x82, 0x00, 0x00,
+  0x20, 0x82, 0x00, 0x01, 0x03, 0xE0, 0x82, 0x00, 0x01, 0xE0, 0x05, 0x82, 0x00, 0x09, 0x05, 0x00,
+  0x02, 0x80, 0x20, 0x70, 0x00, 0x00, 0x39, 0xF0, 0x89, 0x00, 0x02, 0x00, 0x00, 0x1F, 0x82, 0x00,
+  0x00, 0x1C, 0x90, 0x00, 0x05, 0x1C, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x89, 0x00, 0x89, 0x00, 0x05,
+  0x7E, 0xE0, 0x01, 0x10, 0x4C, 0xC0, 0x87, 0x00, 0x05, 0x48, 0x88, 0x00, 0x00, 0x7B, 0xB8, 0x89,
+  0x00, 0x89, 0x00, 0x06, 0x3B, 0xC0, 0x04, 0x20, 0x23, 0x80, 0x04, 0x86, 0x00, 0x05, 0x24, 0x90,
+  0x00, 0x00, 0x3C, 0xF0, 0x89, 0x00, 0x89, 0x00, 0x07, 0x07, 0x80, 0x18, 0x60, 0x07, 0x80, 0x28,
+  0x50, 0x83, 0x00, 0x07, 0x28, 0x50, 0x07, 0x80, 0x18, 0x60, 0x07, 0x80, 0x89, 0x00, 0x89, 0x00,
+  0x07, 0x77, 0x80, 0x08, 0x60, 0x47, 0x80, 0x08, 0x50, 0x83, 0x00, 0x0A, 0x08, 0x50, 0x07, 0x80,
+  0x08, 0x60, 0x07, 0x80, 0x00, 0x00, 0x4C, 0x82, 0x00, 0x00, 0x7C, 0x82, 0x00, 0x89, 0x00, 0x07,
+  0x07, 0xB8, 0x18, 0x40, 0x07, 0x88, 0x28, 0x40, 0x83, 0x00, 0x07, 0x28, 0x40, 0x07, 0x80, 0x18,
+  0x40, 0x07, 0x80, 0x82, 0x00, 0x00, 0xC8, 0x82, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x89, 0x00, 0x08,
+  0x3C, 0xE0, 0x01, 0x10, 0x32, 0xC0, 0x01, 0x30, 0x02, 0x84, 0x00, 0x05, 0x33, 0xC0, 0x00, 0x00,
+  0x3F, 0xC0, 0x89, 0x00, 0x89, 0x00, 0x13, 0x07, 0xE0, 0x18, 0x00, 0x07, 0x80, 0x06, 0x60, 0x11,
+  0xC0, 0x0E, 0x20, 0x19, 0x80, 0x07, 0x80, 0x00, 0x60, 0x1F, 0x80, 0x89, 0x00, 0x83, 0x00, 0x00,
+  0x0C, 0x84, 0x00, 0x05, 0x33, 0xE0, 0x00, 0x00, 0x33, 0xE0, 0x86, 0x00, 0x06, 0x30, 0x03, 0xC0,
+  0x08, 0x30, 0x07, 0xC0, 0x89, 0x00, 0x89, 0x00, 0x05, 0x38, 0xE0, 0x00, 0x00, 0x20, 0x80, 0x86,
+  0x00, 0x06, 0x80, 0x07, 0x10, 0x10, 0x80, 0x0F, 0x70, 0x89, 0x00, 0x89, 0x00, 0x12, 0x78, 0xF0,
+  0x00, 0x00, 0x48, 0x90, 0x28, 0xA0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00,
+  0x07, 0x8A, 0x00, 0x89, 0x00, 0x0E, 0x78, 0xF0, 0x00, 0x00, 0x4A, 0x90, 0x00, 0x00, 0x05, 0x80,
+  0x2A, 0x20, 0x00, 0x00, 0x05, 0x82, 0x00, 0x01, 0x18, 0xC0, 0x89, 0x00, 0x89, 0x00, 0x13, 0x3C,
+  0xF0, 0x00, 0x00, 0x30, 0x30, 0x0B, 0x40, 0x04, 0x80, 0x04, 0x80, 0x0B, 0x40, 0x30, 0x30, 0x00,
+  0x00, 0x3C, 0xF0, 0x89, 0x00, 0x89, 0x00, 0x10, 0x78, 0xF0, 0x00, 0x00, 0x48, 0x90, 0x28, 0xA0,
+  0x00, 0x00, 0x15, 0x40, 0x02, 0x00, 0x08, 0x80, 0x01, 0x82, 0x00, 0x02, 0x0A, 0x00, 0x73, 0x82,
+  0x00, 0x00, 0x7F, 0x82, 0x00, 0x89, 0x00, 0x13, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0x20, 0x19, 0x40,
+  0x02, 0x80, 0x05, 0x00, 0x0A, 0x60, 0x13, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x89, 0x00, 0x07, 0x00,
+  0x00, 0x01, 0xC0, 0x02, 0x00, 0x00, 0xC0, 0x87, 0x00, 0x06, 0x04, 0x00, 0x09, 0x00, 0x09, 0x00,
+  0x04, 0x87, 0x00, 0x04, 0xC0, 0x02, 0x00, 0x01, 0xC0, 0x83, 0x00, 0x02, 0x00, 0x00, 0x03, 0x9E,
+  0x00, 0x00, 0x03, 0x84, 0x00, 0x06, 0x00, 0x00, 0x1C, 0x00, 0x02, 0x00, 0x18, 0x88, 0x00, 0x06,
+  0x01, 0x00, 0x04, 0x80, 0x04, 0x80, 0x01, 0x86, 0x00, 0x04, 0x18, 0x00, 0x02, 0x00, 0x1C, 0x84,
+  0x00, 0x8B, 0x00, 0x09, 0x0E, 0x00, 0x31, 0x30, 0x0C, 0xC0, 0x32, 0x10, 0x01, 0xE0, 0x91, 0x00,
+};
+
+static const uint16_t Font20_Rle_Index[] =
+{
+  0, 2, 24, 41, 68, 103, 133, 162, 178, 207, 233, 256,
+  275, 293, 304, 316, 349, 373, 394, 427, 460, 493, 525, 558,
+  587, 620, 652, 674, 700, 728, 747, 775, 805, 839, 870, 901,
+  929, 956, 987, 1017, 1048, 1077, 1097, 1122, 1153, 1176, 1207, 1238,
+  1266, 1296, 1330, 1361, 1392, 1417, 1439, 1467, 1496, 1527, 1555, 1586,
+  1605, 1638, 1656, 1675, 1682, 1695, 1720, 1752, 1777, 1808, 1833, 1861,
+  1893, 1922, 1949, 1977, 2010, 2029, 2049, 2070, 2094, 2125, 2157, 2180,
+  2205, 2230, 2251, 2275, 2300, 2325, 2357, 2382, 2411, 2421, 2449,
+};
+
+sFONT Font20 = {
+  Font20_Rle_Table,
+  14, /* Width */
+  20, /* Height */
+  Font20_Rle_Index,
+};
+
+#endif /* FONTS_COMPRESSED */
@@ -38,6 +38,9 @@
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
+/* packed copy in font24_rle.c, see fontpack.py */
+#if !defined(FONTS_COMPRESSED)
+
 const uint8_t Font24_Table [] = 
 {
 	// @0 ' ' (17 pixels wide)
@@ -2517,5 +2520,7 @@ sFONT Font24 = {
   24, /* Height */
 };
 
+#endif /* FONTS_COMPRESSED */
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
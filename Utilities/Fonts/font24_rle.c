@@ -0,0 +1,240 @@
+/* Generated by fontpack.py from font24.c, do not edit. */
+#include "fonts.h"
+
+#if defined(FONTS_COMPRESSED)
+
+/* 3549 bytes, 6840 bytes as raw bitmaps */
+static const uint8_t Font24_Rle_Table[] =
+{
+  0xC7, 0x00, 0x85, 0x00, 0x01, 0x03, 0x80, 0x98, 0x00, 0x01, 0x02, 0x80, 0x83, 0x00, 0x00, 0x01,
+  0x84, 0x00, 0x01, 0x03, 0x80, 0x83, 0x00, 0x01, 0x03, 0x80, 0x92, 0x00, 0x88, 0x00, 0x01, 0x0E,
+  0x70, 0x86, 0x00, 0x01, 0x0A, 0x50, 0x89, 0x00, 0x01, 0x04, 0x20, 0xA7, 0x00, 0x85, 0x00, 0x01,
+  0x06, 0x60, 0x8C, 0x00, 0x01, 0x39, 0x98, 0x83, 0x00, 0x07, 0x39, 0x98, 0x00, 0x0A, 0xA0, 0x00,
+  0x33, 0x38, 0x83, 0x00, 0x01, 0x33, 0x38, 0x8C, 0x00, 0x01, 0x0C, 0xC0, 0x8F, 0x00, 0x82, 0x00,
+  0x01, 0x01, 0x80, 0x83, 0x00, 0x07, 0x06, 0x30, 0x00, 0x08, 0x40, 0x00, 0x17, 0x80, 0x83, 0x00,
+  0x0F, 0x04, 0x70, 0x00, 0x13, 0x80, 0x00, 0x08, 0x60, 0x00, 0x07, 0x10, 0x00, 0x18, 0xC0, 0x00,
+  0x04, 0x82, 0x00, 0x09, 0x40, 0x00, 0x03, 0x90, 0x00, 0x04, 0x20, 0x00, 0x1A, 0x40, 0x89, 0x00,
+  0x01, 0x01, 0x80, 0x89, 0x00, 0x85, 0x00, 0x0A, 0x07, 0x80, 0x00, 0x08, 0x40, 0x00, 0x13, 0x20,
+  0x00, 0x04, 0x80, 0x83, 0x00, 0x10, 0x04, 0x80, 0x00, 0x13, 0x18, 0x00, 0x08, 0x18, 0x00, 0x18,
+  0x10, 0x00, 0x18, 0xC8, 0x00, 0x01, 0x20, 0x83, 0x00, 0x0A, 0x01, 0x20, 0x00, 0x04, 0xC8, 0x00,
+  0x02, 0x10, 0x00, 0x01, 0xE0, 0x92, 0x00, 0x8B, 0x00, 0x0A, 0x03, 0xF0, 0x00, 0x04, 0x00, 0x00,
+  0x0B, 0x90, 0x00, 0x00, 0x60, 0x83, 0x00, 0x19, 0x0A, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x9C,
+  0x00, 0x12, 0x60, 0x00, 0x05, 0x0C, 0x00, 0x00, 0x80, 0x00, 0x17, 0x8C, 0x00, 0x08, 0x20, 0x00,
+  0x07, 0xDC, 0x92, 0x00, 0x88, 0x00, 0x01, 0x03, 0x80, 0x86, 0x00, 0x01, 0x02, 0x80, 0x89, 0x00,
+  0x00, 0x01, 0xA8, 0x00, 0x86, 0x00, 0x0C, 0x18, 0x00, 0x00, 0x20, 0x00, 0x00, 0x48, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x10, 0x83, 0x00, 0x01, 0x01, 0x20, 0x8F, 0x00, 0x01, 0x01, 0x20, 0x84, 0x00,
+  0x00, 0x90, 0x84, 0x00, 0x06, 0x48, 0x00, 0x00, 0x20, 0x00, 0x00, 0x18, 0x89, 0x00, 0x85, 0x00,
+  0x06, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x12, 0x84, 0x00, 0x00, 0x09, 0x84, 0x00, 0x01, 0x04,
+  0x80, 0x8F, 0x00, 0x01, 0x04, 0x80, 0x83, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x12,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x18, 0x8A, 0x00, 0x85, 0x00, 0x01, 0x01, 0x80, 0x86, 0x00, 0x0A,
+  0x1C, 0x38, 0x00, 0x02, 0x40, 0x00, 0x18, 0x18, 0x00, 0x04, 0x20, 0x83, 0x00, 0x01, 0x05, 0xA0,
+  0x83, 0x00, 0x01, 0x06, 0x60, 0xA1, 0x00, 0x8B, 0x00, 0x01, 0x01, 0x80, 0x8C, 0x00, 0x01, 0x3E,
+  0x7C, 0x83, 0x00, 0x01, 0x3E, 0x7C, 0x8C, 0x00, 0x01, 0x01, 0x80, 0x95, 0x00, 0xAA, 0x00, 0x05,
+  0xE0, 0x00, 0x00, 0x20, 0x00, 0x01, 0x82, 0x00, 0x00, 0x40, 0x83, 0x00, 0x01, 0x02, 0x80, 0x83,
+  0x00, 0x00, 0x03, 0x87, 0x00, 0x9A, 0x00, 0x01, 0x1F, 0xF8, 0x83, 0x00, 0x01, 0x1F, 0xF8, 0xA4,
+  0x00, 0xA9, 0x00, 0x01, 0x03, 0xC0, 0x86, 0x00, 0x01, 0x03, 0xC0, 0x92, 0x00, 0x01, 0x00, 0x18,
+  0x84, 0x00, 0x09, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x84, 0x00, 0x00,
+  0xA0, 0x83, 0x00, 0x01, 0x01, 0x40, 0x83, 0x00, 0x01, 0x02, 0x80, 0x83, 0x00, 0x00, 0x05, 0x84,
+  0x00, 0x09, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x18,
+  0x8A, 0x00, 0x85, 0x00, 0x07, 0x03, 0xC0, 0x00, 0x04, 0x20, 0x00, 0x0B, 0xD0, 0x83, 0x00, 0x01,
+  0x14, 0x28, 0x92, 0x00, 0x01, 0x14, 0x28, 0x83, 0x00, 0x07, 0x0B, 0xD0, 0x00, 0x04, 0x20, 0x00,
+  0x03, 0xC0, 0x92, 0x00, 0x86, 0x00, 0x0B, 0x80, 0x00, 0x07, 0x00, 0x00, 0x18, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x1C, 0x99, 0x00, 0x01, 0x1E, 0x78, 0x83, 0x00, 0x01, 0x1F, 0xF8, 0x92, 0x00, 0x85,
+  0x00, 0x0A, 0x07, 0xC0, 0x00, 0x18, 0x30, 0x00, 0x27, 0xC0, 0x00, 0x08, 0x28, 0x83, 0x00, 0x00,
+  0x30, 0x82, 0x00, 0x15, 0x28, 0x00, 0x00, 0x50, 0x00, 0x01, 0xA0, 0x00, 0x02, 0x40, 0x00, 0x05,
+  0x80, 0x00, 0x0A, 0x00, 0x00, 0x14, 0x00, 0x00, 0x27, 0xF8, 0x83, 0x00, 0x01, 0x3F, 0xF8, 0x92,
+  0x00, 0x85, 0x00, 0x0A, 0x03, 0xC0, 0x00, 0x0C, 0x20, 0x00, 0x03, 0x90, 0x00, 0x0C, 0x40, 0x84,
+  0x00, 0x0C, 0x50, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x03, 0x90, 0x00, 0x00, 0x68, 0x86,
+  0x00, 0x0A, 0x18, 0x20, 0x00, 0x07, 0xC8, 0x00, 0x10, 0x30, 0x00, 0x0F, 0xC0, 0x92, 0x00, 0x86,
+  0x00, 0x02, 0xE0, 0x00, 0x01, 0x84, 0x00, 0x03, 0x02, 0x80, 0x00, 0x05, 0x84, 0x00, 0x00, 0x0A,
+  0x84, 0x00, 0x07, 0x14, 0x00, 0x00, 0x28, 0x00, 0x00, 0x0F, 0x98, 0x83, 0x00, 0x04, 0x3F, 0x98,
+  0x00, 0x03, 0x98, 0x83, 0x00, 0x01, 0x03, 0xF8, 0x92, 0x00, 0x85, 0x00, 0x01, 0x1F, 0xF0, 0x83,
+  0x00, 0x01, 0x07, 0xF0, 0x86, 0x00, 0x0A, 0x03, 0xC0, 0x00, 0x04, 0x30, 0x00, 0x03, 0xC0, 0x00,
+  0x1C, 0x28, 0x89, 0x00, 0x0A, 0x30, 0x28, 0x00, 0x0F, 0xC0, 0x00, 0x30, 0x30, 0x00, 0x0F, 0xC0,
+  0x92, 0x00, 0x86, 0x00, 0x1B, 0xF8, 0x00, 0x03, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x09, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x04, 0x30, 0x00, 0x03, 0xC0, 0x00, 0x04,
+  0x28, 0x86, 0x00, 0x0A, 0x14, 0x20, 0x00, 0x03, 0xC8, 0x00, 0x0C, 0x10, 0x00, 0x03, 0xE0, 0x92,
+  0x00, 0x85, 0x00, 0x01, 0x1F, 0xF8, 0x83, 0x00, 0x07, 0x07, 0xE0, 0x00, 0x00, 0x20, 0x00, 0x18,
+  0x08, 0x84, 0x00, 0x03, 0x40, 0x00, 0x00, 0x10, 0x84, 0x00, 0x03, 0x80, 0x00, 0x00, 0x20, 0x83,
+  0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x40, 0x83, 0x00, 0x01, 0x01, 0x80, 0x92, 0x00, 0x85, 0x00,
+  0x0A, 0x07, 0xE0, 0x00, 0x08, 0x10, 0x00, 0x13, 0xC8, 0x00, 0x04, 0x20, 0x83, 0x00, 0x04, 0x14,
+  0x28, 0x00, 0x0B, 0xD0, 0x83, 0x00, 0x04, 0x0B, 0xD0, 0x00, 0x14, 0x28, 0x86, 0x00, 0x0A, 0x04,
+  0x20, 0x00, 0x13, 0xC8, 0x00, 0x08, 0x10, 0x00, 0x07, 0xE0, 0x92, 0x00, 0x85, 0x00, 0x0A, 0x07,
+  0xC0, 0x00, 0x08, 0x30, 0x00, 0x13, 0xC0, 0x00, 0x04, 0x28, 0x86, 0x00, 0x1B, 0x14, 0x20, 0x00,
+  0x03, 0xC0, 0x00, 0x0C, 0x20, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0x90, 0x00, 0x1F, 0x20, 0x00, 0x00, 0xC0, 0x00, 0x1F, 0x93, 0x00, 0x91, 0x00, 0x01, 0x03, 0xC0,
+  0x86, 0x00, 0x01, 0x03, 0xC0, 0x8C, 0x00, 0x01, 0x03, 0xC0, 0x86, 0x00, 0x01, 0x03, 0xC0, 0x92,
+  0x00, 0x92, 0x00, 0x00, 0xF0, 0x87, 0x00, 0x00, 0xF0, 0x8A, 0x00, 0x06, 0xE0, 0x00, 0x01, 0x20,
+  0x00, 0x00, 0x40, 0x83, 0x00, 0x06, 0x02, 0x80, 0x00, 0x01, 0x00, 0x00, 0x02, 0x8D, 0x00, 0x8C,
+  0x00, 0x27, 0x1C, 0x00, 0x00, 0x20, 0x00, 0x00, 0xCC, 0x00, 0x03, 0x30, 0x00, 0x0C, 0xC0, 0x00,
+  0x33, 0x00, 0x00, 0xCC, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x33, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x03,
+  0x30, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1C, 0x92, 0x00, 0x94, 0x00, 0x01, 0x7F,
+  0xFC, 0x83, 0x00, 0x01, 0x7F, 0xFC, 0x83, 0x00, 0x01, 0x7F, 0xFC, 0x83, 0x00, 0x01, 0x7F, 0xFC,
+  0x9E, 0x00, 0x8B, 0x00, 0x27, 0x70, 0x00, 0x00, 0x08, 0x00, 0x00, 0x66, 0x00, 0x00, 0x19, 0x80,
+  0x00, 0x06, 0x60, 0x00, 0x01, 0x98, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x01, 0x98, 0x00,
+  0x06, 0x60, 0x00, 0x19, 0x80, 0x00, 0x66, 0x00, 0x00, 0x08, 0x00, 0x00, 0x70, 0x93, 0x00, 0x88,
+  0x00, 0x0A, 0x07, 0xC0, 0x00, 0x08, 0x20, 0x00, 0x17, 0x90, 0x00, 0x00, 0x40, 0x83, 0x00, 0x0F,
+  0x18, 0x40, 0x00, 0x00, 0x90, 0x00, 0x03, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x00, 0x03,
+  0x84, 0x00, 0x00, 0x07, 0x84, 0x00, 0x00, 0x07, 0x93, 0x00, 0x85, 0x00, 0x16, 0x03, 0xE0, 0x00,
+  0x04, 0x10, 0x00, 0x09, 0xC8, 0x00, 0x02, 0x20, 0x00, 0x14, 0x60, 0x00, 0x00, 0x80, 0x00, 0x01,
+  0x20, 0x00, 0x00, 0x40, 0x86, 0x00, 0x16, 0x01, 0x60, 0x00, 0x00, 0x80, 0x00, 0x00, 0x78, 0x00,
+  0x14, 0x00, 0x00, 0x02, 0x18, 0x00, 0x09, 0xE0, 0x00, 0x04, 0x18, 0x00, 0x03, 0xE0, 0x8C, 0x00,
+  0x88, 0x00, 0x0A, 0x1F, 0x80, 0x00, 0x00, 0x40, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xA0, 0x83, 0x00,
+  0x01, 0x05, 0x50, 0x83, 0x00, 0x10, 0x0A, 0x00, 0x00, 0x03, 0xC8, 0x00, 0x10, 0x00, 0x00, 0x07,
+  0xF4, 0x00, 0x28, 0x00, 0x00, 0xCC, 0x73, 0x83, 0x00, 0x01, 0xFC, 0x7F, 0x92, 0x00, 0x88, 0x00,
+  0x0A, 0x7F, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x67, 0xC8, 0x00, 0x00, 0x20, 0x84, 0x00, 0x0C, 0x20,
+  0x00, 0x07, 0xC8, 0x00, 0x00, 0x08, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x10, 0x86, 0x00, 0x07, 0x67,
+  0xF4, 0x00, 0x00, 0x08, 0x00, 0x7F, 0xF0, 0x92, 0x00, 0x88, 0x00, 0x0C, 0x03, 0xEC, 0x00, 0x0C,
+  0x10, 0x00, 0x13, 0xE0, 0x00, 0x04, 0x10, 0x00, 0x28, 0x82, 0x00, 0x00, 0x0C, 0x8C, 0x00, 0x0D,
+  0x28, 0x0C, 0x00, 0x04, 0x10, 0x00, 0x13, 0xE4, 0x00, 0x0C, 0x08, 0x00, 0x03, 0xF0, 0x92, 0x00,
+  0x88, 0x00, 0x0D, 0x7F, 0xC0, 0x00, 0x00, 0x30, 0x00, 0x67, 0xC8, 0x00, 0x00, 0x20, 0x00, 0x00,
+  0x14, 0x90, 0x00, 0x0C, 0x14, 0x00, 0x00, 0x20, 0x00, 0x67, 0xC8, 0x00, 0x00, 0x10, 0x00, 0x7F,
+  0xE0, 0x92, 0x00, 0x88, 0x00, 0x01, 0x7F, 0xF8, 0x83, 0x00, 0x01, 0x67, 0xE0, 0x83, 0x00, 0x06,
+  0x01, 0x80, 0x00, 0x00, 0x18, 0x00, 0x06, 0x84, 0x00, 0x00, 0x06, 0x82, 0x00, 0x03, 0x18, 0x00,
+  0x01, 0x80, 0x83, 0x00, 0x01, 0x67, 0xE0, 0x83, 0x00, 0x01, 0x7F, 0xF8, 0x92, 0x00, 0x88, 0x00,
+  0x01, 0x3F, 0xFC, 0x83, 0x00, 0x01, 0x33, 0xF0, 0x84, 0x00, 0x05, 0xC0, 0x00, 0x00, 0x0C, 0x00,
+  0x03, 0x84, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0xC0, 0x83, 0x00, 0x01, 0x33, 0xC0, 0x83, 0x00,
+  0x01, 0x3F, 0xC0, 0x92, 0x00, 0x88, 0x00, 0x0C, 0x03, 0xEC, 0x00, 0x0C, 0x10, 0x00, 0x13, 0xE0,
+  0x00, 0x04, 0x10, 0x00, 0x28, 0x82, 0x00, 0x00, 0x0C, 0x84, 0x00, 0x00, 0xFE, 0x84, 0x00, 0x0F,
+  0xF2, 0x00, 0x08, 0x00, 0x00, 0x24, 0x10, 0x00, 0x13, 0xE0, 0x00, 0x0C, 0x0C, 0x00, 0x03, 0xF0,
+  0x92, 0x00, 0x88, 0x00, 0x01, 0x7E, 0x7E, 0x83, 0x00, 0x01, 0x66, 0x66, 0x89, 0x00, 0x01, 0x07,
+  0xE0, 0x83, 0x00, 0x01, 0x07, 0xE0, 0x89, 0x00, 0x01, 0x66, 0x66, 0x83, 0x00, 0x01, 0x7E, 0x7E,
+  0x92, 0x00, 0x88, 0x00, 0x01, 0x1F, 0xF8, 0x83, 0x00, 0x01, 0x1E, 0x78, 0x9B, 0x00, 0x01, 0x1E,
+  0x78, 0x83, 0x00, 0x01, 0x1F, 0xF8, 0x92, 0x00, 0x88, 0x00, 0x01, 0x07, 0xFE, 0x83, 0x00, 0x01,
+  0x07, 0xCE, 0x8C, 0x00, 0x00, 0x30, 0x8B, 0x00, 0x09, 0x50, 0x00, 0x0F, 0x80, 0x00, 0x30, 0x60,
+  0x00, 0x0F, 0x80, 0x92, 0x00, 0x88, 0x00, 0x01, 0x7F, 0x3E, 0x83, 0x00, 0x1F, 0x67, 0x0E, 0x00,
+  0x00, 0x50, 0x00, 0x00, 0xA0, 0x00, 0x01, 0x40, 0x00, 0x02, 0x00, 0x00, 0x04, 0x40, 0x00, 0x03,
+  0x20, 0x00, 0x04, 0x90, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00, 0x67, 0x27, 0x83, 0x00, 0x01,
+  0x7F, 0x1F, 0x92, 0x00, 0x88, 0x00, 0x01, 0x7F, 0x80, 0x83, 0x00, 0x01, 0x73, 0x80, 0x90, 0x00,
+  0x00, 0x0C, 0x89, 0x00, 0x01, 0x73, 0xF0, 0x83, 0x00, 0x01, 0x7F, 0xFC, 0x92, 0x00, 0x88, 0x00,
+  0x0A, 0xF0, 0x0F, 0x00, 0x08, 0x10, 0x00, 0xC0, 0x03, 0x00, 0x04, 0x20, 0x83, 0x00, 0x01, 0x0A,
+  0x50, 0x83, 0x00, 0x01, 0x05, 0xA0, 0x83, 0x00, 0x04, 0x02, 0x40, 0x00, 0x01, 0x80, 0x83, 0x00,
+  0x01, 0xCE, 0x73, 0x83, 0x00, 0x01, 0xFE, 0x7F, 0x92, 0x00, 0x88, 0x00, 0x01, 0x78, 0xFE, 0x83,
+  0x00, 0x09, 0x64, 0xE6, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x82, 0x00, 0x05, 0x80,
+  0x00, 0x02, 0x40, 0x00, 0x01, 0x82, 0x00, 0x09, 0x20, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00,
+  0x67, 0x20, 0x83, 0x00, 0x01, 0x7F, 0x18, 0x92, 0x00, 0x88, 0x00, 0x10, 0x03, 0xC0, 0x00, 0x0C,
+  0x30, 0x00, 0x13, 0xC8, 0x00, 0x04, 0x20, 0x00, 0x20, 0x04, 0x00, 0x08, 0x10, 0x89, 0x00, 0x10,
+  0x08, 0x10, 0x00, 0x20, 0x04, 0x00, 0x04, 0x20, 0x00, 0x13, 0xC8, 0x00, 0x0C, 0x30, 0x00, 0x03,
+  0xC0, 0x92, 0x00, 0x88, 0x00, 0x0A, 0x3F, 0xF0, 0x00, 0x00, 0x08, 0x00, 0x33, 0xE4, 0x00, 0x00,
+  0x10, 0x87, 0x00, 0x09, 0x14, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x18, 0x00, 0x03, 0xE0, 0x86, 0x00,
+  0x01, 0x33, 0xC0, 0x83, 0x00, 0x01, 0x3F, 0xC0, 0x92, 0x00, 0x88, 0x00, 0x10, 0x03, 0xC0, 0x00,
+  0x0C, 0x30, 0x00, 0x13, 0xC8, 0x00, 0x04, 0x20, 0x00, 0x20, 0x04, 0x00, 0x08, 0x10, 0x89, 0x00,
+  0x19, 0x08, 0x10, 0x00, 0x20, 0x04, 0x00, 0x04, 0x20, 0x00, 0x13, 0xC8, 0x00, 0x08, 0x30, 0x00,
+  0x00, 0x0C, 0x00, 0x08, 0x30, 0x00, 0x03, 0xC4, 0x00, 0x0C, 0x38, 0x89, 0x00, 0x88, 0x00, 0x0A,
+  0x7F, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x67, 0xC8, 0x00, 0x00, 0x20, 0x84, 0x00, 0x1B, 0x20, 0x00,
+  0x07, 0xC8, 0x00, 0x00, 0x30, 0x00, 0x07, 0x20, 0x00, 0x00, 0x90, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0x08, 0x00, 0x67, 0x26, 0x00, 0x00, 0x10, 0x00, 0x7F, 0x0E, 0x92, 0x00, 0x88, 0x00, 0x0A, 0x07,
+  0xD8, 0x00, 0x08, 0x20, 0x00, 0x13, 0xC0, 0x00, 0x04, 0x20, 0x83, 0x00, 0x0D, 0x06, 0x18, 0x00,
+  0x11, 0xC0, 0x00, 0x0C, 0x30, 0x00, 0x03, 0x88, 0x00, 0x18, 0x60, 0x83, 0x00, 0x0A, 0x04, 0x20,
+  0x00, 0x03, 0xC8, 0x00, 0x04, 0x10, 0x00, 0x1B, 0xE0, 0x92, 0x00, 0x88, 0x00, 0x01, 0x3F, 0xFC,
+  0x83, 0x00, 0x01, 0x0E, 0x70, 0x89, 0x00, 0x01, 0x30, 0x0C, 0x8F, 0x00, 0x01, 0x0E, 0x70, 0x83,
+  0x00, 0x01, 0x0F, 0xF0, 0x92, 0x00, 0x88, 0x00, 0x01, 0x7E, 0x7E, 0x83, 0x00, 0x01, 0x66, 0x66,
+  0x98, 0x00, 0x0A, 0x14, 0x28, 0x00, 0x03, 0xC0, 0x00, 0x0C, 0x30, 0x00, 0x03, 0xC0, 0x92, 0x00,
+  0x88, 0x00, 0x01, 0x7F, 0x7F, 0x83, 0x00, 0x04, 0x67, 0x73, 0x00, 0x14, 0x14, 0x86, 0x00, 0x01,
+  0x0A, 0x28, 0x83, 0x00, 0x01, 0x05, 0x50, 0x86, 0x00, 0x01, 0x02, 0xA0, 0x83, 0x00, 0x04, 0x01,
+  0x40, 0x00, 0x00, 0x80, 0x92, 0x00, 0x88, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x82, 0x00, 0x02, 0xCE,
+  0x39, 0x80, 0x83, 0x00, 0x03, 0x80, 0x00, 0x29, 0x4A, 0x83, 0x00, 0x01, 0x02, 0xA0, 0x83, 0x00,
+  0x04, 0x05, 0x10, 0x00, 0x10, 0x44, 0x83, 0x00, 0x01, 0x02, 0x20, 0x83, 0x00, 0x01, 0x0C, 0x18,
+  0x92, 0x00, 0x88, 0x00, 0x01, 0x7E, 0x7E, 0x83, 0x00, 0x0D, 0x66, 0x66, 0x00, 0x14, 0x28, 0x00,
+  0x0A, 0x50, 0x00, 0x05, 0xA0, 0x00, 0x02, 0x40, 0x83, 0x00, 0x0D, 0x02, 0x40, 0x00, 0x05, 0xA0,
+  0x00, 0x0A, 0x50, 0x00, 0x14, 0x28, 0x00, 0x66, 0x66, 0x83, 0x00, 0x01, 0x7E, 0x7E, 0x92, 0x00,
+  0x88, 0x00, 0x01, 0x7C, 0x7E, 0x83, 0x00, 0x07, 0x64, 0x66, 0x00, 0x14, 0x28, 0x00, 0x0A, 0x50,
+  0x83, 0x00, 0x04, 0x05, 0xA0, 0x00, 0x02, 0x40, 0x8C, 0x00, 0x01, 0x0E, 0x70, 0x83, 0x00, 0x01,
+  0x0F, 0xF0, 0x92, 0x00, 0x88, 0x00, 0x01, 0x1F, 0xF8, 0x83, 0x00, 0x1F, 0x07, 0xE0, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x50, 0x00, 0x00, 0xA0, 0x00, 0x19, 0x40, 0x00, 0x02, 0x80, 0x00, 0x05, 0x18,
+  0x00, 0x0A, 0x00, 0x00, 0x14, 0x00, 0x00, 0x28, 0x00, 0x00, 0x0F, 0xE0, 0x83, 0x00, 0x01, 0x3F,
+  0xF8, 0x92, 0x00, 0x85, 0x00, 0x01, 0x01, 0xF0, 0x84, 0x00, 0x00, 0x70, 0xA8, 0x00, 0x00, 0x70,
+  0x83, 0x00, 0x01, 0x01, 0xF0, 0x89, 0x00, 0x00, 0x18, 0x84, 0x00, 0x09, 0x04, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x05, 0x84, 0x00, 0x01, 0x02, 0x80, 0x83,
+  0x00, 0x01, 0x01, 0x40, 0x84, 0x00, 0x00, 0xA0, 0x84, 0x00, 0x09, 0x10, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0x20, 0x84, 0x00, 0x00, 0x18, 0x89, 0x00, 0x85, 0x00, 0x01, 0x0F, 0x80,
+  0x83, 0x00, 0x00, 0x0E, 0xA8, 0x00, 0x00, 0x0E, 0x84, 0x00, 0x01, 0x0F, 0x80, 0x89, 0x00, 0x83,
+  0x00, 0x18, 0x80, 0x00, 0x01, 0x40, 0x00, 0x02, 0x20, 0x00, 0x04, 0x90, 0x00, 0x01, 0x40, 0x00,
+  0x0A, 0x28, 0x00, 0x14, 0x14, 0x00, 0x08, 0x08, 0x00, 0x10, 0x04, 0xAA, 0x00, 0xC1, 0x00, 0x01,
+  0xFF, 0xFF, 0x83, 0x00, 0x82, 0x00, 0x00, 0x03, 0x82, 0x00, 0x09, 0x80, 0x00, 0x03, 0x60, 0x00,
+  0x00, 0x80, 0x00, 0x00, 0x60, 0xB6, 0x00, 0x91, 0x00, 0x07, 0x0F, 0xC0, 0x00, 0x10, 0x20, 0x00,
+  0x1F, 0xD0, 0x83, 0x00, 0x09, 0x07, 0xC0, 0x00, 0x18, 0x00, 0x00, 0x27, 0xC0, 0x00, 0x08, 0x82,
+  0x00, 0x09, 0x40, 0x00, 0x2F, 0x8C, 0x00, 0x10, 0x40, 0x00, 0x0F, 0xBC, 0x92, 0x00, 0x85, 0x00,
+  0x00, 0x78, 0x84, 0x00, 0x00, 0x60, 0x84, 0x00, 0x0A, 0x03, 0xE0, 0x00, 0x04, 0x18, 0x00, 0x03,
+  0xE0, 0x00, 0x04, 0x14, 0x8C, 0x00, 0x0A, 0x04, 0x14, 0x00, 0x63, 0xE0, 0x00, 0x04, 0x18, 0x00,
+  0x7B, 0xE0, 0x92, 0x00, 0x91, 0x00, 0x0C, 0x03, 0xEC, 0x00, 0x0C, 0x10, 0x00, 0x13, 0xE0, 0x00,
+  0x24, 0x10, 0x00, 0x08, 0x82, 0x00, 0x00, 0x0C, 0x83, 0x00, 0x0D, 0x08, 0x0C, 0x00, 0x24, 0x10,
+  0x00, 0x13, 0xE4, 0x00, 0x0C, 0x08, 0x00, 0x03, 0xF0, 0x92, 0x00, 0x86, 0x00, 0x00, 0x78, 0x84,
+  0x00, 0x00, 0x60, 0x83, 0x00, 0x0A, 0x07, 0xC0, 0x00, 0x18, 0x20, 0x00, 0x07, 0xC0, 0x00, 0x28,
+  0x20, 0x8C, 0x00, 0x0A, 0x28, 0x20, 0x00, 0x07, 0xC6, 0x00, 0x18, 0x20, 0x00, 0x07, 0xDE, 0x92,
+  0x00, 0x91, 0x00, 0x0D, 0x07, 0xE0, 0x00, 0x18, 0x18, 0x00, 0x07, 0xE0, 0x00, 0x28, 0x14, 0x00,
+  0x0F, 0xF0, 0x83, 0x00, 0x01, 0x0F, 0xFC, 0x83, 0x00, 0x0A, 0x28, 0x0C, 0x00, 0x07, 0xF0, 0x00,
+  0x18, 0x0C, 0x00, 0x07, 0xF0, 0x92, 0x00, 0x85, 0x00, 0x07, 0x01, 0xFC, 0x00, 0x02, 0x00, 0x00,
+  0x05, 0xFC, 0x83, 0x00, 0x01, 0x39, 0xF8, 0x83, 0x00, 0x01, 0x39, 0xF8, 0x92, 0x00, 0x01, 0x39,
+  0xF0, 0x83, 0x00, 0x01, 0x3F, 0xF0, 0x92, 0x00, 0x91, 0x00, 0x0A, 0x07, 0xDE, 0x00, 0x18, 0x20,
+  0x00, 0x07, 0xC6, 0x00, 0x28, 0x20, 0x8C, 0x00, 0x0A, 0x28, 0x20, 0x00, 0x07, 0xC0, 0x00, 0x18,
+  0x20, 0x00, 0x07, 0xC0, 0x84, 0x00, 0x09, 0x20, 0x00, 0x0F, 0xC8, 0x00, 0x00, 0x30, 0x00, 0x0F,
+  0xC0, 0x83, 0x00, 0x85, 0x00, 0x00, 0x78, 0x84, 0x00, 0x00, 0x60, 0x84, 0x00, 0x0A, 0x03, 0xE0,
+  0x00, 0x04, 0x10, 0x00, 0x03, 0xC8, 0x00, 0x04, 0x20, 0x8F, 0x00, 0x01, 0x66, 0x66, 0x83, 0x00,
+  0x01, 0x7E, 0x7E, 0x92, 0x00, 0x85, 0x00, 0x01, 0x01, 0x80, 0x83, 0x00, 0x01, 0x01, 0x80, 0x83,
+  0x00, 0x01, 0x1F, 0x80, 0x83, 0x00, 0x00, 0x1E, 0x93, 0x00, 0x01, 0x3E, 0x7C, 0x83, 0x00, 0x01,
+  0x3F, 0xFC, 0x92, 0x00, 0x86, 0x00, 0x00, 0xC0, 0x84, 0x00, 0x00, 0xC0, 0x83, 0x00, 0x01, 0x1F,
+  0xF0, 0x83, 0x00, 0x01, 0x1F, 0xC0, 0x9F, 0x00, 0x09, 0x40, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x60,
+  0x00, 0x1F, 0x80, 0x83, 0x00, 0x85, 0x00, 0x00, 0x3C, 0x84, 0x00, 0x00, 0x30, 0x85, 0x00, 0x00,
+  0xF8, 0x84, 0x00, 0x05, 0x38, 0x00, 0x01, 0x40, 0x00, 0x02, 0x82, 0x00, 0x0C, 0x80, 0x00, 0x00,
+  0x80, 0x00, 0x02, 0x40, 0x00, 0x01, 0x20, 0x00, 0x30, 0x9C, 0x83, 0x00, 0x01, 0x3C, 0x7C, 0x92,
+  0x00, 0x85, 0x00, 0x01, 0x1F, 0x80, 0x83, 0x00, 0x00, 0x1E, 0x9F, 0x00, 0x01, 0x3E, 0x7C, 0x83,
+  0x00, 0x01, 0x3F, 0xFC, 0x92, 0x00, 0x91, 0x00, 0x0A, 0xF7, 0x78, 0x00, 0x08, 0x84, 0x00, 0xC6,
+  0x30, 0x00, 0x08, 0x40, 0x8F, 0x00, 0x01, 0xCC, 0x63, 0x83, 0x00, 0x01, 0xFD, 0xEF, 0x92, 0x00,
+  0x91, 0x00, 0x0A, 0x7B, 0xE0, 0x00, 0x04, 0x10, 0x00, 0x63, 0xC8, 0x00, 0x04, 0x20, 0x8F, 0x00,
+  0x01, 0x66, 0x66, 0x83, 0x00, 0x01, 0x7E, 0x7E, 0x92, 0x00, 0x91, 0x00, 0x0D, 0x03, 0xC0, 0x00,
+  0x0C, 0x30, 0x00, 0x13, 0xC8, 0x00, 0x24, 0x24, 0x00, 0x08, 0x10, 0x86, 0x00, 0x0D, 0x08, 0x10,
+  0x00, 0x24, 0x24, 0x00, 0x13, 0xC8, 0x00, 0x0C, 0x30, 0x00, 0x03, 0xC0, 0x92, 0x00, 0x91, 0x00,
+  0x0A, 0x7B, 0xE0, 0x00, 0x04, 0x18, 0x00, 0x63, 0xE0, 0x00, 0x04, 0x14, 0x8C, 0x00, 0x0A, 0x04,
+  0x14, 0x00, 0x03, 0xE0, 0x00, 0x04, 0x18, 0x00, 0x03, 0xE0, 0x86, 0x00, 0x00, 0x67, 0x84, 0x00,
+  0x00, 0x7F, 0x84, 0x00, 0x91, 0x00, 0x0A, 0x07, 0xDE, 0x00, 0x18, 0x20, 0x00, 0x07, 0xC6, 0x00,
+  0x28, 0x20, 0x8C, 0x00, 0x0A, 0x28, 0x20, 0x00, 0x07, 0xC0, 0x00, 0x18, 0x20, 0x00, 0x07, 0xC0,
+  0x87, 0x00, 0x00, 0xE6, 0x84, 0x00, 0x00, 0xFE, 0x83, 0x00, 0x91, 0x00, 0x0C, 0x3E, 0x78, 0x00,
+  0x00, 0x84, 0x00, 0x39, 0x30, 0x00, 0x00, 0xCC, 0x00, 0x01, 0x8D, 0x00, 0x01, 0x39, 0xF0, 0x83,
+  0x00, 0x01, 0x3F, 0xF0, 0x92, 0x00, 0x91, 0x00, 0x07, 0x07, 0xF8, 0x00, 0x08, 0x00, 0x00, 0x17,
+  0xE0, 0x83, 0x00, 0x16, 0x07, 0x98, 0x00, 0x10, 0x70, 0x00, 0x0F, 0x08, 0x00, 0x18, 0xE0, 0x00,
+  0x00, 0x20, 0x00, 0x07, 0xC8, 0x00, 0x00, 0x10, 0x00, 0x1F, 0xE0, 0x92, 0x00, 0x85, 0x00, 0x00,
+  0x0C, 0x8A, 0x00, 0x01, 0x33, 0xF0, 0x83, 0x00, 0x01, 0x33, 0xF0, 0x90, 0x00, 0x09, 0x1C, 0x00,
+  0x0B, 0xE0, 0x00, 0x04, 0x0C, 0x00, 0x03, 0xF0, 0x92, 0x00, 0x91, 0x00, 0x01, 0x78, 0x78, 0x83,
+  0x00, 0x01, 0x60, 0x60, 0x90, 0x00, 0x09, 0x20, 0x00, 0x17, 0xC6, 0x00, 0x08, 0x20, 0x00, 0x07,
+  0xDE, 0x92, 0x00, 0x91, 0x00, 0x01, 0x7C, 0x3E, 0x83, 0x00, 0x01, 0x64, 0x26, 0x83, 0x00, 0x01,
+  0x14, 0x28, 0x83, 0x00, 0x01, 0x0A, 0x50, 0x83, 0x00, 0x04, 0x01, 0x80, 0x00, 0x04, 0x20, 0x83,
+  0x00, 0x01, 0x03, 0xC0, 0x92, 0x00, 0x91, 0x00, 0x01, 0x78, 0x3C, 0x83, 0x00, 0x04, 0x49, 0x24,
+  0x00, 0x02, 0x80, 0x83, 0x00, 0x04, 0x29, 0x28, 0x00, 0x04, 0x40, 0x83, 0x00, 0x03, 0x02, 0x90,
+  0x00, 0x10, 0x84, 0x00, 0x01, 0x0C, 0x60, 0x92, 0x00, 0x91, 0x00, 0x01, 0x3E, 0x7C, 0x83, 0x00,
+  0x16, 0x32, 0x4C, 0x00, 0x0A, 0x50, 0x00, 0x05, 0xA0, 0x00, 0x02, 0x40, 0x00, 0x02, 0x40, 0x00,
+  0x05, 0xA0, 0x00, 0x0A, 0x50, 0x00, 0x32, 0x4C, 0x83, 0x00, 0x01, 0x3E, 0x7C, 0x92, 0x00, 0x91,
+  0x00, 0x01, 0x7E, 0x1F, 0x83, 0x00, 0x04, 0x66, 0x13, 0x00, 0x14, 0x14, 0x83, 0x00, 0x01, 0x0A,
+  0x28, 0x83, 0x00, 0x0D, 0x05, 0x50, 0x00, 0x00, 0x80, 0x00, 0x02, 0x20, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x40, 0x83, 0x00, 0x04, 0x02, 0x80, 0x00, 0x3C, 0xC0, 0x83, 0x00, 0x01, 0x3F, 0xC0, 0x83,
+  0x00, 0x91, 0x00, 0x01, 0x1F, 0xF8, 0x83, 0x00, 0x16, 0x07, 0xC8, 0x00, 0x00, 0x50, 0x00, 0x18,
+  0xA0, 0x00, 0x01, 0x40, 0x00, 0x02, 0x80, 0x00, 0x05, 0x18, 0x00, 0x0A, 0x00, 0x00, 0x13, 0xE0,
+  0x83, 0x00, 0x01, 0x1F, 0xF8, 0x92, 0x00, 0x86, 0x00, 0x02, 0xE0, 0x00, 0x01, 0x82, 0x00, 0x00,
+  0x60, 0x8F, 0x00, 0x09, 0x02, 0x00, 0x00, 0x04, 0x80, 0x00, 0x04, 0x80, 0x00, 0x02, 0x8E, 0x00,
+  0x02, 0x60, 0x00, 0x01, 0x82, 0x00, 0x00, 0xE0, 0x89, 0x00, 0x85, 0x00, 0x01, 0x01, 0x80, 0xB3,
+  0x00, 0x01, 0x01, 0x80, 0x89, 0x00, 0x85, 0x00, 0x00, 0x07, 0x82, 0x00, 0x02, 0x80, 0x00, 0x06,
+  0x91, 0x00, 0x09, 0x40, 0x00, 0x01, 0x20, 0x00, 0x01, 0x20, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00,
+  0x06, 0x82, 0x00, 0x02, 0x80, 0x00, 0x07, 0x8A, 0x00, 0x97, 0x00, 0x10, 0x0E, 0x00, 0x00, 0x11,
+  0x18, 0x00, 0x24, 0xA0, 0x00, 0x0A, 0x48, 0x00, 0x31, 0x10, 0x00, 0x00, 0xE0, 0x9E, 0x00,
+};
+
+static const uint16_t Font24_Rle_Index[] =
+{
+  0, 2, 28, 45, 78, 133, 183, 228, 244, 286, 328, 359,
+  381, 405, 417, 429, 482, 516, 543, 593, 639, 682, 722, 769,
+  814, 860, 907, 929, 959, 1004, 1026, 1071, 1114, 1168, 1214, 1257,
+  1296, 1331, 1374, 1413, 1458, 1490, 1512, 1541, 1588, 1614, 1658, 1705,
+  1747, 1786, 1837, 1884, 1931, 1958, 1984, 2022, 2066, 2112, 2148, 2195,
+  2215, 2267, 2287, 2317, 2324, 2343, 2382, 2420, 2459, 2497, 2535, 2568,
+  2611, 2645, 2676, 2709, 2753, 2774, 2800, 2826, 2862, 2900, 2938, 2966,
+  3005, 3034, 3059, 3094, 3129, 3167, 3217, 3255, 3290, 3302, 3337,
+};
+
+sFONT Font24 = {
+  Font24_Rle_Table,
+  17, /* Width */
+  24, /* Height */
+  Font24_Rle_Index,
+};
+
+#endif /* FONTS_COMPRESSED */
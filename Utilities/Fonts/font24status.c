@@ -0,0 +1,125 @@
+/* Generated by fontpack.py from font24.c, do not edit. */
+#include "fonts.h"
+
+/* " %+-./0123456789:ABCDEFGHIJKLMNOPQRSTUVWXYZ", 1755 bytes, 6840 bytes as the full raw font */
+static const uint8_t Font24Status_Rle_Table[] =
+{
+  0xC7, 0x00, 0x85, 0x00, 0x0A, 0x07, 0x80, 0x00, 0x08, 0x40, 0x00, 0x13, 0x20, 0x00, 0x04, 0x80,
+  0x83, 0x00, 0x10, 0x04, 0x80, 0x00, 0x13, 0x18, 0x00, 0x08, 0x18, 0x00, 0x18, 0x10, 0x00, 0x18,
+  0xC8, 0x00, 0x01, 0x20, 0x83, 0x00, 0x0A, 0x01, 0x20, 0x00, 0x04, 0xC8, 0x00, 0x02, 0x10, 0x00,
+  0x01, 0xE0, 0x92, 0x00, 0x8B, 0x00, 0x01, 0x01, 0x80, 0x8C, 0x00, 0x01, 0x3E, 0x7C, 0x83, 0x00,
+  0x01, 0x3E, 0x7C, 0x8C, 0x00, 0x01, 0x01, 0x80, 0x95, 0x00, 0x9A, 0x00, 0x01, 0x1F, 0xF8, 0x83,
+  0x00, 0x01, 0x1F, 0xF8, 0xA4, 0x00, 0xA9, 0x00, 0x01, 0x03, 0xC0, 0x86, 0x00, 0x01, 0x03, 0xC0,
+  0x92, 0x00, 0x01, 0x00, 0x18, 0x84, 0x00, 0x09, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x10, 0x84, 0x00, 0x00, 0xA0, 0x83, 0x00, 0x01, 0x01, 0x40, 0x83, 0x00, 0x01, 0x02, 0x80,
+  0x83, 0x00, 0x00, 0x05, 0x84, 0x00, 0x09, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x04, 0x84, 0x00, 0x00, 0x18, 0x8A, 0x00, 0x85, 0x00, 0x07, 0x03, 0xC0, 0x00, 0x04, 0x20, 0x00,
+  0x0B, 0xD0, 0x83, 0x00, 0x01, 0x14, 0x28, 0x92, 0x00, 0x01, 0x14, 0x28, 0x83, 0x00, 0x07, 0x0B,
+  0xD0, 0x00, 0x04, 0x20, 0x00, 0x03, 0xC0, 0x92, 0x00, 0x86, 0x00, 0x0B, 0x80, 0x00, 0x07, 0x00,
+  0x00, 0x18, 0x00, 0x00, 0x02, 0x00, 0x00, 0x1C, 0x99, 0x00, 0x01, 0x1E, 0x78, 0x83, 0x00, 0x01,
+  0x1F, 0xF8, 0x92, 0x00, 0x85, 0x00, 0x0A, 0x07, 0xC0, 0x00, 0x18, 0x30, 0x00, 0x27, 0xC0, 0x00,
+  0x08, 0x28, 0x83, 0x00, 0x00, 0x30, 0x82, 0x00, 0x15, 0x28, 0x00, 0x00, 0x50, 0x00, 0x01, 0xA0,
+  0x00, 0x02, 0x40, 0x00, 0x05, 0x80, 0x00, 0x0A, 0x00, 0x00, 0x14, 0x00, 0x00, 0x27, 0xF8, 0x83,
+  0x00, 0x01, 0x3F, 0xF8, 0x92, 0x00, 0x85, 0x00, 0x0A, 0x03, 0xC0, 0x00, 0x0C, 0x20, 0x00, 0x03,
+  0x90, 0x00, 0x0C, 0x40, 0x84, 0x00, 0x0C, 0x50, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x03,
+  0x90, 0x00, 0x00, 0x68, 0x86, 0x00, 0x0A, 0x18, 0x20, 0x00, 0x07, 0xC8, 0x00, 0x10, 0x30, 0x00,
+  0x0F, 0xC0, 0x92, 0x00, 0x86, 0x00, 0x02, 0xE0, 0x00, 0x01, 0x84, 0x00, 0x03, 0x02, 0x80, 0x00,
+  0x05, 0x84, 0x00, 0x00, 0x0A, 0x84, 0x00, 0x07, 0x14, 0x00, 0x00, 0x28, 0x00, 0x00, 0x0F, 0x98,
+  0x83, 0x00, 0x04, 0x3F, 0x98, 0x00, 0x03, 0x98, 0x83, 0x00, 0x01, 0x03, 0xF8, 0x92, 0x00, 0x85,
+  0x00, 0x01, 0x1F, 0xF0, 0x83, 0x00, 0x01, 0x07, 0xF0, 0x86, 0x00, 0x0A, 0x03, 0xC0, 0x00, 0x04,
+  0x30, 0x00, 0x03, 0xC0, 0x00, 0x1C, 0x28, 0x89, 0x00, 0x0A, 0x30, 0x28, 0x00, 0x0F, 0xC0, 0x00,
+  0x30, 0x30, 0x00, 0x0F, 0xC0, 0x92, 0x00, 0x86, 0x00, 0x1B, 0xF8, 0x00, 0x03, 0x00, 0x00, 0x04,
+  0xF8, 0x00, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x04, 0x30,
+  0x00, 0x03, 0xC0, 0x00, 0x04, 0x28, 0x86, 0x00, 0x0A, 0x14, 0x20, 0x00, 0x03, 0xC8, 0x00, 0x0C,
+  0x10, 0x00, 0x03, 0xE0, 0x92, 0x00, 0x85, 0x00, 0x01, 0x1F, 0xF8, 0x83, 0x00, 0x07, 0x07, 0xE0,
+  0x00, 0x00, 0x20, 0x00, 0x18, 0x08, 0x84, 0x00, 0x03, 0x40, 0x00, 0x00, 0x10, 0x84, 0x00, 0x03,
+  0x80, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x40, 0x83, 0x00, 0x01, 0x01,
+  0x80, 0x92, 0x00, 0x85, 0x00, 0x0A, 0x07, 0xE0, 0x00, 0x08, 0x10, 0x00, 0x13, 0xC8, 0x00, 0x04,
+  0x20, 0x83, 0x00, 0x04, 0x14, 0x28, 0x00, 0x0B, 0xD0, 0x83, 0x00, 0x04, 0x0B, 0xD0, 0x00, 0x14,
+  0x28, 0x86, 0x00, 0x0A, 0x04, 0x20, 0x00, 0x13, 0xC8, 0x00, 0x08, 0x10, 0x00, 0x07, 0xE0, 0x92,
+  0x00, 0x85, 0x00, 0x0A, 0x07, 0xC0, 0x00, 0x08, 0x30, 0x00, 0x13, 0xC0, 0x00, 0x04, 0x28, 0x86,
+  0x00, 0x1B, 0x14, 0x20, 0x00, 0x03, 0xC0, 0x00, 0x0C, 0x20, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x28,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x90, 0x00, 0x1F, 0x20, 0x00, 0x00, 0xC0, 0x00, 0x1F, 0x93, 0x00,
+  0x91, 0x00, 0x01, 0x03, 0xC0, 0x86, 0x00, 0x01, 0x03, 0xC0, 0x8C, 0x00, 0x01, 0x03, 0xC0, 0x86,
+  0x00, 0x01, 0x03, 0xC0, 0x92, 0x00, 0x88, 0x00, 0x0A, 0x1F, 0x80, 0x00, 0x00, 0x40, 0x00, 0x1E,
+  0x00, 0x00, 0x02, 0xA0, 0x83, 0x00, 0x01, 0x05, 0x50, 0x83, 0x00, 0x10, 0x0A, 0x00, 0x00, 0x03,
+  0xC8, 0x00, 0x10, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x28, 0x00, 0x00, 0xCC, 0x73, 0x83, 0x00, 0x01,
+  0xFC, 0x7F, 0x92, 0x00, 0x88, 0x00, 0x0A, 0x7F, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x67, 0xC8, 0x00,
+  0x00, 0x20, 0x84, 0x00, 0x0C, 0x20, 0x00, 0x07, 0xC8, 0x00, 0x00, 0x08, 0x00, 0x07, 0xE4, 0x00,
+  0x00, 0x10, 0x86, 0x00, 0x07, 0x67, 0xF4, 0x00, 0x00, 0x08, 0x00, 0x7F, 0xF0, 0x92, 0x00, 0x88,
+  0x00, 0x0C, 0x03, 0xEC, 0x00, 0x0C, 0x10, 0x00, 0x13, 0xE0, 0x00, 0x04, 0x10, 0x00, 0x28, 0x82,
+  0x00, 0x00, 0x0C, 0x8C, 0x00, 0x0D, 0x28, 0x0C, 0x00, 0x04, 0x10, 0x00, 0x13, 0xE4, 0x00, 0x0C,
+  0x08, 0x00, 0x03, 0xF0, 0x92, 0x00, 0x88, 0x00, 0x0D, 0x7F, 0xC0, 0x00, 0x00, 0x30, 0x00, 0x67,
+  0xC8, 0x00, 0x00, 0x20, 0x00, 0x00, 0x14, 0x90, 0x00, 0x0C, 0x14, 0x00, 0x00, 0x20, 0x00, 0x67,
+  0xC8, 0x00, 0x00, 0x10, 0x00, 0x7F, 0xE0, 0x92, 0x00, 0x88, 0x00, 0x01, 0x7F, 0xF8, 0x83, 0x00,
+  0x01, 0x67, 0xE0, 0x83, 0x00, 0x06, 0x01, 0x80, 0x00, 0x00, 0x18, 0x00, 0x06, 0x84, 0x00, 0x00,
+  0x06, 0x82, 0x00, 0x03, 0x18, 0x00, 0x01, 0x80, 0x83, 0x00, 0x01, 0x67, 0xE0, 0x83, 0x00, 0x01,
+  0x7F, 0xF8, 0x92, 0x00, 0x88, 0x00, 0x01, 0x3F, 0xFC, 0x83, 0x00, 0x01, 0x33, 0xF0, 0x84, 0x00,
+  0x05, 0xC0, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x84, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0xC0, 0x83,
+  0x00, 0x01, 0x33, 0xC0, 0x83, 0x00, 0x01, 0x3F, 0xC0, 0x92, 0x00, 0x88, 0x00, 0x0C, 0x03, 0xEC,
+  0x00, 0x0C, 0x10, 0x00, 0x13, 0xE0, 0x00, 0x04, 0x10, 0x00, 0x28, 0x82, 0x00, 0x00, 0x0C, 0x84,
+  0x00, 0x00, 0xFE, 0x84, 0x00, 0x0F, 0xF2, 0x00, 0x08, 0x00, 0x00, 0x24, 0x10, 0x00, 0x13, 0xE0,
+  0x00, 0x0C, 0x0C, 0x00, 0x03, 0xF0, 0x92, 0x00, 0x88, 0x00, 0x01, 0x7E, 0x7E, 0x83, 0x00, 0x01,
+  0x66, 0x66, 0x89, 0x00, 0x01, 0x07, 0xE0, 0x83, 0x00, 0x01, 0x07, 0xE0, 0x89, 0x00, 0x01, 0x66,
+  0x66, 0x83, 0x00, 0x01, 0x7E, 0x7E, 0x92, 0x00, 0x88, 0x00, 0x01, 0x1F, 0xF8, 0x83, 0x00, 0x01,
+  0x1E, 0x78, 0x9B, 0x00, 0x01, 0x1E, 0x78, 0x83, 0x00, 0x01, 0x1F, 0xF8, 0x92, 0x00, 0x88, 0x00,
+  0x01, 0x07, 0xFE, 0x83, 0x00, 0x01, 0x07, 0xCE, 0x8C, 0x00, 0x00, 0x30, 0x8B, 0x00, 0x09, 0x50,
+  0x00, 0x0F, 0x80, 0x00, 0x30, 0x60, 0x00, 0x0F, 0x80, 0x92, 0x00, 0x88, 0x00, 0x01, 0x7F, 0x3E,
+  0x83, 0x00, 0x1F, 0x67, 0x0E, 0x00, 0x00, 0x50, 0x00, 0x00, 0xA0, 0x00, 0x01, 0x40, 0x00, 0x02,
+  0x00, 0x00, 0x04, 0x40, 0x00, 0x03, 0x20, 0x00, 0x04, 0x90, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08,
+  0x00, 0x67, 0x27, 0x83, 0x00, 0x01, 0x7F, 0x1F, 0x92, 0x00, 0x88, 0x00, 0x01, 0x7F, 0x80, 0x83,
+  0x00, 0x01, 0x73, 0x80, 0x90, 0x00, 0x00, 0x0C, 0x89, 0x00, 0x01, 0x73, 0xF0, 0x83, 0x00, 0x01,
+  0x7F, 0xFC, 0x92, 0x00, 0x88, 0x00, 0x0A, 0xF0, 0x0F, 0x00, 0x08, 0x10, 0x00, 0xC0, 0x03, 0x00,
+  0x04, 0x20, 0x83, 0x00, 0x01, 0x0A, 0x50, 0x83, 0x00, 0x01, 0x05, 0xA0, 0x83, 0x00, 0x04, 0x02,
+  0x40, 0x00, 0x01, 0x80, 0x83, 0x00, 0x01, 0xCE, 0x73, 0x83, 0x00, 0x01, 0xFE, 0x7F, 0x92, 0x00,
+  0x88, 0x00, 0x01, 0x78, 0xFE, 0x83, 0x00, 0x09, 0x64, 0xE6, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x04, 0x82, 0x00, 0x05, 0x80, 0x00, 0x02, 0x40, 0x00, 0x01, 0x82, 0x00, 0x09, 0x20, 0x00,
+  0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x67, 0x20, 0x83, 0x00, 0x01, 0x7F, 0x18, 0x92, 0x00, 0x88,
+  0x00, 0x10, 0x03, 0xC0, 0x00, 0x0C, 0x30, 0x00, 0x13, 0xC8, 0x00, 0x04, 0x20, 0x00, 0x20, 0x04,
+  0x00, 0x08, 0x10, 0x89, 0x00, 0x10, 0x08, 0x10, 0x00, 0x20, 0x04, 0x00, 0x04, 0x20, 0x00, 0x13,
+  0xC8, 0x00, 0x0C, 0x30, 0x00, 0x03, 0xC0, 0x92, 0x00, 0x88, 0x00, 0x0A, 0x3F, 0xF0, 0x00, 0x00,
+  0x08, 0x00, 0x33, 0xE4, 0x00, 0x00, 0x10, 0x87, 0x00, 0x09, 0x14, 0x00, 0x03, 0xE0, 0x00, 0x00,
+  0x18, 0x00, 0x03, 0xE0, 0x86, 0x00, 0x01, 0x33, 0xC0, 0x83, 0x00, 0x01, 0x3F, 0xC0, 0x92, 0x00,
+  0x88, 0x00, 0x10, 0x03, 0xC0, 0x00, 0x0C, 0x30, 0x00, 0x13, 0xC8, 0x00, 0x04, 0x20, 0x00, 0x20,
+  0x04, 0x00, 0x08, 0x10, 0x89, 0x00, 0x19, 0x08, 0x10, 0x00, 0x20, 0x04, 0x00, 0x04, 0x20, 0x00,
+  0x13, 0xC8, 0x00, 0x08, 0x30, 0x00, 0x00, 0x0C, 0x00, 0x08, 0x30, 0x00, 0x03, 0xC4, 0x00, 0x0C,
+  0x38, 0x89, 0x00, 0x88, 0x00, 0x0A, 0x7F, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x67, 0xC8, 0x00, 0x00,
+  0x20, 0x84, 0x00, 0x1B, 0x20, 0x00, 0x07, 0xC8, 0x00, 0x00, 0x30, 0x00, 0x07, 0x20, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00, 0x67, 0x26, 0x00, 0x00, 0x10, 0x00, 0x7F, 0x0E,
+  0x92, 0x00, 0x88, 0x00, 0x0A, 0x07, 0xD8, 0x00, 0x08, 0x20, 0x00, 0x13, 0xC0, 0x00, 0x04, 0x20,
+  0x83, 0x00, 0x0D, 0x06, 0x18, 0x00, 0x11, 0xC0, 0x00, 0x0C, 0x30, 0x00, 0x03, 0x88, 0x00, 0x18,
+  0x60, 0x83, 0x00, 0x0A, 0x04, 0x20, 0x00, 0x03, 0xC8, 0x00, 0x04, 0x10, 0x00, 0x1B, 0xE0, 0x92,
+  0x00, 0x88, 0x00, 0x01, 0x3F, 0xFC, 0x83, 0x00, 0x01, 0x0E, 0x70, 0x89, 0x00, 0x01, 0x30, 0x0C,
+  0x8F, 0x00, 0x01, 0x0E, 0x70, 0x83, 0x00, 0x01, 0x0F, 0xF0, 0x92, 0x00, 0x88, 0x00, 0x01, 0x7E,
+  0x7E, 0x83, 0x00, 0x01, 0x66, 0x66, 0x98, 0x00, 0x0A, 0x14, 0x28, 0x00, 0x03, 0xC0, 0x00, 0x0C,
+  0x30, 0x00, 0x03, 0xC0, 0x92, 0x00, 0x88, 0x00, 0x01, 0x7F, 0x7F, 0x83, 0x00, 0x04, 0x67, 0x73,
+  0x00, 0x14, 0x14, 0x86, 0x00, 0x01, 0x0A, 0x28, 0x83, 0x00, 0x01, 0x05, 0x50, 0x86, 0x00, 0x01,
+  0x02, 0xA0, 0x83, 0x00, 0x04, 0x01, 0x40, 0x00, 0x00, 0x80, 0x92, 0x00, 0x88, 0x00, 0x02, 0xFE,
+  0x3F, 0x80, 0x82, 0x00, 0x02, 0xCE, 0x39, 0x80, 0x83, 0x00, 0x03, 0x80, 0x00, 0x29, 0x4A, 0x83,
+  0x00, 0x01, 0x02, 0xA0, 0x83, 0x00, 0x04, 0x05, 0x10, 0x00, 0x10, 0x44, 0x83, 0x00, 0x01, 0x02,
+  0x20, 0x83, 0x00, 0x01, 0x0C, 0x18, 0x92, 0x00, 0x88, 0x00, 0x01, 0x7E, 0x7E, 0x83, 0x00, 0x0D,
+  0x66, 0x66, 0x00, 0x14, 0x28, 0x00, 0x0A, 0x50, 0x00, 0x05, 0xA0, 0x00, 0x02, 0x40, 0x83, 0x00,
+  0x0D, 0x02, 0x40, 0x00, 0x05, 0xA0, 0x00, 0x0A, 0x50, 0x00, 0x14, 0x28, 0x00, 0x66, 0x66, 0x83,
+  0x00, 0x01, 0x7E, 0x7E, 0x92, 0x00, 0x88, 0x00, 0x01, 0x7C, 0x7E, 0x83, 0x00, 0x07, 0x64, 0x66,
+  0x00, 0x14, 0x28, 0x00, 0x0A, 0x50, 0x83, 0x00, 0x04, 0x05, 0xA0, 0x00, 0x02, 0x40, 0x8C, 0x00,
+  0x01, 0x0E, 0x70, 0x83, 0x00, 0x01, 0x0F, 0xF0, 0x92, 0x00, 0x88, 0x00, 0x01, 0x1F, 0xF8, 0x83,
+  0x00, 0x1F, 0x07, 0xE0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x50, 0x00, 0x00, 0xA0, 0x00, 0x19, 0x40,
+  0x00, 0x02, 0x80, 0x00, 0x05, 0x18, 0x00, 0x0A, 0x00, 0x00, 0x14, 0x00, 0x00, 0x28, 0x00, 0x00,
+  0x0F, 0xE0, 0x83, 0x00, 0x01, 0x3F, 0xF8, 0x92, 0x00,
+};
+
+static const uint16_t Font24Status_Rle_Index[] =
+{
+  0, 2, 52, 74, 86, 98, 151, 185, 212, 262, 308, 351,
+  391, 438, 483, 529, 576, 598, 644, 687, 726, 761, 804, 843,
+  888, 920, 942, 971, 1018, 1044, 1088, 1135, 1177, 1216, 1267, 1314,
+  1361, 1388, 1414, 1452, 1496, 1542, 1578,
+};
+
+sFONT Font24Status = {
+  Font24Status_Rle_Table,
+  17, /* Width */
+  24, /* Height */
+  Font24Status_Rle_Index,
+  " %+-./0123456789:ABCDEFGHIJKLMNOPQRSTUVWXYZ", /* Characters */
+};
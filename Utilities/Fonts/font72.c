@@ -1,5 +1,8 @@
 #include "fonts.h"
 
+/* packed copy in font72_rle.c, see fontpack.py */
+#if !defined(FONTS_COMPRESSED)
+
 const uint8_t Font72_Table [] = 
 {
        
@@ -7130,4 +7133,6 @@ sFONT Font72 = {
   72, /* Height */
 };
 
+#endif /* FONTS_COMPRESSED */
+
 
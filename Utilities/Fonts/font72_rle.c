@@ -0,0 +1,54 @@
+/* Generated by fontpack.py from font72.c, do not edit. */
+#include "fonts.h"
+
+#if defined(FONTS_COMPRESSED)
+
+/* 572 bytes, 47880 bytes as raw bitmaps */
+static const uint8_t Font72_Rle_Table[] =
+{
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF7, 0x00, 0xFF, 0x00, 0xF7, 0x00, 0x00, 0x3F, 0x93, 0x00,
+  0x00, 0x3F, 0xFF, 0x00, 0xE9, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0x0E, 0x93, 0x00,
+  0x00, 0x0E, 0xE4, 0x00, 0xC7, 0x00, 0x01, 0x3F, 0xFE, 0x99, 0x00, 0x01, 0x07, 0xF0, 0xFF, 0x00,
+  0xFF, 0x00, 0x95, 0x00, 0x01, 0x07, 0xF0, 0x92, 0x00, 0x01, 0x3F, 0xFE, 0xE4, 0x00, 0xC8, 0x00,
+  0x00, 0x0E, 0xFF, 0x00, 0xFF, 0x00, 0xC7, 0x00, 0x00, 0x0E, 0xE4, 0x00, 0xC7, 0x00, 0x01, 0x3F,
+  0xFE, 0x99, 0x00, 0x01, 0x3F, 0xF0, 0xFB, 0x00, 0x01, 0x3F, 0xF0, 0x99, 0x00, 0x01, 0x07, 0xFE,
+  0xFB, 0x00, 0x01, 0x07, 0xFE, 0x92, 0x00, 0x01, 0x3F, 0xFE, 0xE4, 0x00, 0xC7, 0x00, 0x01, 0x3F,
+  0xFE, 0x99, 0x00, 0x01, 0x3F, 0xF0, 0xFB, 0x00, 0x01, 0x3F, 0xF0, 0x99, 0x00, 0x01, 0x3F, 0xF0,
+  0xFB, 0x00, 0x01, 0x3F, 0xF0, 0x92, 0x00, 0x01, 0x3F, 0xFE, 0xE4, 0x00, 0xC8, 0x00, 0x00, 0x0E,
+  0x85, 0x00, 0x00, 0x10, 0x8C, 0x00, 0x00, 0x20, 0x85, 0x00, 0x00, 0x10, 0x85, 0x00, 0x00, 0x40,
+  0x85, 0x00, 0x00, 0x20, 0x85, 0x00, 0x00, 0x80, 0x85, 0x00, 0x00, 0x40, 0x84, 0x00, 0x00, 0x01,
+  0x86, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x04,
+  0x85, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x08, 0x85, 0x00, 0x00, 0x04, 0x85, 0x00, 0x00, 0x10,
+  0x85, 0x00, 0x00, 0x08, 0x85, 0x00, 0x00, 0x20, 0x85, 0x00, 0x00, 0x10, 0x8C, 0x00, 0x01, 0x1F,
+  0xF0, 0x99, 0x00, 0x01, 0x3F, 0xF0, 0xFF, 0x00, 0x91, 0x00, 0x00, 0x0E, 0xE4, 0x00, 0xC7, 0x00,
+  0x01, 0x3F, 0xFE, 0x99, 0x00, 0x01, 0x07, 0xFE, 0xFB, 0x00, 0x01, 0x07, 0xFE, 0x99, 0x00, 0x01,
+  0x3F, 0xF0, 0xFB, 0x00, 0x01, 0x3F, 0xF0, 0x92, 0x00, 0x01, 0x3F, 0xFE, 0xE4, 0x00, 0xC7, 0x00,
+  0x01, 0x3F, 0xFE, 0x99, 0x00, 0x01, 0x07, 0xFE, 0xFB, 0x00, 0x01, 0x07, 0xFE, 0x99, 0x00, 0x01,
+  0x07, 0xF0, 0xFB, 0x00, 0x01, 0x07, 0xF0, 0x92, 0x00, 0x01, 0x3F, 0xFE, 0xE4, 0x00, 0xC7, 0x00,
+  0x01, 0x3F, 0xFE, 0x99, 0x00, 0x01, 0x3F, 0xF0, 0xFF, 0x00, 0xFF, 0x00, 0xAB, 0x00, 0x00, 0x0E,
+  0xE4, 0x00, 0xC7, 0x00, 0x01, 0x3F, 0xFE, 0x99, 0x00, 0x01, 0x07, 0xF0, 0xFB, 0x00, 0x01, 0x07,
+  0xF0, 0x99, 0x00, 0x01, 0x07, 0xF0, 0xFB, 0x00, 0x01, 0x07, 0xF0, 0x92, 0x00, 0x01, 0x3F, 0xFE,
+  0xE4, 0x00, 0xC7, 0x00, 0x01, 0x3F, 0xFE, 0x99, 0x00, 0x01, 0x07, 0xF0, 0xFB, 0x00, 0x01, 0x07,
+  0xF0, 0x99, 0x00, 0x01, 0x3F, 0xF0, 0xFF, 0x00, 0x91, 0x00, 0x00, 0x0E, 0xE4, 0x00,
+};
+
+static const uint16_t Font72_Rle_Index[] =
+{
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 8, 22, 0, 36, 62, 76, 108, 140, 238, 270, 302,
+  322, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+sFONT Font72 = {
+  Font72_Rle_Table,
+  51, /* Width */
+  72, /* Height */
+  Font72_Rle_Index,
+};
+
+#endif /* FONTS_COMPRESSED */
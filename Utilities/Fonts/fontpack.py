@@ -0,0 +1,250 @@
+#!/usr/bin/env python
+"""
+fontpack.py - font compiler for the epd1in54 sFONT tables.
+
+Reads a raw bitmap font source (font8.c ... font72.c) and writes a
+compressed copy of it (fontNN_rle.c) that Epd::DrawCharAt expands at
+draw time. The raw sources stay the reference, the packed files are
+only built when FONTS_COMPRESSED is defined.
+
+Each glyph is stored as its rows XORed with the row above (so repeated
+rows become zeros), run-length coded with a one byte header:
+    0x00-0x7F  n+1 literal bytes follow
+    0x80-0xFF  the next byte is repeated (n & 0x7F)+1 times
+A per-glyph offset index lets the decoder start at any character,
+identical glyphs (blanks mostly) share one packed copy. Fonts that do
+not get smaller are left alone.
+
+With --subsets, every line of the given file declares a subset font:
+    <source.c> <name> "<characters>"
+and <name>.c (lower case) is written holding only those glyphs, plus a
+sFONT.charmap string DrawCharAt uses to find them. Subset fonts are
+packed the same way when that makes them smaller, and every glyph is
+checked against the full font before the file is written.
+
+Usage: python fontpack.py font72.c [font24.c ...]
+       python fontpack.py --subsets subsets.txt
+"""
+
+import os
+import re
+import shlex
+import sys
+
+MAX_GLYPH_WIDTH = 64
+MAX_RUN = 128
+
+
+def parse_font(path):
+    with open(path) as f:
+        text = f.read()
+    text = re.sub(r'//[^\n]*', '', text)
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    table = re.search(r'const\s+uint8_t\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};', text, re.S)
+    font = re.search(r'sFONT\s+(\w+)\s*=\s*\{\s*(\w+)\s*,\s*(\d+)\s*,\s*(\d+)', text)
+    if table is None or font is None:
+        raise ValueError('%s: no sFONT table found' % path)
+    data = [int(b, 16) for b in re.findall(r'0x([0-9A-Fa-f]{1,2})', table.group(2))]
+    return font.group(1), int(font.group(3)), int(font.group(4)), data
+
+
+def split_glyphs(data, width, height):
+    row_bytes = (width + 7) // 8
+    glyph_size = row_bytes * height
+    count = len(data) // glyph_size
+    return row_bytes, [data[i * glyph_size:(i + 1) * glyph_size] for i in range(count)]
+
+
+def delta_rows(glyph, row_bytes):
+    out = []
+    prev = [0] * row_bytes
+    for r in range(0, len(glyph), row_bytes):
+        row = glyph[r:r + row_bytes]
+        out.extend(a ^ b for a, b in zip(row, prev))
+        prev = row
+    return out
+
+
+def rle(data):
+    out = []
+    literals = []
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < MAX_RUN and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            if literals:
+                out.append(len(literals) - 1)
+                out.extend(literals)
+                literals = []
+            out.extend([0x80 | (run - 1), data[i]])
+            i += run
+        else:
+            literals.append(data[i])
+            i += 1
+            if len(literals) == MAX_RUN:
+                out.append(len(literals) - 1)
+                out.extend(literals)
+                literals = []
+    if literals:
+        out.append(len(literals) - 1)
+        out.extend(literals)
+    return out
+
+
+def unrle(data, length):
+    out = []
+    i = 0
+    while len(out) < length:
+        c = data[i]
+        if c & 0x80:
+            out.extend([data[i + 1]] * ((c & 0x7F) + 1))
+            i += 2
+        else:
+            out.extend(data[i + 1:i + 2 + c])
+            i += c + 2
+    return out[:length]
+
+
+def pack(name, width, height, data):
+    if width > MAX_GLYPH_WIDTH:
+        raise ValueError('%s: glyphs wider than %d pixels are not supported' % (name, MAX_GLYPH_WIDTH))
+    row_bytes, glyphs = split_glyphs(data, width, height)
+    table = []
+    index = []
+    seen = {}
+    for glyph in glyphs:
+        packed = rle(delta_rows(glyph, row_bytes))
+        # the decoder reads the stream as it goes, make sure it round trips
+        if unrle(packed, len(glyph)) != delta_rows(glyph, row_bytes):
+            raise ValueError('%s: glyph %d does not round trip' % (name, len(index)))
+        key = tuple(packed)
+        if key not in seen:
+            seen[key] = len(table)
+            table.extend(packed)
+        index.append(seen[key])
+    if len(table) > 0xFFFF:
+        raise ValueError('%s: packed table exceeds 64 KB' % name)
+    return table, index
+
+
+def c_string(chars):
+    return '"' + ''.join('\\' + c if c in '"\\' else c for c in chars) + '"'
+
+
+def emit(out, source, name, width, height, table, index, raw_size, charmap=None, guard=None):
+    """Writes a sFONT. index is None for raw bitmaps, charmap None for full fonts."""
+    lines = []
+    lines.append('/* Generated by fontpack.py from %s, do not edit. */' % os.path.basename(source))
+    lines.append('#include "fonts.h"')
+    lines.append('')
+    if guard:
+        lines.append('#if defined(%s)' % guard)
+        lines.append('')
+    size = len(table) + (2 * len(index) if index is not None else 0)
+    suffix = '_Rle' if index is not None else ''
+    if charmap is not None:
+        size += len(charmap) + 1
+        lines.append('/* %s, %d bytes, %d bytes as the full raw font */' % (c_string(charmap), size, raw_size))
+    else:
+        lines.append('/* %d bytes, %d bytes as raw bitmaps */' % (size, raw_size))
+    lines.append('static const uint8_t %s%s_Table[] =' % (name, suffix))
+    lines.append('{')
+    for i in range(0, len(table), 16):
+        lines.append('  ' + ', '.join('0x%02X' % b for b in table[i:i + 16]) + ',')
+    lines.append('};')
+    lines.append('')
+    if index is not None:
+        lines.append('static const uint16_t %s_Rle_Index[] =' % name)
+        lines.append('{')
+        for i in range(0, len(index), 12):
+            lines.append('  ' + ', '.join('%d' % o for o in index[i:i + 12]) + ',')
+        lines.append('};')
+        lines.append('')
+    lines.append('sFONT %s = {' % name)
+    lines.append('  %s%s_Table,' % (name, suffix))
+    lines.append('  %d, /* Width */' % width)
+    lines.append('  %d, /* Height */' % height)
+    if index is not None or charmap is not None:
+        lines.append('  %s,' % ('%s_Rle_Index' % name if index is not None else 'NULL'))
+    if charmap is not None:
+        lines.append('  %s, /* Characters */' % c_string(charmap))
+    lines.append('};')
+    if guard:
+        lines.append('')
+        lines.append('#endif /* %s */' % guard)
+    with open(out, 'wb') as f:
+        f.write(('\r\n'.join(lines) + '\r\n').encode('ascii'))
+    return size
+
+
+def subset(source, name, chars):
+    """Builds a font holding only chars, checked glyph by glyph against the source."""
+    full_name, width, height, data = parse_font(source)
+    row_bytes, glyphs = split_glyphs(data, width, height)
+    charmap = ''
+    for c in chars:
+        if c in charmap:
+            continue
+        if ord(c) < 32 or ord(c) - 32 >= len(glyphs):
+            raise ValueError('%s: %s has no glyph for %r' % (name, full_name, c))
+        charmap += c
+    picked = []
+    for c in charmap:
+        picked.extend(glyphs[ord(c) - 32])
+    table, index = pack(name, width, height, picked)
+    # expand every packed glyph again and compare with the full font
+    for slot, c in enumerate(charmap):
+        glyph = glyphs[ord(c) - 32]
+        delta = unrle(table[index[slot]:], len(glyph))
+        prev = [0] * row_bytes
+        for r in range(0, len(glyph), row_bytes):
+            prev = [a ^ b for a, b in zip(delta[r:r + row_bytes], prev)]
+            if prev != glyph[r:r + row_bytes]:
+                raise ValueError('%s: glyph %r differs from %s' % (name, c, full_name))
+    out = os.path.join(os.path.dirname(source), name.lower() + '.c')
+    if len(table) + 2 * len(index) < len(picked):
+        size = emit(out, source, name, width, height, table, index, len(data), charmap)
+    else:
+        size = emit(out, source, name, width, height, picked, None, len(data), charmap)
+    print('%s: %s %d -> %d bytes (%.0f%%) -> %s' % (name, full_name, len(data), size,
+                                                    100.0 * size / len(data), out))
+
+
+def subsets(path):
+    base = os.path.dirname(path)
+    with open(path) as f:
+        for line in f:
+            fields = shlex.split(line, comments=True)
+            if not fields:
+                continue
+            if len(fields) != 3:
+                raise ValueError('%s: expected <source.c> <name> "<characters>": %s' % (path, line.strip()))
+            subset(os.path.join(base, fields[0]), fields[1], fields[2])
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+    if argv[1] == '--subsets':
+        for path in argv[2:]:
+            subsets(path)
+        return 0
+    for path in argv[1:]:
+        name, width, height, data = parse_font(path)
+        table, index = pack(name, width, height, data)
+        packed_size = len(table) + 2 * len(index)
+        if packed_size >= len(data):
+            print('%s: %d -> %d bytes, kept raw' % (name, len(data), packed_size))
+            continue
+        out = os.path.splitext(path)[0] + '_rle.c'
+        emit(out, path, name, width, height, table, index, len(data), guard='FONTS_COMPRESSED')
+        print('%s: %d -> %d bytes (%.0f%%) -> %s' % (name, len(data), packed_size,
+                                                      100.0 * packed_size / len(data), out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -56,6 +56,8 @@ typedef struct _tFont
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  const uint16_t *index;    /* glyph offsets of a packed table (fontpack.py), NULL for raw bitmaps */
+  const char *charmap;      /* characters of a subset font in table order, NULL when all of ' ' to '~' are present */
   
 } sFONT;
 extern sFONT Font72;
@@ -65,6 +67,10 @@ extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+/* Subset fonts, see Utilities/Fonts/subsets.txt */
+extern sFONT Font72Digits;
+extern sFONT Font24Status;
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,8 +20,10 @@
 #include "API/ConnectionManager.h"
 #include "API/LocationManager.h"
 #include "API/LogManager.h"
+#include "API/ModemArbiter.h"
 #include "LowPowerTicker.h"
 #include "MbedJSONValue.h"
+#include "azure_c_shared_utility/azure_c_shared_utility/gballoc.h"
 
 #define CONNECT_PERIOD_IN_SECONDS 120
 #define GNSS_PERIOD_IN_SECONDS 60
@@ -36,12 +38,12 @@ time_t latest_connect_time;
 time_t target_gnss_timeout;
 
 LowPowerTicker halfminuteticker;
-static Mutex bg96mutex;
+static ModemArbiter bg96arbiter;
 static Mutex appmutex;
 static BG96Interface bg96;
-static ConnectionManager conn_m(&bg96, &bg96mutex);
-static LocationManager loc_m(&bg96, &bg96mutex);
-static LogManager log_m(&bg96, &bg96mutex);
+static ConnectionManager conn_m(&bg96, &bg96arbiter);
+static LocationManager loc_m(&bg96, &bg96arbiter);
+static LogManager log_m(&bg96, &bg96arbiter);
 static AppManager app_m(&conn_m,
                  &loc_m,
                  &log_m);
@@ -184,6 +186,8 @@ void checkAppInitialize(std::string &message, TaskParameter &param)
 
 void app_run(void) {
     initialized = false;
+    // counts the allocations of the azure utilities for the heap stats, does nothing without GB_DEBUG_ALLOC
+    (void)gballoc_init();
     /*printf("First test json parser\r\n");
     std::string json_string = "{\"my_array\": [\"demo_string\", 10], \"my_boolean\": true}";
     char json_buf[80];
@@ -76,6 +76,36 @@ MOCKABLE_FUNCTION(, STRING_HANDLE, Base64_Encode_Bytes, const unsigned char*, so
  */
 MOCKABLE_FUNCTION(, BUFFER_HANDLE, Base64_Decoder, const char*, source);
 
+/**
+ * @brief	Base64 encodes @p size bytes of @p source into a caller provided buffer.
+ *
+ * @param	source	         The bytes to encode, may be @c NULL when @p size is zero.
+ * @param	size  	         The number of bytes to encode.
+ * @param	destination	     Receives the encoding and a terminating @c '\0'.
+ * @param	destinationSize  The size of @p destination, at least 4 * ceil(@p size / 3) + 1.
+ *
+ * 			Nothing is allocated. If @p destination is @c NULL or too small, nothing is written.
+ *
+ * @return	0 on success, a non-zero value otherwise.
+ */
+MOCKABLE_FUNCTION(, int, Base64_Encode_Bytes_Into, const unsigned char*, source, size_t, size, char*, destination, size_t, destinationSize);
+
+/**
+ * @brief	Base64 decodes the string pointed to by @p source into a caller provided buffer.
+ *
+ * @param	source	         A base64 encoded string, its length a multiple of 4.
+ * @param	destination	     Receives the decoded bytes.
+ * @param	destinationSize  The size of @p destination.
+ * @param	decodedSize      Receives the number of decoded bytes.
+ *
+ * 			Decodes the same way as @c Base64_Decoder without allocating a @c BUFFER. If
+ * 			@p source has an invalid length or the decoding does not fit in @p destination,
+ * 			nothing is written.
+ *
+ * @return	0 on success, a non-zero value otherwise.
+ */
+MOCKABLE_FUNCTION(, int, Base64_Decode_Into, const char*, source, unsigned char*, destination, size_t, destinationSize, size_t*, decodedSize);
+
 #ifdef __cplusplus
 }
 #endif
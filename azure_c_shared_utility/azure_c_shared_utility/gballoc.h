@@ -16,7 +16,83 @@ extern "C"
 #include <stdlib.h>
 #endif
 
+/* tracked allocations are counted per size class: class 0 holds sizes up to GBALLOC_SMALLEST_SIZE_CLASS bytes,
+every following class doubles the limit and the last one holds everything bigger */
+#if !defined(GBALLOC_SIZE_CLASS_COUNT)
+#define GBALLOC_SIZE_CLASS_COUNT 12
+#endif
+#if !defined(GBALLOC_SMALLEST_SIZE_CLASS)
+#define GBALLOC_SMALLEST_SIZE_CLASS 16
+#endif
+
+typedef struct GBALLOC_SIZE_CLASS_STATS_TAG
+{
+    size_t maximumSize;     /* biggest size in the class, SIZE_MAX for the last one */
+    size_t allocations;     /* since gballoc_init or gballoc_resetMetrics, reallocations included */
+    size_t liveBlocks;
+    size_t liveBytes;
+} GBALLOC_SIZE_CLASS_STATS;
+
+/* allocations are also counted per tag. A translation unit with GB_MEASURE_MEMORY_FOR_THIS tags its allocations with
+GBALLOC_TAG (its file name unless defined before including this header). Tags past GBALLOC_TAG_COUNT - 1 share the
+slot of the allocations made without a tag */
+#if !defined(GBALLOC_TAG_COUNT)
+#define GBALLOC_TAG_COUNT 16
+#endif
+
+typedef struct GBALLOC_TAG_STATS_TAG
+{
+    const char* tag;        /* NULL for the allocations without a tag */
+    size_t allocations;
+    size_t liveBytes;
+    size_t peakBytes;       /* highest liveBytes since gballoc_init or gballoc_resetMetrics */
+    size_t histogram[GBALLOC_SIZE_CLASS_COUNT]; /* allocations per size class */
+} GBALLOC_TAG_STATS;
+
+typedef struct GBALLOC_HEAP_STATS_TAG
+{
+    size_t currentMemoryUsed;
+    size_t maximumMemoryUsed;
+    size_t allocationCount;
+    size_t freeBytes;           /* free memory in the C library heap, 0 when the C library cannot tell */
+    size_t largestFreeBlock;    /* free block at the top of the C library heap, a lower bound of the largest one, 0 when the C library cannot tell */
+    unsigned int fragmentation; /* percent of freeBytes outside largestFreeBlock, 0 when largestFreeBlock is 0 */
+} GBALLOC_HEAP_STATS;
+
+/* with GBALLOC_USE_SLABS defined, tracked blocks up to the biggest of GBALLOC_SLAB_CLASSES (block sizes, ascending) are
+taken from per size free lists instead of malloc. The lists are filled from pages of about GBALLOC_SLAB_PAGE_SIZE
+bytes taken with malloc, a page goes back to malloc when all its blocks are free */
+#if !defined(GBALLOC_SLAB_CLASSES)
+#define GBALLOC_SLAB_CLASSES 16, 32, 48, 64
+#endif
+#if !defined(GBALLOC_SLAB_PAGE_SIZE)
+#define GBALLOC_SLAB_PAGE_SIZE 512
+#endif
+
+typedef struct GBALLOC_SLAB_STATS_TAG
+{
+    size_t blockSize;
+    size_t pages;
+    size_t blocks;
+    size_t freeBlocks;
+    size_t reservedBytes;   /* taken from malloc for the pages */
+} GBALLOC_SLAB_STATS;
+
+/* GBALLOC_EXPORT_JSON writes a 0 terminated JSON object. GBALLOC_EXPORT_BINARY writes a version byte (1) followed by
+unsigned LEB128 numbers: currentMemoryUsed, maximumMemoryUsed, allocationCount, freeBytes, largestFreeBlock,
+fragmentation, GBALLOC_SMALLEST_SIZE_CLASS, the size class count and allocations, liveBlocks, liveBytes of every class,
+then the tag count and for every tag the name length, the name bytes, liveBytes, peakBytes and the histogram */
+typedef enum GBALLOC_EXPORT_FORMAT_TAG
+{
+    GBALLOC_EXPORT_JSON,
+    GBALLOC_EXPORT_BINARY
+} GBALLOC_EXPORT_FORMAT;
+
 /* all translation units that need memory measurement need to have GB_MEASURE_MEMORY_FOR_THIS defined */
+/* a measured block starts behind a hidden header, so it must never reach the C library free or realloc: a translation
+unit that frees or reallocates memory from a measured one needs GB_MEASURE_MEMORY_FOR_THIS as well, define it for the
+whole build rather than per file. The other way round is safe, gballoc_free and gballoc_realloc hand blocks without
+the header to the C library */
 /* GB_DEBUG_ALLOC is the switch that turns the measurement on/off, so that it is not on always */
 #if defined(GB_DEBUG_ALLOC)
 
@@ -26,14 +102,25 @@ MOCKABLE_FUNCTION(, void*, gballoc_malloc, size_t, size);
 MOCKABLE_FUNCTION(, void*, gballoc_calloc, size_t, nmemb, size_t, size);
 MOCKABLE_FUNCTION(, void*, gballoc_realloc, void*, ptr, size_t, size);
 MOCKABLE_FUNCTION(, void, gballoc_free, void*, ptr);
+MOCKABLE_FUNCTION(, void*, gballoc_malloc_tagged, size_t, size, const char*, tag);
+MOCKABLE_FUNCTION(, void*, gballoc_calloc_tagged, size_t, nmemb, size_t, size, const char*, tag);
+MOCKABLE_FUNCTION(, void*, gballoc_realloc_tagged, void*, ptr, size_t, size, const char*, tag);
 
 MOCKABLE_FUNCTION(, size_t, gballoc_getMaximumMemoryUsed);
 MOCKABLE_FUNCTION(, size_t, gballoc_getCurrentMemoryUsed);
 MOCKABLE_FUNCTION(, size_t, gballoc_getAllocationCount);
 MOCKABLE_FUNCTION(, void, gballoc_resetMetrics);
+MOCKABLE_FUNCTION(, int, gballoc_getSizeClassStats, size_t, sizeClass, GBALLOC_SIZE_CLASS_STATS*, stats);
+MOCKABLE_FUNCTION(, int, gballoc_getTagStats, size_t, tagIndex, GBALLOC_TAG_STATS*, stats);
+MOCKABLE_FUNCTION(, int, gballoc_getSlabStats, size_t, slabIndex, GBALLOC_SLAB_STATS*, stats);
+MOCKABLE_FUNCTION(, int, gballoc_getHeapStats, GBALLOC_HEAP_STATS*, stats);
+MOCKABLE_FUNCTION(, size_t, gballoc_exportStats, GBALLOC_EXPORT_FORMAT, format, unsigned char*, buffer, size_t, size);
 
 /* if GB_MEASURE_MEMORY_FOR_THIS is defined then we want to redirect memory allocation functions to gballoc_xxx functions */
 #ifdef GB_MEASURE_MEMORY_FOR_THIS
+#if !defined(GBALLOC_TAG)
+#define GBALLOC_TAG __FILE__
+#endif
 /* Unfortunately this is still needed here for things to still compile when using _CRTDBG_MAP_ALLOC.
 That is because there is a rogue component (most likely CppUnitTest) including crtdbg. */
 #if defined(_CRTDBG_MAP_ALLOC) && defined(_DEBUG)
@@ -41,14 +128,14 @@ That is because there is a rogue component (most likely CppUnitTest) including c
 #undef _calloc_dbg
 #undef _realloc_dbg
 #undef _free_dbg
-#define _malloc_dbg(size, ...) gballoc_malloc(size)
-#define _calloc_dbg(nmemb, size, ...) gballoc_calloc(nmemb, size)
-#define _realloc_dbg(ptr, size, ...) gballoc_realloc(ptr, size)
+#define _malloc_dbg(size, ...) gballoc_malloc_tagged(size, GBALLOC_TAG)
+#define _calloc_dbg(nmemb, size, ...) gballoc_calloc_tagged(nmemb, size, GBALLOC_TAG)
+#define _realloc_dbg(ptr, size, ...) gballoc_realloc_tagged(ptr, size, GBALLOC_TAG)
 #define _free_dbg(ptr, ...) gballoc_free(ptr)
 #else
-#define malloc gballoc_malloc
-#define calloc gballoc_calloc
-#define realloc gballoc_realloc
+#define malloc(size) gballoc_malloc_tagged(size, GBALLOC_TAG)
+#define calloc(nmemb, size) gballoc_calloc_tagged(nmemb, size, GBALLOC_TAG)
+#define realloc(ptr, size) gballoc_realloc_tagged(ptr, size, GBALLOC_TAG)
 #define free gballoc_free
 #endif
 #endif
@@ -62,6 +149,11 @@ That is because there is a rogue component (most likely CppUnitTest) including c
 #define gballoc_getCurrentMemoryUsed() SIZE_MAX
 #define gballoc_getAllocationCount() SIZE_MAX
 #define gballoc_resetMetrics() ((void)0)
+#define gballoc_getSizeClassStats(sizeClass, stats) ((void)(sizeClass), (void)(stats), 1)
+#define gballoc_getTagStats(tagIndex, stats) ((void)(tagIndex), (void)(stats), 1)
+#define gballoc_getSlabStats(slabIndex, stats) ((void)(slabIndex), (void)(stats), 1)
+#define gballoc_getHeapStats(stats) ((void)(stats), 1)
+#define gballoc_exportStats(format, buffer, size) ((void)(format), (void)(buffer), (void)(size), (size_t)0)
 
 #endif /* GB_DEBUG_ALLOC */
 
@@ -6,6 +6,7 @@
 
 #include "azure_c_shared_utility/macro_utils.h"
 #include "azure_c_shared_utility/buffer_.h"
+#include "azure_c_shared_utility/sha.h"
 #include "azure_c_shared_utility/umock_c_prod.h"
 
 #ifdef __cplusplus
@@ -19,7 +20,26 @@ extern "C" {
 
 DEFINE_ENUM(HMACSHA256_RESULT, HMACSHA256_RESULT_VALUES)
 
+/* SHA-256 states after absorbing the key XORed with the inner and outer pads.
+   Prepared once per key, each hash then only processes the message blocks. */
+typedef struct HMACSHA256_KEY_TAG
+{
+    SHA256Context inner;
+    SHA256Context outer;
+} HMACSHA256_KEY;
+
+/* Running HMAC over a message given in pieces: Init, any number of Update
+   calls, then Final. It is a copy of the prepared key that the message is
+   absorbed into, it lives wherever the caller puts it, nothing is allocated. */
+typedef HMACSHA256_KEY HMACSHA256_CONTEXT;
+
 MOCKABLE_FUNCTION(, HMACSHA256_RESULT, HMACSHA256_ComputeHash, const unsigned char*, key, size_t, keyLen, const unsigned char*, payload, size_t, payloadLen, BUFFER_HANDLE, hash);
+MOCKABLE_FUNCTION(, HMACSHA256_RESULT, HMACSHA256_PrepareKey, HMACSHA256_KEY*, preparedKey, const unsigned char*, key, size_t, keyLen);
+MOCKABLE_FUNCTION(, HMACSHA256_RESULT, HMACSHA256_ComputeHashWithKey, const HMACSHA256_KEY*, preparedKey, const unsigned char*, payload, size_t, payloadLen, unsigned char*, hash);
+MOCKABLE_FUNCTION(, HMACSHA256_RESULT, HMACSHA256_Init, HMACSHA256_CONTEXT*, context, const unsigned char*, key, size_t, keyLen);
+MOCKABLE_FUNCTION(, HMACSHA256_RESULT, HMACSHA256_InitWithKey, HMACSHA256_CONTEXT*, context, const HMACSHA256_KEY*, preparedKey);
+MOCKABLE_FUNCTION(, HMACSHA256_RESULT, HMACSHA256_Update, HMACSHA256_CONTEXT*, context, const unsigned char*, data, size_t, dataLen);
+MOCKABLE_FUNCTION(, HMACSHA256_RESULT, HMACSHA256_Final, HMACSHA256_CONTEXT*, context, unsigned char*, hash);
 
 #ifdef __cplusplus
 }
@@ -67,6 +67,31 @@ DEFINE_ENUM(HTTPAPI_RESULT, HTTPAPI_RESULT_VALUES);
  */
 DEFINE_ENUM(HTTPAPI_REQUEST_TYPE, HTTPAPI_REQUEST_TYPE_VALUES);
 
+/** @brief Receives the response body span by span, in order, as it arrives
+ *	from the host. Chunked bodies are delivered without the chunk framing.
+ *	Returning non zero aborts the request.
+ */
+typedef int(*ON_HTTPAPI_RESPONSE_BODY)(void* context, const unsigned char* buffer, size_t size);
+
+/** @brief One request of a ::HTTPAPI_ExecuteRequests batch. The fields have
+ *	the meaning of the parameters of ::HTTPAPI_ExecuteRequest and
+ *	::HTTPAPI_ExecuteRequestToCallback. When @c onResponseBody is set,
+ *	@c responseContent is not used.
+ */
+typedef struct HTTPAPI_REQUEST_TAG
+{
+    HTTPAPI_REQUEST_TYPE requestType;
+    const char* relativePath;
+    HTTP_HEADERS_HANDLE httpHeadersHandle;
+    const unsigned char* content;
+    size_t contentLength;
+    unsigned int* statusCode;
+    HTTP_HEADERS_HANDLE responseHeadersHandle;
+    BUFFER_HANDLE responseContent;
+    ON_HTTPAPI_RESPONSE_BODY onResponseBody;
+    void* onResponseBodyContext;
+} HTTPAPI_REQUEST;
+
 #define MAX_HOSTNAME_LEN        65
 
 /**
@@ -161,6 +186,52 @@ MOCKABLE_FUNCTION(, HTTPAPI_RESULT, HTTPAPI_ExecuteRequest, HTTP_HANDLE, handle,
                                              size_t, contentLength, unsigned int*, statusCode,
                                              HTTP_HEADERS_HANDLE, responseHeadersHandle, BUFFER_HANDLE, responseContent);
 
+/**
+ * @brief	Executes an HTTP request like ::HTTPAPI_ExecuteRequest, but hands
+ * 			the response body to @p onResponseBody as it is received instead
+ * 			of collecting it in a buffer, so the memory used does not depend
+ * 			on the size of the body.
+ *
+ * @param	onResponseBody			Called with each span of the body, see
+ * 									::ON_HTTPAPI_RESPONSE_BODY. If it returns
+ * 									non zero the request fails with
+ * 									@c HTTPAPI_ERROR and the connection is
+ * 									closed.
+ * @param	onResponseBodyContext	Passed to @p onResponseBody.
+ *
+ *			The other parameters are the ones of ::HTTPAPI_ExecuteRequest.
+ *
+ * @return	@c HTTPAPI_OK if the API call is successful or an error
+ * 			code in case it fails.
+ */
+MOCKABLE_FUNCTION(, HTTPAPI_RESULT, HTTPAPI_ExecuteRequestToCallback, HTTP_HANDLE, handle, HTTPAPI_REQUEST_TYPE, requestType, const char*, relativePath,
+                                             HTTP_HEADERS_HANDLE, httpHeadersHandle, const unsigned char*, content,
+                                             size_t, contentLength, unsigned int*, statusCode,
+                                             HTTP_HEADERS_HANDLE, responseHeadersHandle, ON_HTTPAPI_RESPONSE_BODY, onResponseBody, void*, onResponseBodyContext);
+
+/**
+ * @brief	Sends several requests on the connection without waiting for
+ * 			the responses in between (HTTP/1.1 pipelining), then reads the
+ * 			responses in the order of the requests. If the host closes the
+ * 			connection after some of the responses, the remaining requests
+ * 			are sent again on a new connection when they are all GET, PUT
+ * 			or DELETE. POST and PATCH are not sent twice by this function.
+ *
+ * @param	handle			The handle to the HTTP connection created via
+ * 							::HTTPAPI_CreateConnection.
+ * @param	requests		The requests, each one as it would be passed to
+ * 							::HTTPAPI_ExecuteRequest.
+ * @param	requestCount	The number of requests, at least 1.
+ * @param	completedCount	This is an out parameter, where
+ * 							::HTTPAPI_ExecuteRequests returns how many
+ * 							requests, from the first one, got their
+ * 							response. The rest can be sent again.
+ *
+ * @return	@c HTTPAPI_OK if all the responses were received or an error
+ * 			code in case it fails.
+ */
+MOCKABLE_FUNCTION(, HTTPAPI_RESULT, HTTPAPI_ExecuteRequests, HTTP_HANDLE, handle, const HTTPAPI_REQUEST*, requests, size_t, requestCount, size_t*, completedCount);
+
 /**
  * @brief	Sets the option named @p optionName bearing the value
  * 			@p value for the HTTP_HANDLE @p handle.
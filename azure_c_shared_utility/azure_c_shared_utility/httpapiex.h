@@ -81,6 +81,25 @@ MOCKABLE_FUNCTION(, HTTPAPIEX_HANDLE, HTTPAPIEX_Create, const char*, hostName);
  */
 MOCKABLE_FUNCTION(, HTTPAPIEX_RESULT, HTTPAPIEX_ExecuteRequest, HTTPAPIEX_HANDLE, handle, HTTPAPI_REQUEST_TYPE, requestType, const char*, relativePath, HTTP_HEADERS_HANDLE, requestHttpHeadersHandle, BUFFER_HANDLE, requestContent, unsigned int*, statusCode, HTTP_HEADERS_HANDLE, responseHttpHeadersHandle, BUFFER_HANDLE, responseContent);
 
+/**
+ * @brief	Executes several requests on the same connection, pipelined, with
+ * 			the same recovery as ::HTTPAPIEX_ExecuteRequest. After a failure
+ * 			only the requests that have not been answered yet are sent again.
+ *
+ * @param	handle			The @c HTTPAPIEX_HANDLE obtained from a call to
+ * 							::HTTPAPIEX_Create.
+ * @param	requests		The requests, see ::HTTPAPI_REQUEST. Every request
+ * 							needs a @c httpHeadersHandle and a @c relativePath,
+ * 							the Host and Content-Length headers are set on it.
+ * 							A request that is sent again after a failure
+ * 							hands its body to @c onResponseBody again, from
+ * 							the start.
+ * @param	requestCount	Number of entries in @p requests.
+ *
+ * @return	An @c HTTPAPIEX_RESULT indicating the status of the call.
+ */
+MOCKABLE_FUNCTION(, HTTPAPIEX_RESULT, HTTPAPIEX_ExecuteRequests, HTTPAPIEX_HANDLE, handle, const HTTPAPI_REQUEST*, requests, size_t, requestCount);
+
 /**
  * @brief	Frees all resources used by the @c HTTPAPIEX_HANDLE object.
  *
@@ -61,6 +61,16 @@ MOCKABLE_FUNCTION(, HTTP_HEADERS_HANDLE, HTTPHeaders_Alloc);
  */
 MOCKABLE_FUNCTION(, void, HTTPHeaders_Free, HTTP_HEADERS_HANDLE, httpHeadersHandle);
 
+/**
+ * @brief	Removes all the headers, so the handle can be used again for another
+ * 			request or response without being freed and allocated.
+ *
+ * @param	httpHeadersHandle	A valid @c HTTP_HEADERS_HANDLE value.
+ *
+ * @return	@c HTTP_HEADERS_OK on success or an error code otherwise.
+ */
+MOCKABLE_FUNCTION(, HTTP_HEADERS_RESULT, HTTPHeaders_Clear, HTTP_HEADERS_HANDLE, httpHeadersHandle);
+
 /**
  * @brief	Adds a header record from the @p name and @p value parameters.
  *
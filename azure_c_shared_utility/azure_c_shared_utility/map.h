@@ -133,6 +133,18 @@ MOCKABLE_FUNCTION(, MAP_RESULT, Map_AddOrUpdate, MAP_HANDLE, handle, const char*
  */
 MOCKABLE_FUNCTION(, MAP_RESULT, Map_Delete, MAP_HANDLE, handle, const char*, key);
 
+/**
+ * @brief   Removes all the keys and values from the map. The storage is
+ *          kept, so a map that is cleared and filled again does not
+ *          allocate for its arrays.
+ *
+ * @param   handle  The handle to an existing map.
+ *
+ * @return  Returns @c MAP_OK on success or @c MAP_INVALIDARG if
+ *          @p handle is @c NULL.
+ */
+MOCKABLE_FUNCTION(, MAP_RESULT, Map_Clear, MAP_HANDLE, handle);
+
 /**
  * @brief   This function returns a boolean value in @p keyExists if the map
  *          contains a key with the same value the parameter @p key.
@@ -211,6 +211,14 @@ extern int SHA256FinalBits(SHA256Context *, const uint8_t bits,
 extern int SHA256Result(SHA256Context *,
                         uint8_t Message_Digest[SHA256HashSize]);
 
+#if defined(SHA256_BACKEND_ALT)
+/* Compresses one 64 octet block into the intermediate hash, built
+   with SHA256_BACKEND_ALT to route SHA-224/256 to a hardware unit.
+   The unit has to be loaded with Intermediate_Hash as its midstate */
+extern void SHA256ProcessBlockAlt(uint32_t Intermediate_Hash[SHA256HashSize/4],
+                                  const uint8_t Message_Block[SHA256_Message_Block_Size]);
+#endif
+
 /* SHA-384 */
 extern int SHA384Reset(SHA384Context *);
 extern int SHA384Input(SHA384Context *, const uint8_t *bytes,
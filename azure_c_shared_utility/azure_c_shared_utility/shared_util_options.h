@@ -38,6 +38,8 @@ extern "C"
 
     static const char* OPTION_TLS_VERSION = "tls_version";
 
+    static const char* OPTION_RECEIVE_SIGNAL = "receive_signal";
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,6 +38,19 @@ MOCKABLE_FUNCTION(, int, STRING_replace, STRING_HANDLE, handle, char, target, ch
 extern STRING_HANDLE STRING_construct_sprintf(const char* format, ...);
 extern int STRING_sprintf(STRING_HANDLE s1, const char* format, ...);
 
+/*STRING_BUILDER: appends to a buffer that grows geometrically, then turns into a STRING_HANDLE
+  without copying. capacity counts characters, the '\0' is extra.*/
+MOCKABLE_FUNCTION(, STRING_BUILDER_HANDLE, STRING_BUILDER_create, size_t, capacity);
+MOCKABLE_FUNCTION(, void, STRING_BUILDER_destroy, STRING_BUILDER_HANDLE, builder);
+MOCKABLE_FUNCTION(, int, STRING_BUILDER_reserve, STRING_BUILDER_HANDLE, builder, size_t, capacity);
+MOCKABLE_FUNCTION(, int, STRING_BUILDER_append, STRING_BUILDER_HANDLE, builder, const char*, s);
+MOCKABLE_FUNCTION(, int, STRING_BUILDER_append_n, STRING_BUILDER_HANDLE, builder, const char*, s, size_t, n);
+MOCKABLE_FUNCTION(, int, STRING_BUILDER_append_char, STRING_BUILDER_HANDLE, builder, char, c);
+MOCKABLE_FUNCTION(, size_t, STRING_BUILDER_length, STRING_BUILDER_HANDLE, builder);
+MOCKABLE_FUNCTION(, const char*, STRING_BUILDER_c_str, STRING_BUILDER_HANDLE, builder);
+MOCKABLE_FUNCTION(, STRING_HANDLE, STRING_BUILDER_finish, STRING_BUILDER_HANDLE, builder);
+extern int STRING_BUILDER_format(STRING_BUILDER_HANDLE builder, const char* format, ...);
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,5 +5,6 @@
 #define STRINGS_TYPES_H
 
 typedef struct STRING_TAG* STRING_HANDLE;
+typedef struct STRING_BUILDER_TAG* STRING_BUILDER_HANDLE;
 
 #endif  /*STRINGS_TYPES_H*/
@@ -20,6 +20,7 @@ extern "C" {
 	int tcpsocketconnection_send_all(TCPSOCKETCONNECTION_HANDLE tcpSocketConnectionHandle, const char* data, int length);
 	int tcpsocketconnection_receive(TCPSOCKETCONNECTION_HANDLE tcpSocketConnectionHandle, char* data, int length);
 	int tcpsocketconnection_receive_all(TCPSOCKETCONNECTION_HANDLE tcpSocketConnectionHandle, char* data, int length);
+	void tcpsocketconnection_set_receive_callback(TCPSOCKETCONNECTION_HANDLE tcpSocketConnectionHandle, void (*on_receive_ready)(void* context), void* context);
 
 #ifdef __cplusplus
 }
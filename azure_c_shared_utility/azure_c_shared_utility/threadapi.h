@@ -47,11 +47,34 @@ typedef void* THREAD_HANDLE;
  */
 MOCKABLE_FUNCTION(, THREADAPI_RESULT, ThreadAPI_Create, THREAD_HANDLE*, threadHandle, THREAD_START_FUNC, func, void*, arg);
 
+/**
+ * @brief	Queues a task with the entry point specified by the @p func
+ * 			argument, to run on one of the threads of a fixed worker pool
+ * 			instead of a thread of its own.
+ *
+ * @param   taskHandle		The handle to the task is returned in this pointer.
+ * 							It is passed to ::ThreadAPI_Join to wait for the
+ * 							task and get the value returned by @p func. When
+ * 							@c NULL, nobody waits for the task.
+ * @param	func			A function pointer that indicates the entry point
+ * 							of the task.
+ * @param   arg				A void pointer that must be passed to the function
+ * 							pointed to by @p func.
+ *
+ * 			The tasks run in the order they are submitted. The queue is
+ * 			bounded, a task that does not fit is not queued.
+ *
+ * @return	@c THREADAPI_OK if the API call is successful, @c THREADAPI_NO_MEMORY
+ * 			when the queue is full or an error code in case it fails.
+ */
+MOCKABLE_FUNCTION(, THREADAPI_RESULT, ThreadAPI_Submit, THREAD_HANDLE*, taskHandle, THREAD_START_FUNC, func, void*, arg);
+
 /**
  * @brief	Blocks the calling thread by waiting on the thread identified by
  * 			the @p threadHandle argument to complete.
  *
- * @param	threadHandle	The handle of the thread to wait for completion.
+ * @param	threadHandle	The handle of the thread to wait for completion,
+ * 							or of a task queued with ::ThreadAPI_Submit.
  * @param   res 			The result returned by the thread which is passed
  * 							to the ::ThreadAPI_Exit function.
  *
@@ -14,6 +14,8 @@ extern "C" {
 
     MOCKABLE_FUNCTION(, STRING_HANDLE, URL_EncodeString, const char*, textEncode);
     MOCKABLE_FUNCTION(, STRING_HANDLE, URL_Encode, STRING_HANDLE, input);
+    /* Encodes into a caller buffer, which must hold the encoding and its '\0'. Returns 0 on success. */
+    MOCKABLE_FUNCTION(, int, URL_EncodeString_Into, const char*, textEncode, char*, destination, size_t, destinationSize);
 
 #ifdef __cplusplus
 }
@@ -24,9 +24,11 @@ MOCKABLE_FUNCTION(, void, VECTOR_destroy, VECTOR_HANDLE, handle);
 
 /* insertion */
 MOCKABLE_FUNCTION(, int, VECTOR_push_back, VECTOR_HANDLE, handle, const void*, elements, size_t, numElements);
+MOCKABLE_FUNCTION(, int, VECTOR_push_back_n, VECTOR_HANDLE, handle, const void*, element, size_t, numElements);
 
 /* removal */
 MOCKABLE_FUNCTION(, void, VECTOR_erase, VECTOR_HANDLE, handle, void*, elements, size_t, numElements);
+MOCKABLE_FUNCTION(, void, VECTOR_swap_remove, VECTOR_HANDLE, handle, void*, element);
 MOCKABLE_FUNCTION(, void, VECTOR_clear, VECTOR_HANDLE, handle);
 
 /* access */
@@ -37,6 +39,9 @@ MOCKABLE_FUNCTION(, void*, VECTOR_find_if, VECTOR_HANDLE, handle, PREDICATE_FUNC
 
 /* capacity */
 MOCKABLE_FUNCTION(, size_t, VECTOR_size, VECTOR_HANDLE, handle);
+MOCKABLE_FUNCTION(, size_t, VECTOR_capacity, VECTOR_HANDLE, handle);
+MOCKABLE_FUNCTION(, int, VECTOR_reserve, VECTOR_HANDLE, handle, size_t, numElements);
+MOCKABLE_FUNCTION(, void, VECTOR_shrink_to_fit, VECTOR_HANDLE, handle);
 
 #ifdef __cplusplus
 }
@@ -10,10 +10,12 @@
 #include <stddef.h>
 #endif
 
+/*count is the number of elements in use, capacity the number of elements storage has room for*/
 typedef struct VECTOR_TAG
 {
     void* storage;
     size_t count;
+    size_t capacity;
     size_t elementSize;
 } VECTOR;
 
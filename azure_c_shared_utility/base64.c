@@ -9,90 +9,43 @@
 #include "azure_c_shared_utility/xlogging.h"
 
 
-#define splitInt(intVal, bytePos)   (char)((intVal >> (bytePos << 3)) & 0xFF)
-#define joinChars(a, b, c, d) (uint32_t)((uint32_t)a + ((uint32_t)b << 8) + ((uint32_t)c << 16) + ((uint32_t)d << 24))
-
-static char base64char(unsigned char val)
+static const char base64Chars[64] =
 {
-    char result;
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+    'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
+};
 
-    if (val < 26)
-    {
-        result = 'A' + (char)val;
-    }
-    else if (val < 52)
-    {
-        result = 'a' + ((char)val - 26);
-    }
-    else if (val < 62)
-    {
-        result = '0' + ((char)val - 52);
-    }
-    else if (val == 62)
-    {
-        result = '+';
-    }
-    else
-    {
-        result = '/';
-    }
-
-    return result;
-}
-
-static char base64b16(unsigned char val)
+/*value of every base64 character, 0xFF for anything else (the '=' padding and the '\0' terminator included)*/
+#define XX 0xFF
+static const unsigned char base64Values[256] =
 {
-    const uint32_t base64b16values[4] = {
-        joinChars('A', 'E', 'I', 'M'),
-        joinChars('Q', 'U', 'Y', 'c'),
-        joinChars('g', 'k', 'o', 's'),
-        joinChars('w', '0', '4', '8')
-    };
-    return splitInt(base64b16values[val >> 2], (val & 0x03));
-}
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, 62, XX, XX, XX, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, XX, XX, XX, XX, XX, XX,
+    XX,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, XX, XX, XX, XX, XX,
+    XX, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX,
+    XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX, XX
+};
+#undef XX
 
-static char base64b8(unsigned char val)
-{
-    const uint32_t base64b8values = joinChars('A', 'Q', 'g', 'w');
-    return splitInt(base64b8values, val);
-}
-
-static int base64toValue(char base64character, unsigned char* value)
-{
-    int result = 0;
-    if (('A' <= base64character) && (base64character <= 'Z'))
-    {
-        *value = base64character - 'A';
-    }
-    else if (('a' <= base64character) && (base64character <= 'z'))
-    {
-        *value = ('Z' - 'A') + 1 + (base64character - 'a');
-    }
-    else if (('0' <= base64character) && (base64character <= '9'))
-    {
-        *value = ('Z' - 'A') + 1 + ('z' - 'a') + 1 + (base64character - '0');
-    }
-    else if ('+' == base64character)
-    {
-        *value = 62;
-    }
-    else if ('/' == base64character)
-    {
-        *value = 63;
-    }
-    else
-    {
-        *value = 0;
-        result = -1;
-    }
-    return result;
-}
+#define base64Value(c) base64Values[(unsigned char)(c)]
 
 static size_t numberOfBase64Characters(const char* encodedString)
 {
     size_t length = 0;
-    unsigned char junkChar;
-    while (base64toValue(encodedString[length],&junkChar) != -1)
+    while (base64Value(encodedString[length]) != 0xFF)
     {
         length++;
     }
@@ -101,10 +54,9 @@ static size_t numberOfBase64Characters(const char* encodedString)
 
 /*returns the count of original bytes before being base64 encoded*/
 /*notice NO validation of the content of encodedString. Its length is validated to be a multiple of 4.*/
-static size_t Base64decode_len(const char *encodedString)
+static size_t Base64decode_len(const char *encodedString, size_t sourceLength)
 {
     size_t result;
-    size_t sourceLength = strlen(encodedString);
     
     if (sourceLength == 0)
     {
@@ -127,60 +79,34 @@ static size_t Base64decode_len(const char *encodedString)
 
 static void Base64decode(unsigned char *decodedString, const char *base64String)
 {
+    const unsigned char* source = (const unsigned char*)base64String;
+    size_t numberOfEncodedChars = numberOfBase64Characters(base64String);
 
-    size_t numberOfEncodedChars;
-    size_t indexOfFirstEncodedChar;
-    size_t decodedIndex;
-
-    //
-    // We can only operate on individual bytes.  If we attempt to work
-    // on anything larger we could get an alignment fault on some
-    // architectures
-    //
-
-    numberOfEncodedChars = numberOfBase64Characters(base64String);
-    indexOfFirstEncodedChar = 0;
-    decodedIndex = 0;
+    /*every group of 4 characters is joined into one 24 bit word, then split into 3 bytes*/
     while (numberOfEncodedChars >= 4)
     {
-        unsigned char c1;
-        unsigned char c2;
-        unsigned char c3;
-        unsigned char c4;
-        (void)base64toValue(base64String[indexOfFirstEncodedChar], &c1);
-        (void)base64toValue(base64String[indexOfFirstEncodedChar + 1], &c2);
-        (void)base64toValue(base64String[indexOfFirstEncodedChar + 2], &c3);
-        (void)base64toValue(base64String[indexOfFirstEncodedChar + 3], &c4);
-        decodedString[decodedIndex] = (c1 << 2) | (c2 >> 4);
-        decodedIndex++;
-        decodedString[decodedIndex] = ((c2 & 0x0f) << 4) | (c3 >> 2);
-        decodedIndex++;
-        decodedString[decodedIndex] = ((c3 & 0x03) << 6) | c4;
-        decodedIndex++;
+        uint32_t word = ((uint32_t)base64Values[source[0]] << 18) |
+            ((uint32_t)base64Values[source[1]] << 12) |
+            ((uint32_t)base64Values[source[2]] << 6) |
+            (uint32_t)base64Values[source[3]];
+        decodedString[0] = (unsigned char)(word >> 16);
+        decodedString[1] = (unsigned char)(word >> 8);
+        decodedString[2] = (unsigned char)word;
+        decodedString += 3;
+        source += 4;
         numberOfEncodedChars -= 4;
-        indexOfFirstEncodedChar += 4;
-
     }
 
-    if (numberOfEncodedChars == 2)
-    {
-        unsigned char c1;
-        unsigned char c2;
-        (void)base64toValue(base64String[indexOfFirstEncodedChar], &c1);
-        (void)base64toValue(base64String[indexOfFirstEncodedChar + 1], &c2);
-        decodedString[decodedIndex] = (c1 << 2) | (c2 >> 4);
-    }
-    else if (numberOfEncodedChars == 3)
+    if (numberOfEncodedChars >= 2)
     {
-        unsigned char c1;
-        unsigned char c2;
-        unsigned char c3;
-        (void)base64toValue(base64String[indexOfFirstEncodedChar], &c1);
-        (void)base64toValue(base64String[indexOfFirstEncodedChar + 1], &c2);
-        (void)base64toValue(base64String[indexOfFirstEncodedChar + 2], &c3);
-        decodedString[decodedIndex] = (c1 << 2) | (c2 >> 4);
-        decodedIndex++;
-        decodedString[decodedIndex] = ((c2 & 0x0f) << 4) | (c3 >> 2);
+        uint32_t word = ((uint32_t)base64Values[source[0]] << 18) |
+            ((uint32_t)base64Values[source[1]] << 12);
+        if (numberOfEncodedChars == 3)
+        {
+            word |= (uint32_t)base64Values[source[2]] << 6;
+            decodedString[1] = (unsigned char)(word >> 8);
+        }
+        decodedString[0] = (unsigned char)(word >> 16);
     }
 }
 
@@ -195,7 +121,8 @@ BUFFER_HANDLE Base64_Decoder(const char* source)
     }
     else
     {
-        if ((strlen(source) % 4) != 0)
+        size_t sourceLength = strlen(source);
+        if ((sourceLength % 4) != 0)
         {
             /*Codes_SRS_BASE64_06_011: [If the source string has an invalid length for a base 64 encoded string then Base64_Decode shall return NULL.]*/
             LogError("Invalid length Base64 string!");
@@ -210,7 +137,7 @@ BUFFER_HANDLE Base64_Decoder(const char* source)
             }
             else
             {
-                size_t sizeOfOutputBuffer = Base64decode_len(source);
+                size_t sizeOfOutputBuffer = Base64decode_len(source, sourceLength);
                 /*Codes_SRS_BASE64_06_009: [If the string pointed to by source is zero length then the handle returned shall refer to a zero length buffer.]*/
                 if (sizeOfOutputBuffer > 0)
                 {
@@ -233,13 +160,60 @@ BUFFER_HANDLE Base64_Decoder(const char* source)
 }
 
 
+/*returns the count of base64 characters needed for size bytes, padding included*/
+static size_t Base64encode_len(size_t size)
+{
+    return (size == 0) ? (0) : ((((size - 1) / 3) + 1) * 4);
+}
+
+/*writes Base64encode_len(size) characters, no terminator. Returns the count written.*/
+static size_t Base64encode(char* encoded, const unsigned char* source, size_t size)
+{
+    /*b0            b1(+1)          b2(+2)
+    7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0
+    |----c1---| |----c2---| |----c3---| |----c4---|
+    */
+    char* destination = encoded;
+    const unsigned char* end = source + size;
+
+    /*3 bytes are joined into one 24 bit word, then split into 4 characters*/
+    while (end - source >= 3)
+    {
+        uint32_t word = ((uint32_t)source[0] << 16) | ((uint32_t)source[1] << 8) | (uint32_t)source[2];
+        destination[0] = base64Chars[(word >> 18) & 0x3F];
+        destination[1] = base64Chars[(word >> 12) & 0x3F];
+        destination[2] = base64Chars[(word >> 6) & 0x3F];
+        destination[3] = base64Chars[word & 0x3F];
+        destination += 4;
+        source += 3;
+    }
+    if (end - source == 2)
+    {
+        uint32_t word = ((uint32_t)source[0] << 16) | ((uint32_t)source[1] << 8);
+        destination[0] = base64Chars[(word >> 18) & 0x3F];
+        destination[1] = base64Chars[(word >> 12) & 0x3F];
+        destination[2] = base64Chars[(word >> 6) & 0x3F];
+        destination[3] = '=';
+        destination += 4;
+    }
+    else if (end - source == 1)
+    {
+        uint32_t word = (uint32_t)source[0] << 16;
+        destination[0] = base64Chars[(word >> 18) & 0x3F];
+        destination[1] = base64Chars[(word >> 12) & 0x3F];
+        destination[2] = '=';
+        destination[3] = '=';
+        destination += 4;
+    }
+    return (size_t)(destination - encoded);
+}
+
 static STRING_HANDLE Base64_Encode_Internal(const unsigned char* source, size_t size)
 {
     STRING_HANDLE result;
     size_t neededSize = 0;
     char* encoded;
-    size_t currentPosition = 0;
-    neededSize += (size == 0) ? (0) : ((((size - 1) / 3) + 1) * 4);
+    neededSize += Base64encode_len(size);
     neededSize += 1; /*+1 because \0 at the end of the string*/
     /*Codes_SRS_BASE64_06_006: [If when allocating memory to produce the encoding a failure occurs then Base64_Encoder shall return NULL.]*/
     encoded = (char*)malloc(neededSize);
@@ -250,56 +224,7 @@ static STRING_HANDLE Base64_Encode_Internal(const unsigned char* source, size_t
     }
     else
     {
-        /*b0            b1(+1)          b2(+2)
-        7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0
-        |----c1---| |----c2---| |----c3---| |----c4---|
-        */
-
-        size_t destinationPosition = 0;
-        while (size - currentPosition >= 3)
-        {
-            char c1 = base64char(source[currentPosition] >> 2);
-            char c2 = base64char(
-                ((source[currentPosition] & 3) << 4) |
-                    (source[currentPosition + 1] >> 4)
-            );
-            char c3 = base64char(
-                ((source[currentPosition + 1] & 0x0F) << 2) |
-                    ((source[currentPosition + 2] >> 6) & 3)
-            );
-            char c4 = base64char(
-                source[currentPosition + 2] & 0x3F
-            );
-            currentPosition += 3;
-            encoded[destinationPosition++] = c1;
-            encoded[destinationPosition++] = c2;
-            encoded[destinationPosition++] = c3;
-            encoded[destinationPosition++] = c4;
-
-        }
-        if (size - currentPosition == 2)
-        {
-            char c1 = base64char(source[currentPosition] >> 2);
-            char c2 = base64char(
-                ((source[currentPosition] & 0x03) << 4) |
-                    (source[currentPosition + 1] >> 4)
-            );
-            char c3 = base64b16(source[currentPosition + 1] & 0x0F);
-            encoded[destinationPosition++] = c1;
-            encoded[destinationPosition++] = c2;
-            encoded[destinationPosition++] = c3;
-            encoded[destinationPosition++] = '=';
-        }
-        else if (size - currentPosition == 1)
-        {
-            char c1 = base64char(source[currentPosition] >> 2);
-            char c2 = base64b8(source[currentPosition] & 0x03);
-            encoded[destinationPosition++] = c1;
-            encoded[destinationPosition++] = c2;
-            encoded[destinationPosition++] = '=';
-            encoded[destinationPosition++] = '=';
-        }
-
+        size_t destinationPosition = Base64encode(encoded, source, size);
         /*null terminating the string*/
         encoded[destinationPosition] = '\0';
         /*Codes_SRS_BASE64_06_007: [Otherwise Base64_Encoder shall return a pointer to STRING, that string contains the base 64 encoding of input.]*/
@@ -366,3 +291,52 @@ STRING_HANDLE Base64_Encoder(BUFFER_HANDLE input)
     }
     return result;
 }
+
+int Base64_Encode_Bytes_Into(const unsigned char* source, size_t size, char* destination, size_t destinationSize)
+{
+    int result;
+    if ((source == NULL && size > 0) || destination == NULL)
+    {
+        LogError("invalid parameter const unsigned char* source=%p, char* destination=%p", source, destination);
+        result = __FAILURE__;
+    }
+    else if (Base64encode_len(size) + 1 > destinationSize)
+    {
+        LogError("destination too small for the encoding, %lu bytes needed", (unsigned long)(Base64encode_len(size) + 1));
+        result = __FAILURE__;
+    }
+    else
+    {
+        destination[Base64encode(destination, source, size)] = '\0';
+        result = 0;
+    }
+    return result;
+}
+
+int Base64_Decode_Into(const char* source, unsigned char* destination, size_t destinationSize, size_t* decodedSize)
+{
+    int result;
+    size_t sourceLength;
+    if (source == NULL || destination == NULL || decodedSize == NULL)
+    {
+        LogError("invalid parameter const char* source=%p, unsigned char* destination=%p, size_t* decodedSize=%p", source, destination, decodedSize);
+        result = __FAILURE__;
+    }
+    else if (((sourceLength = strlen(source)) % 4) != 0)
+    {
+        LogError("Invalid length Base64 string!");
+        result = __FAILURE__;
+    }
+    else if (Base64decode_len(source, sourceLength) > destinationSize)
+    {
+        LogError("destination too small for the decoding, %lu bytes needed", (unsigned long)Base64decode_len(source, sourceLength));
+        result = __FAILURE__;
+    }
+    else
+    {
+        *decodedSize = Base64decode_len(source, sourceLength);
+        Base64decode(destination, source);
+        result = 0;
+    }
+    return result;
+}
@@ -6,9 +6,19 @@
 #include "azure_c_shared_utility/condition.h"
 #include "rtos.h"
 
+/*the condition is a binary semaphore. A post with no thread waiting is kept until the next wait, so a
+signal that lands between checking the state and calling Condition_Wait is not lost, and Condition_Post
+can be called from interrupt context (socket sigio callbacks)*/
+
 COND_HANDLE Condition_Init(void)
 {
-    return NULL;
+    Semaphore* result = new Semaphore(0, 1);
+    if (result == NULL)
+    {
+        LogError("Failed to instantiate a new Semaphore object.");
+    }
+
+    return (COND_HANDLE)result;
 }
 
 COND_RESULT Condition_Post(COND_HANDLE handle)
@@ -20,22 +30,57 @@ COND_RESULT Condition_Post(COND_HANDLE handle)
     }
     else
     {
-
+        Semaphore* cond_sem = (Semaphore*)handle;
+        osStatus status = cond_sem->release();
+        /*osErrorResource means the condition is already signalled*/
+        if ((status == osOK) || (status == osErrorResource))
+        {
+            result = COND_OK;
+        }
+        else
+        {
+            result = COND_ERROR;
+        }
     }
-    return COND_ERROR;
+    return result;
 }
 
 COND_RESULT Condition_Wait(COND_HANDLE  handle, LOCK_HANDLE lock, int timeout_milliseconds)
 {
     COND_RESULT result;
-    if (handle == NULL)
+    if ((handle == NULL) || (lock == NULL))
     {
         result = COND_INVALID_ARG;
     }
-    else
+    else if (Unlock(lock) != LOCK_OK)
     {
+        LogError("Failed to release the lock before waiting on the condition.");
         result = COND_ERROR;
     }
+    else
+    {
+        Semaphore* cond_sem = (Semaphore*)handle;
+        /*a timeout of 0 waits until the condition is signalled*/
+        int32_t tokens = cond_sem->wait((timeout_milliseconds > 0) ? (uint32_t)timeout_milliseconds : osWaitForever);
+        if (tokens > 0)
+        {
+            result = COND_OK;
+        }
+        else if (tokens == 0)
+        {
+            result = COND_TIMEOUT;
+        }
+        else
+        {
+            result = COND_ERROR;
+        }
+
+        if (Lock(lock) != LOCK_OK)
+        {
+            LogError("Failed to take the lock back after waiting on the condition.");
+            result = COND_ERROR;
+        }
+    }
     return result;
 }
 
@@ -43,5 +88,7 @@ void Condition_Deinit(COND_HANDLE handle)
 {
     if (handle != NULL)
     {
+        Semaphore* cond_sem = (Semaphore*)handle;
+        delete cond_sem;
     }
 }
@@ -4,20 +4,92 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stddef.h>
-#include "azure_c_shared_utility/lock.h"
+#include <string.h>
+/*the functions are always built, and malloc and friends are the C library ones in here*/
+#if !defined(GB_DEBUG_ALLOC)
+#define GB_DEBUG_ALLOC
+#endif
+#undef GB_MEASURE_MEMORY_FOR_THIS
+#include "azure_c_shared_utility/gballoc.h"
 #include "azure_c_shared_utility/optimize_size.h"
 #include "azure_c_shared_utility/xlogging.h"
+#include "azure_c_shared_utility/refcount_os.h"
+#if defined(GBALLOC_USE_SLABS)
+#include "azure_c_shared_utility/lock.h"
+#endif
+
+/*the free memory of the C library heap is known where mallinfo exists*/
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define GBALLOC_HAS_MALLINFO2
+#elif defined(__GLIBC__) || defined(_NEWLIB_VERSION)
+#include <malloc.h>
+#define GBALLOC_HAS_MALLINFO
+#endif
 
 #ifndef SIZE_MAX
 #define SIZE_MAX ((size_t)~(size_t)0)
 #endif
 
-typedef struct ALLOCATION_TAG
+/*every tracked block is allocated behind a header holding its size, so that free and realloc find it without
+searching. check is GBALLOC_HEADER_CHECK ^ size, shifted to make room for the tag index and the slab flag, while the
+block is alive. It tells tracked blocks apart from blocks that were allocated before gballoc_init or by a translation
+unit without GB_MEASURE_MEMORY_FOR_THIS, those go to the C library untracked. A freed block gets GBALLOC_FREED_CHECK*/
+typedef union GBALLOC_HEADER_TAG
 {
-    size_t size;
-    void* ptr;
-    void* next;
-} ALLOCATION;
+    struct
+    {
+        size_t size;
+        size_t check;
+    } block;
+    /*keeps the user part aligned like malloc's result*/
+    long double alignLongDouble;
+    long long alignLongLong;
+    void* alignPointer;
+} GBALLOC_HEADER;
+
+#define GBALLOC_HEADER_CHECK ((size_t)0x6BA110C5u)
+#define GBALLOC_FREED_CHECK ((size_t)0xF4EEB10Cu)
+#define GBALLOC_TAG_BITS 8
+#define GBALLOC_SLAB_FLAG ((size_t)1 << GBALLOC_TAG_BITS)
+#define GBALLOC_CHECK_OF(size, flags) (((GBALLOC_HEADER_CHECK ^ (size)) << (GBALLOC_TAG_BITS + 1)) | (flags))
+#define GBALLOC_FLAGS_OF(check) ((size_t)((check) & ((GBALLOC_SLAB_FLAG << 1) - 1)))
+#define GBALLOC_TAG_INDEX_OF(check) ((size_t)((check) & (GBALLOC_SLAB_FLAG - 1)))
+#define GBALLOC_IS_SLAB(check) (((check) & GBALLOC_SLAB_FLAG) != 0)
+
+#if GBALLOC_TAG_COUNT > (1 << GBALLOC_TAG_BITS)
+#error GBALLOC_TAG_COUNT does not fit in the block header
+#endif
+
+#define GBALLOC_HEADER_OF(ptr) (((GBALLOC_HEADER*)(ptr)) - 1)
+
+/*the counters are updated with atomic operations instead of a lock, using the same mechanism as refcount_os.h*/
+#if defined(REFCOUNT_ATOMIC_DONTCARE)
+typedef size_t GBALLOC_COUNTER;
+typedef const char* GBALLOC_TAG_NAME;
+#define GBALLOC_ADD(counter, value) ((counter) += (value))
+#define GBALLOC_SUB(counter, value) ((counter) -= (value))
+#define GBALLOC_LOAD(counter) (counter)
+#define GBALLOC_STORE(counter, value) ((counter) = (value))
+#elif defined(REFCOUNT_USE_STD_ATOMIC)
+typedef _Atomic size_t GBALLOC_COUNTER;
+typedef _Atomic(const char*) GBALLOC_TAG_NAME;
+#define GBALLOC_ADD(counter, value) (atomic_fetch_add(&(counter), (value)) + (value))
+#define GBALLOC_SUB(counter, value) (atomic_fetch_sub(&(counter), (value)) - (value))
+#define GBALLOC_LOAD(counter) atomic_load(&(counter))
+#define GBALLOC_STORE(counter, value) atomic_store(&(counter), (value))
+#else
+typedef volatile size_t GBALLOC_COUNTER;
+typedef const char* volatile GBALLOC_TAG_NAME;
+#define GBALLOC_ADD(counter, value) __sync_add_and_fetch(&(counter), (value))
+#define GBALLOC_SUB(counter, value) __sync_sub_and_fetch(&(counter), (value))
+#if defined(__ATOMIC_RELAXED)
+#define GBALLOC_LOAD(counter) __atomic_load_n(&(counter), __ATOMIC_RELAXED)
+#else
+#define GBALLOC_LOAD(counter) (counter)
+#endif
+#define GBALLOC_STORE(counter, value) ((void)__sync_lock_test_and_set(&(counter), (value)))
+#endif
 
 typedef enum GBALLOC_STATE_TAG
 {
@@ -25,417 +97,1229 @@ typedef enum GBALLOC_STATE_TAG
     GBALLOC_STATE_NOT_INIT
 } GBALLOC_STATE;
 
-static ALLOCATION* head = NULL;
-static size_t totalSize = 0;
-static size_t maxSize = 0;
-static size_t g_allocations = 0;
+typedef struct GBALLOC_SIZE_CLASS_COUNTERS_TAG
+{
+    GBALLOC_COUNTER allocations;
+    GBALLOC_COUNTER liveBlocks;
+    GBALLOC_COUNTER liveBytes;
+} GBALLOC_SIZE_CLASS_COUNTERS;
+
+/*a slot is claimed by setting its name and keeps it for good, blocks refer to their slot by index*/
+typedef struct GBALLOC_TAG_COUNTERS_TAG
+{
+    GBALLOC_TAG_NAME name;
+    GBALLOC_COUNTER liveBytes;
+    GBALLOC_COUNTER peakBytes;
+    GBALLOC_COUNTER histogram[GBALLOC_SIZE_CLASS_COUNT];
+} GBALLOC_TAG_COUNTERS;
+
+typedef struct GBALLOC_WRITER_TAG
+{
+    unsigned char* buffer;
+    size_t size;
+    size_t length;
+    int failed;
+} GBALLOC_WRITER;
+
+static GBALLOC_COUNTER totalSize = 0;
+static GBALLOC_COUNTER maxSize = 0;
+/*blocks with a header that are not freed yet, they can outlive gballoc_deinit*/
+static GBALLOC_COUNTER trackedBlocks = 0;
+static GBALLOC_SIZE_CLASS_COUNTERS sizeClasses[GBALLOC_SIZE_CLASS_COUNT];
+/*slot 0 collects the allocations without a tag and the ones of tags that did not fit*/
+static GBALLOC_TAG_COUNTERS tags[GBALLOC_TAG_COUNT];
 static GBALLOC_STATE gballocState = GBALLOC_STATE_NOT_INIT;
 
-static LOCK_HANDLE gballocThreadSafeLock = NULL;
+#if defined(GBALLOC_USE_SLABS)
+/*a page starts with this and is followed by its blocks. Pages with free blocks are in the available list of their
+slab, a free block is linked to the next one through the first pointer of its user part*/
+typedef struct GBALLOC_SLAB_PAGE_TAG
+{
+    struct GBALLOC_SLAB_PAGE_TAG* previous;
+    struct GBALLOC_SLAB_PAGE_TAG* next;
+    GBALLOC_HEADER* freeList;
+    size_t slabIndex;
+    size_t blocks;
+    size_t freeBlocks;
+} GBALLOC_SLAB_PAGE;
 
-int gballoc_init(void)
+/*in front of the header of every slab block, so that freeing finds the page without searching*/
+typedef union GBALLOC_SLAB_LINK_TAG
 {
-    int result;
+    GBALLOC_SLAB_PAGE* page;
+    GBALLOC_HEADER alignHeader;
+} GBALLOC_SLAB_LINK;
 
-    if (gballocState != GBALLOC_STATE_NOT_INIT)
+typedef struct GBALLOC_SLAB_TAG
+{
+    LOCK_HANDLE lock;
+    GBALLOC_SLAB_PAGE* available;
+    size_t pages;
+    size_t blocks;
+    size_t freeBlocks;
+} GBALLOC_SLAB;
+
+static const size_t slabBlockSizes[] = { GBALLOC_SLAB_CLASSES };
+#define GBALLOC_SLAB_COUNT (sizeof(slabBlockSizes) / sizeof(slabBlockSizes[0]))
+/*the locks are created by the first gballoc_init and kept, slab blocks can be freed after gballoc_deinit*/
+static GBALLOC_SLAB slabs[GBALLOC_SLAB_COUNT];
+#endif
+
+static void raiseMaximum(GBALLOC_COUNTER* maximum, size_t total)
+{
+#if defined(REFCOUNT_ATOMIC_DONTCARE)
+    if (*maximum < total)
     {
-        /* Codes_SRS_GBALLOC_01_025: [Init after Init shall fail and return a non-zero value.] */
-        result = __FAILURE__;
+        *maximum = total;
     }
-    /* Codes_SRS_GBALLOC_01_026: [gballoc_Init shall create a lock handle that will be used to make the other gballoc APIs thread-safe.] */
-    else if ((gballocThreadSafeLock = Lock_Init()) == NULL)
+#elif defined(REFCOUNT_USE_STD_ATOMIC)
+    size_t seen = atomic_load(maximum);
+    while ((seen < total) &&
+        !atomic_compare_exchange_weak(maximum, &seen, total))
     {
-        /* Codes_SRS_GBALLOC_01_027: [If the Lock creation fails, gballoc_init shall return a non-zero value.]*/
-        result = __FAILURE__;
     }
-    else
+#else
+    size_t seen = GBALLOC_LOAD(*maximum);
+    while (seen < total)
     {
-        gballocState = GBALLOC_STATE_INIT;
-
-        /* Codes_ SRS_GBALLOC_01_002: [Upon initialization the total memory used and maximum total memory used tracked by the module shall be set to 0.] */
-        totalSize = 0;
-        maxSize = 0;
-        g_allocations = 0;
-
-        /* Codes_SRS_GBALLOC_01_024: [gballoc_init shall initialize the gballoc module and return 0 upon success.] */
-        result = 0;
+        size_t previous = __sync_val_compare_and_swap(maximum, seen, total);
+        if (previous == seen)
+        {
+            break;
+        }
+        seen = previous;
     }
-
-    return result;
+#endif
 }
 
-void gballoc_deinit(void)
+static size_t getSizeClass(size_t size)
 {
-    if (gballocState == GBALLOC_STATE_INIT)
+    size_t result = 0;
+    size_t limit = GBALLOC_SMALLEST_SIZE_CLASS;
+    while ((result < GBALLOC_SIZE_CLASS_COUNT - 1) && (size > limit))
     {
-        /* Codes_SRS_GBALLOC_01_028: [gballoc_deinit shall free all resources allocated by gballoc_init.] */
-        (void)Lock_Deinit(gballocThreadSafeLock);
+        limit <<= 1;
+        result++;
     }
-
-    gballocState = GBALLOC_STATE_NOT_INIT;
+    return result;
 }
 
-void* gballoc_malloc(size_t size)
+/*two threads allocating for a new tag at the same time end up in the same slot*/
+static const char* claimTagSlot(GBALLOC_TAG_NAME* slot, const char* tag)
 {
-    void* result;
-
-    if (gballocState != GBALLOC_STATE_INIT)
+    const char* result;
+#if defined(REFCOUNT_ATOMIC_DONTCARE)
+    if (*slot == NULL)
     {
-        /* Codes_SRS_GBALLOC_01_039: [If gballoc was not initialized gballoc_malloc shall simply call malloc without any memory tracking being performed.] */
-        result = malloc(size);
+        *slot = tag;
     }
-    /* Codes_SRS_GBALLOC_01_030: [gballoc_malloc shall ensure thread safety by using the lock created by gballoc_Init.] */
-    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    result = *slot;
+#elif defined(REFCOUNT_USE_STD_ATOMIC)
+    const char* expected = NULL;
+    result = atomic_compare_exchange_strong(slot, &expected, tag) ? tag : expected;
+#else
+    result = __sync_val_compare_and_swap(slot, (const char*)NULL, tag);
+    if (result == NULL)
     {
-        /* Codes_SRS_GBALLOC_01_048: [If acquiring the lock fails, gballoc_malloc shall return NULL.] */
-        LogError("Failed to get the Lock.");
-        result = NULL;
+        result = tag;
     }
-    else
+#endif
+    return result;
+}
+
+static size_t getTagIndex(const char* tag)
+{
+    size_t result = 0;
+    if (tag != NULL)
     {
-        ALLOCATION* allocation = (ALLOCATION*)malloc(sizeof(ALLOCATION));
-        if (allocation == NULL)
+        size_t i;
+        /*tags are string literals, a tag is normally found by its pointer*/
+        for (i = 1; i < GBALLOC_TAG_COUNT; i++)
         {
-            result = NULL;
-        }
-        else
-        {
-            /* Codes_SRS_GBALLOC_01_003: [gb_malloc shall call the C99 malloc function and return its result.] */
-            result = malloc(size);
-            if (result == NULL)
+            const char* name = GBALLOC_LOAD(tags[i].name);
+            if ((name == NULL) || (name == tag))
             {
-                /* Codes_SRS_GBALLOC_01_012: [When the underlying malloc call fails, gballoc_malloc shall return NULL and size should not be counted towards total memory used.] */
-                free(allocation);
+                result = (name == NULL) ? 0 : i;
+                break;
             }
-            else
+        }
+
+        if (result == 0)
+        {
+            for (i = 1; i < GBALLOC_TAG_COUNT; i++)
             {
-                /* Codes_SRS_GBALLOC_01_004: [If the underlying malloc call is successful, gb_malloc shall increment the total memory used with the amount indicated by size.] */
-                allocation->ptr = result;
-                allocation->size = size;
-                allocation->next = head;
-                head = allocation;
-
-                g_allocations++;
-                totalSize += size;
-                /* Codes_SRS_GBALLOC_01_011: [The maximum total memory used shall be the maximum of the total memory used at any point.] */
-                if (maxSize < totalSize)
+                const char* name = GBALLOC_LOAD(tags[i].name);
+                if (name == NULL)
+                {
+                    name = claimTagSlot(&tags[i].name, tag);
+                }
+                if ((name == tag) || (strcmp(name, tag) == 0))
                 {
-                    maxSize = totalSize;
+                    result = i;
+                    break;
                 }
             }
         }
-
-        (void)Unlock(gballocThreadSafeLock);
     }
-    
     return result;
 }
 
-void* gballoc_calloc(size_t nmemb, size_t size)
+static void countAllocation(size_t size, size_t tagIndex)
 {
-    void* result;
+    size_t sizeClassIndex = getSizeClass(size);
+    GBALLOC_SIZE_CLASS_COUNTERS* sizeClass = &sizeClasses[sizeClassIndex];
+    GBALLOC_TAG_COUNTERS* tag = &tags[tagIndex];
 
-    if (gballocState != GBALLOC_STATE_INIT)
-    {
-        /* Codes_SRS_GBALLOC_01_040: [If gballoc was not initialized gballoc_calloc shall simply call calloc without any memory tracking being performed.] */
-        result = calloc(nmemb, size);
-    }
-    /* Codes_SRS_GBALLOC_01_031: [gballoc_calloc shall ensure thread safety by using the lock created by gballoc_Init]  */
-    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    (void)GBALLOC_ADD(sizeClass->allocations, 1);
+    (void)GBALLOC_ADD(sizeClass->liveBlocks, 1);
+    (void)GBALLOC_ADD(sizeClass->liveBytes, size);
+    (void)GBALLOC_ADD(tag->histogram[sizeClassIndex], 1);
+    raiseMaximum(&tag->peakBytes, GBALLOC_ADD(tag->liveBytes, size));
+    /* Codes_SRS_GBALLOC_01_011: [The maximum total memory used shall be the maximum of the total memory used at any point.] */
+    raiseMaximum(&maxSize, GBALLOC_ADD(totalSize, size));
+}
+
+static void countRelease(size_t size, size_t tagIndex)
+{
+    GBALLOC_SIZE_CLASS_COUNTERS* sizeClass = &sizeClasses[getSizeClass(size)];
+
+    (void)GBALLOC_SUB(sizeClass->liveBlocks, 1);
+    (void)GBALLOC_SUB(sizeClass->liveBytes, size);
+    (void)GBALLOC_SUB(tags[tagIndex].liveBytes, size);
+    (void)GBALLOC_SUB(totalSize, size);
+}
+
+static void* trackBlock(GBALLOC_HEADER* header, size_t size, size_t flags)
+{
+    header->block.size = size;
+    header->block.check = GBALLOC_CHECK_OF(size, flags);
+    return header + 1;
+}
+
+/*returns the header of a block allocated by gballoc_malloc/calloc/realloc while gballoc was initialized, NULL for any other pointer*/
+static GBALLOC_HEADER* findBlock(void* ptr)
+{
+    GBALLOC_HEADER* result;
+    if ((ptr == NULL) ||
+        (GBALLOC_LOAD(trackedBlocks) == 0))
     {
-        /* Codes_SRS_GBALLOC_01_046: [If acquiring the lock fails, gballoc_calloc shall return NULL.] */
-        LogError("Failed to get the Lock.");
         result = NULL;
     }
     else
     {
-        ALLOCATION* allocation = (ALLOCATION*)malloc(sizeof(ALLOCATION));
-        if (allocation == NULL)
+        result = GBALLOC_HEADER_OF(ptr);
+        if (result->block.check != GBALLOC_CHECK_OF(result->block.size, GBALLOC_FLAGS_OF(result->block.check)))
         {
             result = NULL;
         }
-        else
-        {
-            /* Codes_SRS_GBALLOC_01_020: [gballoc_calloc shall call the C99 calloc function and return its result.] */
-            result = calloc(nmemb, size);
-            if (result == NULL)
-            {
-                /* Codes_SRS_GBALLOC_01_022: [When the underlying calloc call fails, gballoc_calloc shall return NULL and size should not be counted towards total memory used.] */
-                free(allocation);
-            }
-            else
-            {
-                /* Codes_SRS_GBALLOC_01_021: [If the underlying calloc call is successful, gballoc_calloc shall increment the total memory used with nmemb*size.] */
-                allocation->ptr = result;
-                allocation->size = nmemb * size;
-                allocation->next = head;
-                head = allocation;
-                g_allocations++;
-
-                totalSize += allocation->size;
-                /* Codes_SRS_GBALLOC_01_011: [The maximum total memory used shall be the maximum of the total memory used at any point.] */
-                if (maxSize < totalSize)
-                {
-                    maxSize = totalSize;
-                }
-            }
-        }
+    }
+    return result;
+}
 
-        (void)Unlock(gballocThreadSafeLock);
+/*a block that went through gballoc_free already, it must not reach the C library*/
+static int isFreedBlock(void* ptr)
+{
+    return (ptr != NULL) &&
+        ((gballocState == GBALLOC_STATE_INIT) || (GBALLOC_LOAD(trackedBlocks) != 0)) &&
+        (GBALLOC_HEADER_OF(ptr)->block.check == GBALLOC_FREED_CHECK);
+}
+
+#if defined(GBALLOC_USE_SLABS)
+/*slabs are in ascending block size, GBALLOC_SLAB_COUNT when the size is bigger than the last one*/
+static size_t getSlabIndex(size_t size)
+{
+    size_t result = 0;
+    while ((result < GBALLOC_SLAB_COUNT) && (slabBlockSizes[result] < size))
+    {
+        result++;
     }
+    return result;
+}
+
+/*sizes are counted in headers, so that every block stays aligned. A block is its link, its header and its user part*/
+#define GBALLOC_SLAB_PAGE_HEADERS ((sizeof(GBALLOC_SLAB_PAGE) + sizeof(GBALLOC_HEADER) - 1) / sizeof(GBALLOC_HEADER))
 
+static size_t getSlabStride(size_t slabIndex)
+{
+    size_t blockSize = (slabBlockSizes[slabIndex] < sizeof(GBALLOC_HEADER*)) ? sizeof(GBALLOC_HEADER*) : slabBlockSizes[slabIndex];
+    return 2 + (blockSize + sizeof(GBALLOC_HEADER) - 1) / sizeof(GBALLOC_HEADER);
+}
+
+static size_t getSlabPageBlocks(size_t slabIndex)
+{
+    size_t stride = getSlabStride(slabIndex);
+    size_t result = (GBALLOC_SLAB_PAGE_SIZE / sizeof(GBALLOC_HEADER) > GBALLOC_SLAB_PAGE_HEADERS + stride) ?
+        (GBALLOC_SLAB_PAGE_SIZE / sizeof(GBALLOC_HEADER) - GBALLOC_SLAB_PAGE_HEADERS) / stride : 1;
     return result;
 }
 
-void* gballoc_realloc(void* ptr, size_t size)
+static void linkSlabPage(GBALLOC_SLAB* slab, GBALLOC_SLAB_PAGE* page)
 {
-    ALLOCATION* curr;
-    void* result;
-    ALLOCATION* allocation = NULL;
+    page->previous = NULL;
+    page->next = slab->available;
+    if (slab->available != NULL)
+    {
+        slab->available->previous = page;
+    }
+    slab->available = page;
+}
 
-    if (gballocState != GBALLOC_STATE_INIT)
+static void unlinkSlabPage(GBALLOC_SLAB* slab, GBALLOC_SLAB_PAGE* page)
+{
+    if (page->previous == NULL)
     {
-        /* Codes_SRS_GBALLOC_01_041: [If gballoc was not initialized gballoc_realloc shall shall simply call realloc without any memory tracking being performed.] */
-        result = realloc(ptr, size);
+        slab->available = page->next;
+    }
+    else
+    {
+        page->previous->next = page->next;
+    }
+    if (page->next != NULL)
+    {
+        page->next->previous = page->previous;
+    }
+}
+
+/*called with the slab lock taken*/
+static void addSlabPage(GBALLOC_SLAB* slab, size_t slabIndex)
+{
+    size_t stride = getSlabStride(slabIndex);
+    size_t count = getSlabPageBlocks(slabIndex);
+    GBALLOC_SLAB_PAGE* page = (GBALLOC_SLAB_PAGE*)malloc((GBALLOC_SLAB_PAGE_HEADERS + count * stride) * sizeof(GBALLOC_HEADER));
+    if (page != NULL)
+    {
+        GBALLOC_HEADER* blocks = (GBALLOC_HEADER*)page + GBALLOC_SLAB_PAGE_HEADERS;
+        size_t i;
+        page->freeList = NULL;
+        for (i = count; i > 0; i--)
+        {
+            GBALLOC_HEADER* block = blocks + (i - 1) * stride + 1;
+            ((GBALLOC_SLAB_LINK*)block - 1)->page = page;
+            *(GBALLOC_HEADER**)(block + 1) = page->freeList;
+            page->freeList = block;
+        }
+        page->slabIndex = slabIndex;
+        page->blocks = count;
+        page->freeBlocks = count;
+        linkSlabPage(slab, page);
+        slab->pages++;
+        slab->blocks += count;
+        slab->freeBlocks += count;
     }
-    /* Codes_SRS_GBALLOC_01_032: [gballoc_realloc shall ensure thread safety by using the lock created by gballoc_Init.] */
-    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+}
+
+static GBALLOC_HEADER* takeSlabBlock(size_t slabIndex)
+{
+    GBALLOC_HEADER* result;
+    GBALLOC_SLAB* slab = &slabs[slabIndex];
+    if (Lock(slab->lock) != LOCK_OK)
     {
-        /* Codes_SRS_GBALLOC_01_047: [If acquiring the lock fails, gballoc_realloc shall return NULL.] */
         LogError("Failed to get the Lock.");
         result = NULL;
     }
     else
     {
-        if (ptr == NULL)
+        GBALLOC_SLAB_PAGE* page;
+        if (slab->available == NULL)
         {
-            /* Codes_SRS_GBALLOC_01_017: [When ptr is NULL, gballoc_realloc shall call the underlying realloc with ptr being NULL and the realloc result shall be tracked by gballoc.] */
-            allocation = (ALLOCATION*)malloc(sizeof(ALLOCATION));
-        }
-        else
-        {
-            curr = head;
-            while (curr != NULL)
-            {
-                if (curr->ptr == ptr)
-                {
-                    allocation = curr;
-                    break;
-                }
-                else
-                {
-                    curr = (ALLOCATION*)curr->next;
-                }
-            }
+            addSlabPage(slab, slabIndex);
         }
 
-        if (allocation == NULL)
+        page = slab->available;
+        if (page == NULL)
         {
-            /* Codes_SRS_GBALLOC_01_015: [When allocating memory used for tracking by gballoc_realloc fails, gballoc_realloc shall return NULL and no change should be made to the counted total memory usage.] */
-            /* Codes_SRS_GBALLOC_01_016: [When the ptr pointer cannot be found in the pointers tracked by gballoc, gballoc_realloc shall return NULL and the underlying realloc shall not be called.] */
             result = NULL;
         }
         else
         {
-            result = realloc(ptr, size);
-            if (result == NULL)
-            {
-                /* Codes_SRS_GBALLOC_01_014: [When the underlying realloc call fails, gballoc_realloc shall return NULL and no change should be made to the counted total memory usage.] */
-                if (ptr == NULL)
-                {
-                    free(allocation);
-                }
-            }
-            else
+            result = page->freeList;
+            page->freeList = *(GBALLOC_HEADER**)(result + 1);
+            page->freeBlocks--;
+            slab->freeBlocks--;
+            if (page->freeBlocks == 0)
             {
-                if (ptr != NULL)
-                {
-                    /* Codes_SRS_GBALLOC_01_006: [If the underlying realloc call is successful, gballoc_realloc shall look up the size associated with the pointer ptr and decrease the total memory used with that size.] */
-                    allocation->ptr = result;
-                    totalSize -= allocation->size;
-                    allocation->size = size;
-                }
-                else
-                {
-                    /* add block */
-                    allocation->ptr = result;
-                    allocation->size = size;
-                    allocation->next = head;
-                    head = allocation;
-                }
-
-                /* Codes_SRS_GBALLOC_01_007: [If realloc is successful, gballoc_realloc shall also increment the total memory used value tracked by this module.] */
-                totalSize += size;
-                g_allocations++;
-
-                /* Codes_SRS_GBALLOC_01_011: [The maximum total memory used shall be the maximum of the total memory used at any point.] */
-                if (maxSize < totalSize)
-                {
-                    maxSize = totalSize;
-                }
+                unlinkSlabPage(slab, page);
             }
         }
-
-        (void)Unlock(gballocThreadSafeLock);
+        (void)Unlock(slab->lock);
     }
-
     return result;
 }
 
-void gballoc_free(void* ptr)
+/*a page that gets empty goes back to malloc, unless it is the only one left with free blocks*/
+static void putSlabBlock(GBALLOC_HEADER* header)
 {
-    ALLOCATION* curr = head;
-    ALLOCATION* prev = NULL;
-
-    if (gballocState != GBALLOC_STATE_INIT)
-    {
-        /* Codes_SRS_GBALLOC_01_042: [If gballoc was not initialized gballoc_free shall shall simply call free.] */
-        free(ptr);
-    }
-    /* Codes_SRS_GBALLOC_01_033: [gballoc_free shall ensure thread safety by using the lock created by gballoc_Init.] */
-    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    GBALLOC_SLAB_PAGE* page = ((GBALLOC_SLAB_LINK*)header - 1)->page;
+    GBALLOC_SLAB* slab = &slabs[page->slabIndex];
+    if (Lock(slab->lock) != LOCK_OK)
     {
-        /* Codes_SRS_GBALLOC_01_049: [If acquiring the lock fails, gballoc_free shall do nothing.] */
+        /*the block is lost to its slab, but it is not handed out twice*/
         LogError("Failed to get the Lock.");
     }
     else
     {
-        /* Codes_SRS_GBALLOC_01_009: [gballoc_free shall also look up the size associated with the ptr pointer and decrease the total memory used with the associated size amount.] */
-        while (curr != NULL)
+        *(GBALLOC_HEADER**)(header + 1) = page->freeList;
+        page->freeList = header;
+        page->freeBlocks++;
+        slab->freeBlocks++;
+        if (page->freeBlocks == 1)
         {
-            if (curr->ptr == ptr)
-            {
-                /* Codes_SRS_GBALLOC_01_008: [gballoc_free shall call the C99 free function.] */
-                free(ptr);
-                totalSize -= curr->size;
-                if (prev != NULL)
-                {
-                    prev->next = curr->next;
-                }
-                else
-                {
-                    head = (ALLOCATION*)curr->next;
-                }
-
-                free(curr);
-                break;
-            }
-
-            prev = curr;
-            curr = (ALLOCATION*)curr->next;
+            linkSlabPage(slab, page);
         }
 
-        if ((curr == NULL) && (ptr != NULL))
+        if ((page->freeBlocks == page->blocks) &&
+            ((page->previous != NULL) || (page->next != NULL)))
         {
-            /* Codes_SRS_GBALLOC_01_019: [When the ptr pointer cannot be found in the pointers tracked by gballoc, gballoc_free shall not free any memory.] */
-
-            /* could not find the allocation */
-            LogError("Could not free allocation for address %p (not found)", ptr);
+            unlinkSlabPage(slab, page);
+            slab->pages--;
+            slab->blocks -= page->blocks;
+            slab->freeBlocks -= page->blocks;
+            free(page);
         }
-        (void)Unlock(gballocThreadSafeLock);
+        (void)Unlock(slab->lock);
     }
 }
+#endif
 
-size_t gballoc_getMaximumMemoryUsed(void)
+/*the block comes from its slab when there is one for the size, from malloc when there is none or it cannot grow.
+flags gets GBALLOC_SLAB_FLAG for slab blocks*/
+static GBALLOC_HEADER* allocateBlock(size_t size, int zeroed, size_t* flags)
 {
-    size_t result;
-
-    /* Codes_SRS_GBALLOC_01_038: [If gballoc was not initialized gballoc_getMaximumMemoryUsed shall return MAX_INT_SIZE.] */
-    if (gballocState != GBALLOC_STATE_INIT)
+    GBALLOC_HEADER* result = NULL;
+#if defined(GBALLOC_USE_SLABS)
+    size_t slabIndex = getSlabIndex(size);
+    if (slabIndex < GBALLOC_SLAB_COUNT)
     {
-        LogError("gballoc is not initialized.");
-        result = SIZE_MAX;
+        result = takeSlabBlock(slabIndex);
+        if ((result != NULL) && zeroed)
+        {
+            (void)memset(result + 1, 0, size);
+        }
     }
-    /* Codes_SRS_GBALLOC_01_034: [gballoc_getMaximumMemoryUsed shall ensure thread safety by using the lock created by gballoc_Init.]  */
-    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+#endif
+    if (result != NULL)
     {
-        /* Codes_SRS_GBALLOC_01_050: [If the lock cannot be acquired, gballoc_getMaximumMemoryUsed shall return SIZE_MAX.]  */
-        LogError("Failed to get the Lock.");
-        result = SIZE_MAX;
+        *flags = GBALLOC_SLAB_FLAG;
     }
     else
     {
-        /* Codes_SRS_GBALLOC_01_010: [gballoc_getMaximumMemoryUsed shall return the maximum amount of total memory used recorded since the module initialization.] */
-        result = maxSize;
-        (void)Unlock(gballocThreadSafeLock);
+        result = (GBALLOC_HEADER*)(zeroed ? calloc(1, sizeof(GBALLOC_HEADER) + size) : malloc(sizeof(GBALLOC_HEADER) + size));
+        *flags = 0;
     }
-
     return result;
 }
 
-size_t gballoc_getCurrentMemoryUsed(void)
+static void freeBlockMemory(GBALLOC_HEADER* header)
 {
-    size_t result;
-
-    /* Codes_SRS_GBALLOC_01_044: [If gballoc was not initialized gballoc_getCurrentMemoryUsed shall return SIZE_MAX.] */
-    if (gballocState != GBALLOC_STATE_INIT)
-    {
-        LogError("gballoc is not initialized.");
-        result = SIZE_MAX;
-    }
-    /* Codes_SRS_GBALLOC_01_036: [gballoc_getCurrentMemoryUsed shall ensure thread safety by using the lock created by gballoc_Init.]*/
-    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    /*a second free of the same pointer is not mistaken for a tracked block, nor handed to the C library*/
+    size_t check = header->block.check;
+    header->block.check = GBALLOC_FREED_CHECK;
+#if defined(GBALLOC_USE_SLABS)
+    if (GBALLOC_IS_SLAB(check))
     {
-        /* Codes_SRS_GBALLOC_01_051: [If the lock cannot be acquired, gballoc_getCurrentMemoryUsed shall return SIZE_MAX.] */
-        LogError("Failed to get the Lock.");
-        result = SIZE_MAX;
+        putSlabBlock(header);
     }
     else
+#else
+    (void)check;
+#endif
     {
-        /*Codes_SRS_GBALLOC_02_001: [gballoc_getCurrentMemoryUsed shall return the currently used memory size.] */
-        result = totalSize;
-        (void)Unlock(gballocThreadSafeLock);
+        free(header);
     }
-
-    return result;
 }
 
-size_t gballoc_getAllocationCount(void)
+static GBALLOC_HEADER* reallocateBlock(GBALLOC_HEADER* header, size_t size, size_t* flags)
 {
-    size_t result;
-
-    /* Codes_SRS_GBALLOC_07_001: [ If gballoc was not initialized gballoc_getAllocationCount shall return 0. ] */
-    if (gballocState != GBALLOC_STATE_INIT)
+    GBALLOC_HEADER* result;
+#if defined(GBALLOC_USE_SLABS)
+    size_t slabIndex = getSlabIndex(size);
+    if ((header != NULL) &&
+        GBALLOC_IS_SLAB(header->block.check))
     {
-        LogError("gballoc is not initialized.");
-        result = 0;
+        if (slabIndex == getSlabIndex(header->block.size))
+        {
+            /*still the same slab, the block stays where it is*/
+            result = header;
+            *flags = GBALLOC_SLAB_FLAG;
+        }
+        else
+        {
+            result = allocateBlock(size, 0, flags);
+            if (result != NULL)
+            {
+                (void)memcpy(result + 1, header + 1, (size < header->block.size) ? size : header->block.size);
+                freeBlockMemory(header);
+            }
+        }
     }
-    /* Codes_SRS_GBALLOC_07_002: [ gballoc_getAllocationCount shall ensure thread safety by using the lock created by gballoc_Init ] */
-    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+    else if ((header == NULL) &&
+        (slabIndex < GBALLOC_SLAB_COUNT))
     {
-        /* Codes_SRS_GBALLOC_07_003: [ If the lock cannot be acquired, gballoc_getAllocationCount shall return 0. ] */
-        LogError("Failed to get the Lock.");
-        result = 0;
+        result = allocateBlock(size, 0, flags);
     }
     else
+#endif
     {
-        /* Codes_SRS_GBALLOC_07_004: [ gballoc_getAllocationCount shall return the currently number of allocations. ] */
-        result = g_allocations;
-        (void)Unlock(gballocThreadSafeLock);
+        result = (GBALLOC_HEADER*)realloc(header, sizeof(GBALLOC_HEADER) + size);
+        *flags = 0;
     }
+    return result;
+}
+
+static void releaseBlock(GBALLOC_HEADER* header)
+{
+    countRelease(header->block.size, GBALLOC_TAG_INDEX_OF(header->block.check));
+    (void)GBALLOC_SUB(trackedBlocks, 1);
+    freeBlockMemory(header);
+}
 
+#if defined(GBALLOC_USE_SLABS)
+static int createSlabLocks(void)
+{
+    int result = 0;
+    size_t i;
+    for (i = 0; (i < GBALLOC_SLAB_COUNT) && (result == 0); i++)
+    {
+        if ((slabs[i].lock == NULL) &&
+            ((slabs[i].lock = Lock_Init()) == NULL))
+        {
+            LogError("Failed to create the lock of slab %lu.", (unsigned long)i);
+            result = __FAILURE__;
+        }
+    }
     return result;
 }
+#endif
 
-void gballoc_resetMetrics()
+int gballoc_init(void)
 {
-    /* Codes_SRS_GBALLOC_07_005: [ If gballoc was not initialized gballoc_reset Metrics shall do nothing.] */
-    if (gballocState != GBALLOC_STATE_INIT)
+    int result;
+
+    if (gballocState != GBALLOC_STATE_NOT_INIT)
     {
-        LogError("gballoc is not initialized.");
+        /* Codes_SRS_GBALLOC_01_025: [Init after Init shall fail and return a non-zero value.] */
+        result = __FAILURE__;
     }
-    /* Codes_SRS_GBALLOC_07_006: [ gballoc_resetMetrics shall ensure thread safety by using the lock created by gballoc_Init ]*/
-    else if (LOCK_OK != Lock(gballocThreadSafeLock))
+#if defined(GBALLOC_USE_SLABS)
+    else if (createSlabLocks() != 0)
     {
-        /* Codes_SRS_GBALLOC_07_007: [ If the lock cannot be acquired, gballoc_reset Metrics shall do nothing.] */
-        LogError("Failed to get the Lock.");
+        /* Codes_SRS_GBALLOC_01_027: [If the Lock creation fails, gballoc_init shall return a non-zero value.]*/
+        result = __FAILURE__;
     }
+#endif
     else
     {
+        size_t i;
+        gballocState = GBALLOC_STATE_INIT;
+
+        /*blocks tracked before a gballoc_deinit are still counted, their release would take the counters below 0*/
+        if (GBALLOC_LOAD(trackedBlocks) != 0)
+        {
+            LogInfo("%lu tracked blocks are still alive, the counters are kept", (unsigned long)GBALLOC_LOAD(trackedBlocks));
+        }
+        else
+        {
+            /* Codes_ SRS_GBALLOC_01_002: [Upon initialization the total memory used and maximum total memory used tracked by the module shall be set to 0.] */
+            GBALLOC_STORE(totalSize, 0);
+            GBALLOC_STORE(maxSize, 0);
+            for (i = 0; i < GBALLOC_SIZE_CLASS_COUNT; i++)
+            {
+                GBALLOC_STORE(sizeClasses[i].allocations, 0);
+                GBALLOC_STORE(sizeClasses[i].liveBlocks, 0);
+                GBALLOC_STORE(sizeClasses[i].liveBytes, 0);
+            }
+            /*the tag names are kept, a slot keeps its name for good*/
+            for (i = 0; i < GBALLOC_TAG_COUNT; i++)
+            {
+                size_t j;
+                GBALLOC_STORE(tags[i].liveBytes, 0);
+                GBALLOC_STORE(tags[i].peakBytes, 0);
+                for (j = 0; j < GBALLOC_SIZE_CLASS_COUNT; j++)
+                {
+                    GBALLOC_STORE(tags[i].histogram[j], 0);
+                }
+            }
+        }
+
+        /* Codes_SRS_GBALLOC_01_024: [gballoc_init shall initialize the gballoc module and return 0 upon success.] */
+        result = 0;
+    }
+
+    return result;
+}
+
+void gballoc_deinit(void)
+{
+    gballocState = GBALLOC_STATE_NOT_INIT;
+}
+
+void* gballoc_malloc(size_t size)
+{
+    return gballoc_malloc_tagged(size, NULL);
+}
+
+void* gballoc_malloc_tagged(size_t size, const char* tag)
+{
+    void* result;
+
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        /* Codes_SRS_GBALLOC_01_039: [If gballoc was not initialized gballoc_malloc shall simply call malloc without any memory tracking being performed.] */
+        result = malloc(size);
+    }
+    else if (size > SIZE_MAX - sizeof(GBALLOC_HEADER))
+    {
+        LogError("Allocation size %lu is too big", (unsigned long)size);
+        result = NULL;
+    }
+    else
+    {
+        size_t flags;
+        /* Codes_SRS_GBALLOC_01_003: [gb_malloc shall call the C99 malloc function and return its result.] */
+        GBALLOC_HEADER* header = allocateBlock(size, 0, &flags);
+        if (header == NULL)
+        {
+            /* Codes_SRS_GBALLOC_01_012: [When the underlying malloc call fails, gballoc_malloc shall return NULL and size should not be counted towards total memory used.] */
+            result = NULL;
+        }
+        else
+        {
+            /* Codes_SRS_GBALLOC_01_004: [If the underlying malloc call is successful, gb_malloc shall increment the total memory used with the amount indicated by size.] */
+            size_t tagIndex = getTagIndex(tag);
+            (void)GBALLOC_ADD(trackedBlocks, 1);
+            countAllocation(size, tagIndex);
+            result = trackBlock(header, size, tagIndex | flags);
+        }
+    }
+
+    return result;
+}
+
+void* gballoc_calloc(size_t nmemb, size_t size)
+{
+    return gballoc_calloc_tagged(nmemb, size, NULL);
+}
+
+void* gballoc_calloc_tagged(size_t nmemb, size_t size, const char* tag)
+{
+    void* result;
+
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        /* Codes_SRS_GBALLOC_01_040: [If gballoc was not initialized gballoc_calloc shall simply call calloc without any memory tracking being performed.] */
+        result = calloc(nmemb, size);
+    }
+    else if ((size != 0) &&
+        (nmemb > (SIZE_MAX - sizeof(GBALLOC_HEADER)) / size))
+    {
+        LogError("Allocation size %lu * %lu is too big", (unsigned long)nmemb, (unsigned long)size);
+        result = NULL;
+    }
+    else
+    {
+        size_t flags;
+        /* Codes_SRS_GBALLOC_01_020: [gballoc_calloc shall call the C99 calloc function and return its result.] */
+        GBALLOC_HEADER* header = allocateBlock(nmemb * size, 1, &flags);
+        if (header == NULL)
+        {
+            /* Codes_SRS_GBALLOC_01_022: [When the underlying calloc call fails, gballoc_calloc shall return NULL and size should not be counted towards total memory used.] */
+            result = NULL;
+        }
+        else
+        {
+            /* Codes_SRS_GBALLOC_01_021: [If the underlying calloc call is successful, gballoc_calloc shall increment the total memory used with nmemb*size.] */
+            size_t tagIndex = getTagIndex(tag);
+            (void)GBALLOC_ADD(trackedBlocks, 1);
+            countAllocation(nmemb * size, tagIndex);
+            result = trackBlock(header, nmemb * size, tagIndex | flags);
+        }
+    }
+
+    return result;
+}
+
+void* gballoc_realloc(void* ptr, size_t size)
+{
+    return gballoc_realloc_tagged(ptr, size, NULL);
+}
+
+/*the reallocated block is counted for the tag of the caller*/
+void* gballoc_realloc_tagged(void* ptr, size_t size, const char* tag)
+{
+    void* result;
+    GBALLOC_HEADER* header = findBlock(ptr);
+
+    if ((gballocState != GBALLOC_STATE_INIT) &&
+        (header == NULL))
+    {
+        /* Codes_SRS_GBALLOC_01_041: [If gballoc was not initialized gballoc_realloc shall shall simply call realloc without any memory tracking being performed.] */
+        result = realloc(ptr, size);
+    }
+    else if (isFreedBlock(ptr))
+    {
+        LogError("Could not reallocate address %p (already freed)", ptr);
+        result = NULL;
+    }
+    else if ((ptr != NULL) &&
+        (header == NULL))
+    {
+        /*allocated before gballoc_init or in a translation unit without GB_MEASURE_MEMORY_FOR_THIS, it stays untracked*/
+        result = realloc(ptr, size);
+    }
+    else if (size > SIZE_MAX - sizeof(GBALLOC_HEADER))
+    {
+        LogError("Allocation size %lu is too big", (unsigned long)size);
+        result = NULL;
+    }
+    else
+    {
+        /* Codes_SRS_GBALLOC_01_017: [When ptr is NULL, gballoc_realloc shall call the underlying realloc with ptr being NULL and the realloc result shall be tracked by gballoc.] */
+        size_t oldSize = (header == NULL) ? 0 : header->block.size;
+        size_t oldTagIndex = (header == NULL) ? 0 : GBALLOC_TAG_INDEX_OF(header->block.check);
+        size_t flags;
+        GBALLOC_HEADER* newHeader = reallocateBlock(header, size, &flags);
+        if (newHeader == NULL)
+        {
+            /* Codes_SRS_GBALLOC_01_014: [When the underlying realloc call fails, gballoc_realloc shall return NULL and no change should be made to the counted total memory usage.] */
+            result = NULL;
+        }
+        else
+        {
+            size_t tagIndex = getTagIndex(tag);
+            if (header != NULL)
+            {
+                /* Codes_SRS_GBALLOC_01_006: [If the underlying realloc call is successful, gballoc_realloc shall look up the size associated with the pointer ptr and decrease the total memory used with that size.] */
+                countRelease(oldSize, oldTagIndex);
+            }
+            else
+            {
+                (void)GBALLOC_ADD(trackedBlocks, 1);
+            }
+
+            /* Codes_SRS_GBALLOC_01_007: [If realloc is successful, gballoc_realloc shall also increment the total memory used value tracked by this module.] */
+            countAllocation(size, tagIndex);
+            result = trackBlock(newHeader, size, tagIndex | flags);
+        }
+    }
+
+    return result;
+}
+
+void gballoc_free(void* ptr)
+{
+    GBALLOC_HEADER* header = findBlock(ptr);
+
+    if (header != NULL)
+    {
+        /* Codes_SRS_GBALLOC_01_008: [gballoc_free shall call the C99 free function.] */
+        /* Codes_SRS_GBALLOC_01_009: [gballoc_free shall also look up the size associated with the ptr pointer and decrease the total memory used with the associated size amount.] */
+        releaseBlock(header);
+    }
+    else if (isFreedBlock(ptr))
+    {
+        LogError("Could not free allocation for address %p (already freed)", ptr);
+    }
+    else
+    {
+        /* Codes_SRS_GBALLOC_01_042: [If gballoc was not initialized gballoc_free shall shall simply call free.] */
+        /*the same for a block allocated before gballoc_init or in a translation unit without GB_MEASURE_MEMORY_FOR_THIS*/
+        free(ptr);
+    }
+}
+
+size_t gballoc_getMaximumMemoryUsed(void)
+{
+    size_t result;
+
+    /* Codes_SRS_GBALLOC_01_038: [If gballoc was not initialized gballoc_getMaximumMemoryUsed shall return MAX_INT_SIZE.] */
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+        result = SIZE_MAX;
+    }
+    else
+    {
+        /* Codes_SRS_GBALLOC_01_010: [gballoc_getMaximumMemoryUsed shall return the maximum amount of total memory used recorded since the module initialization.] */
+        result = GBALLOC_LOAD(maxSize);
+    }
+
+    return result;
+}
+
+size_t gballoc_getCurrentMemoryUsed(void)
+{
+    size_t result;
+
+    /* Codes_SRS_GBALLOC_01_044: [If gballoc was not initialized gballoc_getCurrentMemoryUsed shall return SIZE_MAX.] */
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+        result = SIZE_MAX;
+    }
+    else
+    {
+        /*Codes_SRS_GBALLOC_02_001: [gballoc_getCurrentMemoryUsed shall return the currently used memory size.] */
+        result = GBALLOC_LOAD(totalSize);
+    }
+
+    return result;
+}
+
+size_t gballoc_getAllocationCount(void)
+{
+    size_t result;
+
+    /* Codes_SRS_GBALLOC_07_001: [ If gballoc was not initialized gballoc_getAllocationCount shall return 0. ] */
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+        result = 0;
+    }
+    else
+    {
+        size_t i;
+        /* Codes_SRS_GBALLOC_07_004: [ gballoc_getAllocationCount shall return the currently number of allocations. ] */
+        result = 0;
+        for (i = 0; i < GBALLOC_SIZE_CLASS_COUNT; i++)
+        {
+            result += GBALLOC_LOAD(sizeClasses[i].allocations);
+        }
+    }
+
+    return result;
+}
+
+int gballoc_getSizeClassStats(size_t sizeClass, GBALLOC_SIZE_CLASS_STATS* stats)
+{
+    int result;
+
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+        result = __FAILURE__;
+    }
+    else if ((sizeClass >= GBALLOC_SIZE_CLASS_COUNT) ||
+        (stats == NULL))
+    {
+        LogError("Invalid argument sizeClass=%lu stats=%p", (unsigned long)sizeClass, stats);
+        result = __FAILURE__;
+    }
+    else
+    {
+        stats->maximumSize = (sizeClass == GBALLOC_SIZE_CLASS_COUNT - 1) ? SIZE_MAX : ((size_t)GBALLOC_SMALLEST_SIZE_CLASS << sizeClass);
+        stats->allocations = GBALLOC_LOAD(sizeClasses[sizeClass].allocations);
+        stats->liveBlocks = GBALLOC_LOAD(sizeClasses[sizeClass].liveBlocks);
+        stats->liveBytes = GBALLOC_LOAD(sizeClasses[sizeClass].liveBytes);
+        result = 0;
+    }
+
+    return result;
+}
+
+void gballoc_resetMetrics()
+{
+    /* Codes_SRS_GBALLOC_07_005: [ If gballoc was not initialized gballoc_reset Metrics shall do nothing.] */
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+    }
+    else
+    {
+        size_t i;
         /* Codes_SRS_GBALLOC_07_008: [ gballoc_resetMetrics shall reset the total allocation size, max allocation size and number of allocation to zero. ] */
-        totalSize = 0;
-        maxSize = 0;
-        g_allocations = 0;
-        (void)Unlock(gballocThreadSafeLock);
+        GBALLOC_STORE(totalSize, 0);
+        GBALLOC_STORE(maxSize, 0);
+        for (i = 0; i < GBALLOC_SIZE_CLASS_COUNT; i++)
+        {
+            GBALLOC_STORE(sizeClasses[i].allocations, 0);
+        }
+        for (i = 0; i < GBALLOC_TAG_COUNT; i++)
+        {
+            size_t j;
+            GBALLOC_STORE(tags[i].peakBytes, GBALLOC_LOAD(tags[i].liveBytes));
+            for (j = 0; j < GBALLOC_SIZE_CLASS_COUNT; j++)
+            {
+                GBALLOC_STORE(tags[i].histogram[j], 0);
+            }
+        }
+    }
+}
+
+int gballoc_getSlabStats(size_t slabIndex, GBALLOC_SLAB_STATS* stats)
+{
+    int result;
+
+#if defined(GBALLOC_USE_SLABS)
+    if ((slabIndex >= GBALLOC_SLAB_COUNT) ||
+        (stats == NULL))
+    {
+        /*also the way to find the slab count, so not logged*/
+        result = __FAILURE__;
+    }
+    else
+    {
+        GBALLOC_SLAB* slab = &slabs[slabIndex];
+        if ((slab->lock == NULL) ||
+            (Lock(slab->lock) != LOCK_OK))
+        {
+            LogError("Failed to get the Lock.");
+            result = __FAILURE__;
+        }
+        else
+        {
+            stats->blockSize = slabBlockSizes[slabIndex];
+            stats->pages = slab->pages;
+            stats->blocks = slab->blocks;
+            stats->freeBlocks = slab->freeBlocks;
+            stats->reservedBytes = slab->pages * (GBALLOC_SLAB_PAGE_HEADERS + getSlabPageBlocks(slabIndex) * getSlabStride(slabIndex)) * sizeof(GBALLOC_HEADER);
+            (void)Unlock(slab->lock);
+            result = 0;
+        }
+    }
+#else
+    (void)slabIndex;
+    (void)stats;
+    result = __FAILURE__;
+#endif
+
+    return result;
+}
+
+int gballoc_getTagStats(size_t tagIndex, GBALLOC_TAG_STATS* stats)
+{
+    int result;
+
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+        result = __FAILURE__;
+    }
+    else if ((tagIndex >= GBALLOC_TAG_COUNT) ||
+        (stats == NULL))
+    {
+        LogError("Invalid argument tagIndex=%lu stats=%p", (unsigned long)tagIndex, stats);
+        result = __FAILURE__;
+    }
+    else if ((tagIndex != 0) &&
+        (GBALLOC_LOAD(tags[tagIndex].name) == NULL))
+    {
+        /*not an error, the tags in use have been walked*/
+        result = __FAILURE__;
+    }
+    else
+    {
+        size_t i;
+        stats->tag = GBALLOC_LOAD(tags[tagIndex].name);
+        stats->allocations = 0;
+        for (i = 0; i < GBALLOC_SIZE_CLASS_COUNT; i++)
+        {
+            stats->histogram[i] = GBALLOC_LOAD(tags[tagIndex].histogram[i]);
+            stats->allocations += stats->histogram[i];
+        }
+        stats->liveBytes = GBALLOC_LOAD(tags[tagIndex].liveBytes);
+        stats->peakBytes = GBALLOC_LOAD(tags[tagIndex].peakBytes);
+        result = 0;
+    }
+
+    return result;
+}
+
+/*asks the C library, the heap is never probed with allocations: that would take memory from the other threads while
+it runs. keepcost is the free block at the top of the heap, a lower bound of the largest one. Both are 0 when the C
+library cannot tell*/
+static void getMallocFreeSpace(size_t* freeBytes, size_t* largestFreeBlock)
+{
+#if defined(GBALLOC_HAS_MALLINFO2)
+    struct mallinfo2 info = mallinfo2();
+    *freeBytes = info.fordblks;
+    *largestFreeBlock = info.keepcost;
+#elif defined(GBALLOC_HAS_MALLINFO)
+    struct mallinfo info = mallinfo();
+    *freeBytes = (size_t)info.fordblks;
+    *largestFreeBlock = (size_t)info.keepcost;
+#else
+    *freeBytes = 0;
+    *largestFreeBlock = 0;
+#endif
+}
+
+int gballoc_getHeapStats(GBALLOC_HEAP_STATS* stats)
+{
+    int result;
+
+    if (gballocState != GBALLOC_STATE_INIT)
+    {
+        LogError("gballoc is not initialized.");
+        result = __FAILURE__;
+    }
+    else if (stats == NULL)
+    {
+        LogError("Invalid argument stats=NULL");
+        result = __FAILURE__;
+    }
+    else
+    {
+        stats->currentMemoryUsed = gballoc_getCurrentMemoryUsed();
+        stats->maximumMemoryUsed = gballoc_getMaximumMemoryUsed();
+        stats->allocationCount = gballoc_getAllocationCount();
+        getMallocFreeSpace(&stats->freeBytes, &stats->largestFreeBlock);
+        if ((stats->largestFreeBlock != 0) &&
+            (stats->freeBytes > stats->largestFreeBlock))
+        {
+            size_t scale = (stats->freeBytes > SIZE_MAX / 100) ? 100 : 1;
+            stats->fragmentation = (unsigned int)((((stats->freeBytes - stats->largestFreeBlock) / scale) * 100) / (stats->freeBytes / scale));
+        }
+        else
+        {
+            stats->fragmentation = 0;
+        }
+        result = 0;
+    }
+
+    return result;
+}
+
+static void writeBytes(GBALLOC_WRITER* writer, const void* bytes, size_t count)
+{
+    if (writer->failed || (count > writer->size - writer->length))
+    {
+        writer->failed = 1;
+    }
+    else
+    {
+        (void)memcpy(writer->buffer + writer->length, bytes, count);
+        writer->length += count;
+    }
+}
+
+static void writeText(GBALLOC_WRITER* writer, const char* text)
+{
+    writeBytes(writer, text, strlen(text));
+}
+
+static void writeNumber(GBALLOC_WRITER* writer, size_t value)
+{
+    char digits[24];
+    size_t position = sizeof(digits);
+    do
+    {
+        digits[--position] = (char)('0' + (value % 10));
+        value /= 10;
+    } while (value != 0);
+    writeBytes(writer, digits + position, sizeof(digits) - position);
+}
+
+static void writeVarint(GBALLOC_WRITER* writer, size_t value)
+{
+    unsigned char byte;
+    do
+    {
+        byte = (unsigned char)(value & 0x7F);
+        value >>= 7;
+        if (value != 0)
+        {
+            byte |= 0x80;
+        }
+        writeBytes(writer, &byte, 1);
+    } while (value != 0);
+}
+
+/*only the file name of __FILE__ goes out*/
+static const char* getTagBaseName(const char* tag)
+{
+    const char* result = tag;
+    const char* c;
+    for (c = tag; *c != '\0'; c++)
+    {
+        if ((*c == '/') || (*c == '\\'))
+        {
+            result = c + 1;
+        }
+    }
+    return result;
+}
+
+static void writeJsonString(GBALLOC_WRITER* writer, const char* text)
+{
+    writeText(writer, "\"");
+    for (; *text != '\0'; text++)
+    {
+        if ((*text == '"') || (*text == '\\'))
+        {
+            writeText(writer, "\\");
+            writeBytes(writer, text, 1);
+        }
+        else if ((unsigned char)*text >= ' ')
+        {
+            writeBytes(writer, text, 1);
+        }
+    }
+    writeText(writer, "\"");
+}
+
+static void exportJson(GBALLOC_WRITER* writer, const GBALLOC_HEAP_STATS* heap)
+{
+    size_t i;
+    GBALLOC_SIZE_CLASS_STATS sizeClass;
+    GBALLOC_TAG_STATS tag;
+    const char* separator = "";
+
+    writeText(writer, "{\"used\":");
+    writeNumber(writer, heap->currentMemoryUsed);
+    writeText(writer, ",\"peak\":");
+    writeNumber(writer, heap->maximumMemoryUsed);
+    writeText(writer, ",\"allocations\":");
+    writeNumber(writer, heap->allocationCount);
+    writeText(writer, ",\"free\":");
+    writeNumber(writer, heap->freeBytes);
+    writeText(writer, ",\"largestFree\":");
+    writeNumber(writer, heap->largestFreeBlock);
+    writeText(writer, ",\"fragmentation\":");
+    writeNumber(writer, heap->fragmentation);
+    writeText(writer, ",\"smallestClass\":");
+    writeNumber(writer, GBALLOC_SMALLEST_SIZE_CLASS);
+    writeText(writer, ",\"classes\":[");
+    for (i = 0; gballoc_getSizeClassStats(i, &sizeClass) == 0; i++)
+    {
+        writeText(writer, (i == 0) ? "[" : ",[");
+        writeNumber(writer, sizeClass.allocations);
+        writeText(writer, ",");
+        writeNumber(writer, sizeClass.liveBlocks);
+        writeText(writer, ",");
+        writeNumber(writer, sizeClass.liveBytes);
+        writeText(writer, "]");
+    }
+    writeText(writer, "],\"tags\":[");
+    for (i = 0; gballoc_getTagStats(i, &tag) == 0; i++)
+    {
+        if ((tag.allocations != 0) || (tag.liveBytes != 0))
+        {
+            size_t j;
+            writeText(writer, separator);
+            writeText(writer, "{\"tag\":");
+            if (tag.tag == NULL)
+            {
+                writeText(writer, "null");
+            }
+            else
+            {
+                writeJsonString(writer, getTagBaseName(tag.tag));
+            }
+            writeText(writer, ",\"live\":");
+            writeNumber(writer, tag.liveBytes);
+            writeText(writer, ",\"peak\":");
+            writeNumber(writer, tag.peakBytes);
+            writeText(writer, ",\"histogram\":[");
+            for (j = 0; j < GBALLOC_SIZE_CLASS_COUNT; j++)
+            {
+                if (j != 0)
+                {
+                    writeText(writer, ",");
+                }
+                writeNumber(writer, tag.histogram[j]);
+            }
+            writeText(writer, "]}");
+            separator = ",";
+        }
+    }
+    writeText(writer, "]}");
+    writeBytes(writer, "", 1);
+}
+
+static void exportBinary(GBALLOC_WRITER* writer, const GBALLOC_HEAP_STATS* heap)
+{
+    size_t i;
+    size_t tagCount = 0;
+    GBALLOC_SIZE_CLASS_STATS sizeClass;
+    GBALLOC_TAG_STATS tag;
+    unsigned char version = 1;
+
+    writeBytes(writer, &version, 1);
+    writeVarint(writer, heap->currentMemoryUsed);
+    writeVarint(writer, heap->maximumMemoryUsed);
+    writeVarint(writer, heap->allocationCount);
+    writeVarint(writer, heap->freeBytes);
+    writeVarint(writer, heap->largestFreeBlock);
+    writeVarint(writer, heap->fragmentation);
+    writeVarint(writer, GBALLOC_SMALLEST_SIZE_CLASS);
+    writeVarint(writer, GBALLOC_SIZE_CLASS_COUNT);
+    for (i = 0; gballoc_getSizeClassStats(i, &sizeClass) == 0; i++)
+    {
+        writeVarint(writer, sizeClass.allocations);
+        writeVarint(writer, sizeClass.liveBlocks);
+        writeVarint(writer, sizeClass.liveBytes);
+    }
+
+    for (i = 0; gballoc_getTagStats(i, &tag) == 0; i++)
+    {
+        tagCount++;
+    }
+    /*every slot in use goes out, so the count is known before the tags are written*/
+    writeVarint(writer, tagCount);
+    for (i = 0; i < tagCount; i++)
+    {
+        const char* name;
+        size_t j;
+        if (gballoc_getTagStats(i, &tag) != 0)
+        {
+            writer->failed = 1;
+            break;
+        }
+        name = (tag.tag == NULL) ? "" : getTagBaseName(tag.tag);
+        writeVarint(writer, strlen(name));
+        writeText(writer, name);
+        writeVarint(writer, tag.liveBytes);
+        writeVarint(writer, tag.peakBytes);
+        for (j = 0; j < GBALLOC_SIZE_CLASS_COUNT; j++)
+        {
+            writeVarint(writer, tag.histogram[j]);
+        }
+    }
+}
+
+size_t gballoc_exportStats(GBALLOC_EXPORT_FORMAT format, unsigned char* buffer, size_t size)
+{
+    size_t result;
+    GBALLOC_HEAP_STATS heap;
+
+    if ((buffer == NULL) ||
+        ((format != GBALLOC_EXPORT_JSON) && (format != GBALLOC_EXPORT_BINARY)))
+    {
+        LogError("Invalid argument format=%d buffer=%p", (int)format, buffer);
+        result = 0;
     }
+    else if (gballoc_getHeapStats(&heap) != 0)
+    {
+        LogError("Failed getting the heap stats.");
+        result = 0;
+    }
+    else
+    {
+        GBALLOC_WRITER writer;
+        writer.buffer = buffer;
+        writer.size = size;
+        writer.length = 0;
+        writer.failed = 0;
+        if (format == GBALLOC_EXPORT_JSON)
+        {
+            exportJson(&writer, &heap);
+        }
+        else
+        {
+            exportBinary(&writer, &heap);
+        }
+
+        if (writer.failed)
+        {
+            LogError("The stats do not fit in %lu bytes.", (unsigned long)size);
+            result = 0;
+        }
+        else
+        {
+            /*the 0 terminating the JSON text is not counted*/
+            result = (format == GBALLOC_EXPORT_JSON) ? writer.length - 1 : writer.length;
+        }
+    }
+
+    return result;
 }
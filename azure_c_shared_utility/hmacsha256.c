@@ -2,9 +2,71 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 #include <stddef.h>
+#include <limits.h>
 #include "azure_c_shared_utility/hmacsha256.h"
-#include "azure_c_shared_utility/hmac.h"
 #include "azure_c_shared_utility/buffer_.h"
+#include "azure_c_shared_utility/sha.h"
+
+/* Absorbs the key XORed with the inner and outer pads into the two states */
+static HMACSHA256_RESULT prepare_pad_states(SHA256Context* inner, SHA256Context* outer, const unsigned char* key, size_t keyLen)
+{
+    HMACSHA256_RESULT result;
+
+    if (key == NULL ||
+        keyLen == 0)
+    {
+        result = HMACSHA256_INVALID_ARG;
+    }
+    else
+    {
+        unsigned char k_ipad[SHA256_Message_Block_Size];
+        unsigned char k_opad[SHA256_Message_Block_Size];
+        unsigned char tempkey[SHA256HashSize];
+        size_t i;
+
+        result = HMACSHA256_OK;
+
+        /* keys longer than a block are replaced by their hash, as in hmacReset */
+        if (keyLen > SHA256_Message_Block_Size)
+        {
+            if ((SHA256Reset(inner) != shaSuccess) ||
+                (SHA256Input(inner, key, (unsigned int)keyLen) != shaSuccess) ||
+                (SHA256Result(inner, tempkey) != shaSuccess))
+            {
+                result = HMACSHA256_ERROR;
+            }
+            else
+            {
+                key = tempkey;
+                keyLen = SHA256HashSize;
+            }
+        }
+
+        if (result == HMACSHA256_OK)
+        {
+            for (i = 0; i < keyLen; i++)
+            {
+                k_ipad[i] = key[i] ^ 0x36;
+                k_opad[i] = key[i] ^ 0x5c;
+            }
+            for (; i < SHA256_Message_Block_Size; i++)
+            {
+                k_ipad[i] = 0x36;
+                k_opad[i] = 0x5c;
+            }
+
+            if ((SHA256Reset(inner) != shaSuccess) ||
+                (SHA256Input(inner, k_ipad, SHA256_Message_Block_Size) != shaSuccess) ||
+                (SHA256Reset(outer) != shaSuccess) ||
+                (SHA256Input(outer, k_opad, SHA256_Message_Block_Size) != shaSuccess))
+            {
+                result = HMACSHA256_ERROR;
+            }
+        }
+    }
+
+    return result;
+}
 
 HMACSHA256_RESULT HMACSHA256_ComputeHash(const unsigned char* key, size_t keyLen, const unsigned char* payload, size_t payloadLen, BUFFER_HANDLE hash)
 {
@@ -20,8 +82,56 @@ HMACSHA256_RESULT HMACSHA256_ComputeHash(const unsigned char* key, size_t keyLen
     }
     else
     {
-        if ((BUFFER_enlarge(hash, 32) != 0) ||
-            (hmac(SHA256, payload, (int)payloadLen, key, (int)keyLen, BUFFER_u_char(hash) ) != 0))
+        HMACSHA256_CONTEXT context;
+        if ((BUFFER_enlarge(hash, SHA256HashSize) != 0) ||
+            (HMACSHA256_Init(&context, key, keyLen) != HMACSHA256_OK) ||
+            (HMACSHA256_Update(&context, payload, payloadLen) != HMACSHA256_OK) ||
+            (HMACSHA256_Final(&context, BUFFER_u_char(hash)) != HMACSHA256_OK))
+        {
+            result = HMACSHA256_ERROR;
+        }
+        else
+        {
+            result = HMACSHA256_OK;
+        }
+    }
+
+    return result;
+}
+
+HMACSHA256_RESULT HMACSHA256_PrepareKey(HMACSHA256_KEY* preparedKey, const unsigned char* key, size_t keyLen)
+{
+    HMACSHA256_RESULT result;
+
+    if (preparedKey == NULL)
+    {
+        result = HMACSHA256_INVALID_ARG;
+    }
+    else
+    {
+        result = prepare_pad_states(&preparedKey->inner, &preparedKey->outer, key, keyLen);
+    }
+
+    return result;
+}
+
+HMACSHA256_RESULT HMACSHA256_ComputeHashWithKey(const HMACSHA256_KEY* preparedKey, const unsigned char* payload, size_t payloadLen, unsigned char* hash)
+{
+    HMACSHA256_RESULT result;
+
+    if (preparedKey == NULL ||
+        payload == NULL ||
+        payloadLen == 0 ||
+        hash == NULL)
+    {
+        result = HMACSHA256_INVALID_ARG;
+    }
+    else
+    {
+        HMACSHA256_CONTEXT context;
+        if ((HMACSHA256_InitWithKey(&context, preparedKey) != HMACSHA256_OK) ||
+            (HMACSHA256_Update(&context, payload, payloadLen) != HMACSHA256_OK) ||
+            (HMACSHA256_Final(&context, hash) != HMACSHA256_OK))
         {
             result = HMACSHA256_ERROR;
         }
@@ -33,3 +143,88 @@ HMACSHA256_RESULT HMACSHA256_ComputeHash(const unsigned char* key, size_t keyLen
 
     return result;
 }
+
+HMACSHA256_RESULT HMACSHA256_Init(HMACSHA256_CONTEXT* context, const unsigned char* key, size_t keyLen)
+{
+    HMACSHA256_RESULT result;
+
+    if (context == NULL)
+    {
+        result = HMACSHA256_INVALID_ARG;
+    }
+    else
+    {
+        result = prepare_pad_states(&context->inner, &context->outer, key, keyLen);
+    }
+
+    return result;
+}
+
+HMACSHA256_RESULT HMACSHA256_InitWithKey(HMACSHA256_CONTEXT* context, const HMACSHA256_KEY* preparedKey)
+{
+    HMACSHA256_RESULT result;
+
+    if (context == NULL ||
+        preparedKey == NULL)
+    {
+        result = HMACSHA256_INVALID_ARG;
+    }
+    else
+    {
+        *context = *preparedKey;
+        result = HMACSHA256_OK;
+    }
+
+    return result;
+}
+
+HMACSHA256_RESULT HMACSHA256_Update(HMACSHA256_CONTEXT* context, const unsigned char* data, size_t dataLen)
+{
+    HMACSHA256_RESULT result;
+
+    if (context == NULL ||
+        (data == NULL && dataLen > 0))
+    {
+        result = HMACSHA256_INVALID_ARG;
+    }
+    else
+    {
+        result = HMACSHA256_OK;
+        /* SHA256Input takes an unsigned int length */
+        while (dataLen > 0 && result == HMACSHA256_OK)
+        {
+            unsigned int chunk = (dataLen > UINT_MAX) ? UINT_MAX : (unsigned int)dataLen;
+            if (SHA256Input(&context->inner, data, chunk) != shaSuccess)
+            {
+                result = HMACSHA256_ERROR;
+            }
+            data += chunk;
+            dataLen -= chunk;
+        }
+    }
+
+    return result;
+}
+
+HMACSHA256_RESULT HMACSHA256_Final(HMACSHA256_CONTEXT* context, unsigned char* hash)
+{
+    HMACSHA256_RESULT result;
+
+    if (context == NULL ||
+        hash == NULL)
+    {
+        result = HMACSHA256_INVALID_ARG;
+    }
+    else if ((SHA256Result(&context->inner, hash) != shaSuccess) ||
+        (SHA256Input(&context->outer, hash, SHA256HashSize) != shaSuccess) ||
+        (SHA256Result(&context->outer, hash) != shaSuccess))
+    {
+        result = HMACSHA256_ERROR;
+    }
+    else
+    {
+        result = HMACSHA256_OK;
+    }
+
+    return result;
+}
@@ -14,6 +14,9 @@
 #include "azure_c_shared_utility/platform.h"
 #include "azure_c_shared_utility/tlsio.h"
 #include "azure_c_shared_utility/threadapi.h"
+#include "azure_c_shared_utility/lock.h"
+#include "azure_c_shared_utility/condition.h"
+#include "azure_c_shared_utility/tickcounter.h"
 #include "azure_c_shared_utility/shared_util_options.h"
 
 #ifdef _MSC_VER
@@ -39,6 +42,27 @@
 /*Codes_SRS_HTTPAPI_COMPACT_21_083: [ The HTTPAPI_ExecuteRequest shall wait, at least, 100 milliseconds between retries. ]*/
 #define RETRY_INTERVAL_IN_MICROSECONDS  100
 
+/*a receive waits on receive_signal, posted by on_bytes_received, on_io_error and, when the xio supports
+OPTION_RECEIVE_SIGNAL, by the socket as soon as data arrives. It fails once no byte arrived for
+HTTP_RECEIVE_TIMEOUT_MS. Each wait is capped at RETRY_INTERVAL_IN_MICROSECONDS so an xio that never
+signals is still polled as before*/
+#if !defined(HTTP_RECEIVE_TIMEOUT_MS)
+#define HTTP_RECEIVE_TIMEOUT_MS     (MAX_RECEIVE_RETRY * RETRY_INTERVAL_IN_MICROSECONDS)
+#endif
+
+/*received bytes wait in a ring buffer of this size until the parser consumes them. The ring only grows if a
+single xio_dowork delivers more than it has room for*/
+#if !defined(HTTP_RECEIVE_BUFFER_SIZE)
+#define HTTP_RECEIVE_BUFFER_SIZE    2048
+#endif
+
+/*a request is assembled in a buffer kept by the connection and handed to the xio with a single send, and so
+are the requests of a pipelined batch. Bodies up to HTTP_SEND_COALESCE_LIMIT bytes are copied in after the
+headers, larger ones are sent on their own*/
+#if !defined(HTTP_SEND_COALESCE_LIMIT)
+#define HTTP_SEND_COALESCE_LIMIT    1024
+#endif
+
 DEFINE_ENUM_STRINGS(HTTPAPI_RESULT, HTTPAPI_RESULT_VALUES)
 
 typedef struct HTTP_HANDLE_DATA_TAG
@@ -47,8 +71,28 @@ typedef struct HTTP_HANDLE_DATA_TAG
     char*           x509ClientCertificate;
     char*           x509ClientPrivateKey;
     XIO_HANDLE      xio_handle;
+    unsigned char*  received_bytes;             /*ring buffer*/
+    size_t          received_bytes_capacity;
+    size_t          received_bytes_head;        /*offset of the oldest byte*/
     size_t          received_bytes_count;
-    unsigned char*  received_bytes;
+    unsigned char*  direct_bytes;               /*when set, received bytes go here before the ring, NULL discards them*/
+    size_t          direct_bytes_count;         /*bytes still expected by direct_bytes*/
+    ON_HTTPAPI_RESPONSE_BODY direct_body;       /*when set instead of direct_bytes, received bytes are handed to it*/
+    void*           direct_body_context;
+    unsigned int    is_body_aborted : 1;        /*direct_body returned non zero*/
+    LOCK_HANDLE     receive_lock;
+    COND_HANDLE     receive_signal;
+    TICK_COUNTER_HANDLE tick_counter;
+    tickcounter_ms_t receive_deadline;
+    unsigned int    is_receive_progress : 1;    /*bytes arrived since the last wait*/
+    unsigned int    is_response_started : 1;    /*bytes arrived since the requests were sent*/
+    unsigned int    is_close_requested : 1;     /*the host closes the connection after this response*/
+    unsigned int    is_request_sent : 1;        /*request bytes were handed to the xio since the requests were started*/
+    unsigned int    is_body_delimited : 1;      /*the response has a Content-Length or is chunked*/
+    unsigned int    response_status;            /*status of the response being read*/
+    unsigned char*  send_buffer;
+    size_t          send_buffer_size;
+    size_t          send_buffer_capacity;
     unsigned int    is_io_error : 1;
     unsigned int    is_connected : 1;
     unsigned int    send_completed : 1;
@@ -226,20 +270,61 @@ HTTP_HANDLE HTTPAPI_CreateConnection(const char* hostName)
             tlsio_config.underlying_io_parameters = NULL;
 
             http_instance->xio_handle = xio_create(platform_get_default_tlsio(), (void*)&tlsio_config);
+            http_instance->receive_lock = Lock_Init();
+            http_instance->receive_signal = Condition_Init();
+            http_instance->tick_counter = tickcounter_create();
 
             /*Codes_SRS_HTTPAPI_COMPACT_21_016: [ If the HTTPAPI_CreateConnection failed to create the connection, it shall return NULL as the handle. ]*/
-            if (http_instance->xio_handle == NULL)
+            if ((http_instance->xio_handle == NULL) ||
+                (http_instance->receive_lock == NULL) ||
+                (http_instance->receive_signal == NULL) ||
+                (http_instance->tick_counter == NULL))
             {
                 LogError("Create connection failed");
+                if (http_instance->xio_handle != NULL)
+                {
+                    xio_destroy(http_instance->xio_handle);
+                }
+                if (http_instance->receive_lock != NULL)
+                {
+                    (void)Lock_Deinit(http_instance->receive_lock);
+                }
+                Condition_Deinit(http_instance->receive_signal);
+                if (http_instance->tick_counter != NULL)
+                {
+                    tickcounter_destroy(http_instance->tick_counter);
+                }
                 free(http_instance);
                 http_instance = NULL;
             }
             else
             {
+                /* without it the receive waits fall back to polling */
+                if (xio_setoption(http_instance->xio_handle, OPTION_RECEIVE_SIGNAL, http_instance->receive_signal) != 0)
+                {
+                    LogInfo("The xio does not signal received data, the receive will poll");
+                }
+                http_instance->receive_deadline = 0;
+                http_instance->is_receive_progress = 0;
+                http_instance->is_response_started = 0;
+                http_instance->is_close_requested = 0;
+                http_instance->is_request_sent = 0;
+                http_instance->is_body_delimited = 0;
+                http_instance->response_status = 0;
+                http_instance->send_buffer = NULL;
+                http_instance->send_buffer_size = 0;
+                http_instance->send_buffer_capacity = 0;
                 http_instance->is_connected = 0;
                 http_instance->is_io_error = 0;
-                http_instance->received_bytes_count = 0;
                 http_instance->received_bytes = NULL;
+                http_instance->received_bytes_capacity = 0;
+                http_instance->received_bytes_head = 0;
+                http_instance->received_bytes_count = 0;
+                http_instance->direct_bytes = NULL;
+                http_instance->direct_bytes_count = 0;
+                http_instance->direct_body = NULL;
+                http_instance->direct_body_context = NULL;
+                http_instance->is_body_aborted = 0;
                 http_instance->certificate = NULL;
                 http_instance->x509ClientCertificate = NULL;
                 http_instance->x509ClientPrivateKey = NULL;
@@ -261,6 +346,45 @@ static void on_io_close_complete(void* context)
     }
 }
 
+/* closes the xio, the handle stays usable and the next request opens the connection again */
+static void CloseXIOConnection(HTTP_HANDLE_DATA* http_instance)
+{
+    http_instance->is_io_error = 0;
+    /*Codes_SRS_HTTPAPI_COMPACT_21_017: [ The HTTPAPI_CloseConnection shall close the connection previously created in HTTPAPI_ExecuteRequest. ]*/
+    if (xio_close(http_instance->xio_handle, on_io_close_complete, http_instance) != 0)
+    {
+        LogError("The SSL got error closing the connection");
+        /*Codes_SRS_HTTPAPI_COMPACT_21_087: [ If the xio return anything different than 0, the HTTPAPI_CloseConnection shall destroy the connection anyway. ]*/
+        http_instance->is_connected = 0;
+    }
+    else
+    {
+        /*Codes_SRS_HTTPAPI_COMPACT_21_084: [ The HTTPAPI_CloseConnection shall wait, at least, 10 seconds for the SSL close process. ]*/
+        int countRetry = MAX_CLOSE_RETRY;
+        while (http_instance->is_connected == 1)
+        {
+            xio_dowork(http_instance->xio_handle);
+            if ((countRetry--) < 0)
+            {
+                /*Codes_SRS_HTTPAPI_COMPACT_21_085: [ If the HTTPAPI_CloseConnection retries 10 seconds to close the connection without success, it shall destroy the connection anyway. ]*/
+                LogError("Close timeout. The SSL didn't close the connection");
+                http_instance->is_connected = 0;
+            }
+            else if (http_instance->is_io_error == 1)
+            {
+                LogError("The SSL got error closing the connection");
+                http_instance->is_connected = 0;
+            }
+            else if (http_instance->is_connected == 1)
+            {
+                LogInfo("Waiting for TLS close connection");
+                /*Codes_SRS_HTTPAPI_COMPACT_21_086: [ The HTTPAPI_CloseConnection shall wait, at least, 100 milliseconds between retries. ]*/
+                ThreadAPI_Sleep(RETRY_INTERVAL_IN_MICROSECONDS);
+            }
+        }
+    }
+}
+
 void HTTPAPI_CloseConnection(HTTP_HANDLE handle)
 {
     HTTP_HANDLE_DATA* http_instance = (HTTP_HANDLE_DATA*)handle;
@@ -271,44 +395,15 @@ void HTTPAPI_CloseConnection(HTTP_HANDLE handle)
         /*Codes_SRS_HTTPAPI_COMPACT_21_019: [ If there is no previous connection, the HTTPAPI_CloseConnection shall not do anything. ]*/
         if (http_instance->xio_handle != NULL)
         {
-            http_instance->is_io_error = 0;
-            /*Codes_SRS_HTTPAPI_COMPACT_21_017: [ The HTTPAPI_CloseConnection shall close the connection previously created in HTTPAPI_ExecuteRequest. ]*/
-            if (xio_close(http_instance->xio_handle, on_io_close_complete, http_instance) != 0)
-            {
-                LogError("The SSL got error closing the connection");
-                /*Codes_SRS_HTTPAPI_COMPACT_21_087: [ If the xio return anything different than 0, the HTTPAPI_CloseConnection shall destroy the connection anyway. ]*/
-                http_instance->is_connected = 0;
-            }
-            else
-            {
-                /*Codes_SRS_HTTPAPI_COMPACT_21_084: [ The HTTPAPI_CloseConnection shall wait, at least, 10 seconds for the SSL close process. ]*/
-                int countRetry = MAX_CLOSE_RETRY;
-                while (http_instance->is_connected == 1)
-                {
-                    xio_dowork(http_instance->xio_handle);
-                    if ((countRetry--) < 0)
-                    {
-                        /*Codes_SRS_HTTPAPI_COMPACT_21_085: [ If the HTTPAPI_CloseConnection retries 10 seconds to close the connection without success, it shall destroy the connection anyway. ]*/
-                        LogError("Close timeout. The SSL didn't close the connection");
-                        http_instance->is_connected = 0;
-                    }
-                    else if (http_instance->is_io_error == 1)
-                    {
-                        LogError("The SSL got error closing the connection");
-                        http_instance->is_connected = 0;
-                    }
-                    else if (http_instance->is_connected == 1)
-                    {
-                        LogInfo("Waiting for TLS close connection");
-                        /*Codes_SRS_HTTPAPI_COMPACT_21_086: [ The HTTPAPI_CloseConnection shall wait, at least, 100 milliseconds between retries. ]*/
-                        ThreadAPI_Sleep(RETRY_INTERVAL_IN_MICROSECONDS);
-                    }
-                }
-            }
+            CloseXIOConnection(http_instance);
             /*Codes_SRS_HTTPAPI_COMPACT_21_076: [ After close the connection, The HTTPAPI_CloseConnection shall destroy the connection previously created in HTTPAPI_CreateConnection. ]*/
             xio_destroy(http_instance->xio_handle);
         }
 
+        Condition_Deinit(http_instance->receive_signal);
+        (void)Lock_Deinit(http_instance->receive_lock);
+        tickcounter_destroy(http_instance->tick_counter);
+
         /*Codes_SRS_HTTPAPI_COMPACT_21_018: [ If there is a certificate associated to this connection, the HTTPAPI_CloseConnection shall free all allocated memory for the certificate. ]*/
         if (http_instance->certificate)
         {
@@ -326,6 +421,8 @@ void HTTPAPI_CloseConnection(HTTP_HANDLE handle)
         {
             free(http_instance->x509ClientPrivateKey);
         }
+        free(http_instance->received_bytes);
+        free(http_instance->send_buffer);
         free(http_instance);
     }
 }
@@ -394,9 +491,132 @@ static int InternStrnicmp(const char* s1, const char* s2, size_t n)
     return result;
 }
 
+/*makes room for size more bytes in the ring, growing (and unwrapping) it when it is full*/
+static int ring_reserve(HTTP_HANDLE_DATA* http_instance, size_t size)
+{
+    int result;
+    size_t needed = http_instance->received_bytes_count + size;
+    if (needed <= http_instance->received_bytes_capacity)
+    {
+        result = 0;
+    }
+    else
+    {
+        size_t newCapacity = (http_instance->received_bytes_capacity == 0) ? HTTP_RECEIVE_BUFFER_SIZE : http_instance->received_bytes_capacity;
+        unsigned char* newBytes;
+        while (newCapacity < needed)
+        {
+            newCapacity *= 2;
+        }
+        newBytes = (unsigned char*)malloc(newCapacity);
+        if (newBytes == NULL)
+        {
+            result = __FAILURE__;
+        }
+        else
+        {
+            size_t firstSpan = http_instance->received_bytes_capacity - http_instance->received_bytes_head;
+            if (firstSpan >= http_instance->received_bytes_count)
+            {
+                firstSpan = http_instance->received_bytes_count;
+            }
+            if (http_instance->received_bytes_count > 0)
+            {
+                (void)memcpy(newBytes, http_instance->received_bytes + http_instance->received_bytes_head, firstSpan);
+                (void)memcpy(newBytes + firstSpan, http_instance->received_bytes, http_instance->received_bytes_count - firstSpan);
+            }
+            free(http_instance->received_bytes);
+            http_instance->received_bytes = newBytes;
+            http_instance->received_bytes_capacity = newCapacity;
+            http_instance->received_bytes_head = 0;
+            result = 0;
+        }
+    }
+    return result;
+}
+
+static int ring_write(HTTP_HANDLE_DATA* http_instance, const unsigned char* buffer, size_t size)
+{
+    int result;
+    if (ring_reserve(http_instance, size) != 0)
+    {
+        result = __FAILURE__;
+    }
+    else
+    {
+        size_t tail = http_instance->received_bytes_head + http_instance->received_bytes_count;
+        size_t firstSpan;
+        if (tail >= http_instance->received_bytes_capacity)
+        {
+            tail -= http_instance->received_bytes_capacity;
+        }
+        firstSpan = http_instance->received_bytes_capacity - tail;
+        if (firstSpan > size)
+        {
+            firstSpan = size;
+        }
+        (void)memcpy(http_instance->received_bytes + tail, buffer, firstSpan);
+        (void)memcpy(http_instance->received_bytes, buffer + firstSpan, size - firstSpan);
+        http_instance->received_bytes_count += size;
+        result = 0;
+    }
+    return result;
+}
+
+/*returns the length of the contiguous span of received bytes starting at the oldest one, *span points to it*/
+static size_t ring_peek(HTTP_HANDLE_DATA* http_instance, const unsigned char** span)
+{
+    size_t result = http_instance->received_bytes_capacity - http_instance->received_bytes_head;
+    if (result > http_instance->received_bytes_count)
+    {
+        result = http_instance->received_bytes_count;
+    }
+    *span = http_instance->received_bytes + http_instance->received_bytes_head;
+    return result;
+}
+
+static void ring_consume(HTTP_HANDLE_DATA* http_instance, size_t size)
+{
+    http_instance->received_bytes_count -= size;
+    if (http_instance->received_bytes_count == 0)
+    {
+        /*empty, restart at the beginning so that the next span is as long as possible*/
+        http_instance->received_bytes_head = 0;
+    }
+    else
+    {
+        http_instance->received_bytes_head += size;
+        if (http_instance->received_bytes_head >= http_instance->received_bytes_capacity)
+        {
+            http_instance->received_bytes_head -= http_instance->received_bytes_capacity;
+        }
+    }
+}
+
+/*moves up to size bytes out of the ring into buffer (NULL drops them), returns how many*/
+static size_t ring_read(HTTP_HANDLE_DATA* http_instance, unsigned char* buffer, size_t size)
+{
+    size_t result = 0;
+    while ((result < size) && (http_instance->received_bytes_count > 0))
+    {
+        const unsigned char* span;
+        size_t spanSize = ring_peek(http_instance, &span);
+        if (spanSize > size - result)
+        {
+            spanSize = size - result;
+        }
+        if (buffer != NULL)
+        {
+            (void)memcpy(buffer + result, span, spanSize);
+        }
+        ring_consume(http_instance, spanSize);
+        result += spanSize;
+    }
+    return result;
+}
+
 static void on_bytes_received(void* context, const unsigned char* buffer, size_t size)
 {
-    unsigned char* new_received_bytes;
     HTTP_HANDLE_DATA* http_instance = (HTTP_HANDLE_DATA*)context;
 
     if (http_instance != NULL)
@@ -409,27 +629,40 @@ static void on_bytes_received(void* context, const unsigned char* buffer, size_t
         }
         else
         {
-            /* Here we got some bytes so we'll buffer them so the receive functions can consumer it */
-            new_received_bytes = (unsigned char*)realloc(http_instance->received_bytes, http_instance->received_bytes_count + size);
-            if (new_received_bytes == NULL)
+            if (http_instance->direct_bytes_count > 0)
             {
-                http_instance->is_io_error = 1;
-                LogError("Error allocating memory for received data");
-            }
-            else
-            {
-                http_instance->received_bytes = new_received_bytes;
-                if (memcpy(http_instance->received_bytes + http_instance->received_bytes_count, buffer, size) == NULL)
+                /* a reader is waiting for a known number of bytes, they go straight to its buffer */
+                size_t directSize = (size < http_instance->direct_bytes_count) ? size : http_instance->direct_bytes_count;
+                if (http_instance->direct_bytes != NULL)
                 {
-                    http_instance->is_io_error = 1;
-                    LogError("Error copping received data to the HTTP bufffer");
+                    (void)memcpy(http_instance->direct_bytes, buffer, directSize);
+                    http_instance->direct_bytes += directSize;
                 }
-                else
+                else if ((http_instance->direct_body != NULL) &&
+                    (http_instance->direct_body(http_instance->direct_body_context, buffer, directSize) != 0))
                 {
-                    http_instance->received_bytes_count += size;
+                    /* the rest of the response is dropped, the connection will be closed */
+                    LogError("The response body callback aborted the request");
+                    http_instance->direct_body = NULL;
+                    http_instance->is_body_aborted = 1;
+                    http_instance->is_io_error = 1;
                 }
+                http_instance->direct_bytes_count -= directSize;
+                buffer += directSize;
+                size -= directSize;
             }
+
+            /* Here we got some bytes so we'll buffer them so the receive functions can consumer it */
+            if ((size > 0) &&
+                (ring_write(http_instance, buffer, size) != 0))
+            {
+                http_instance->is_io_error = 1;
+                LogError("Error allocating memory for received data");
+            }
+            http_instance->is_receive_progress = 1;
+            http_instance->is_response_started = 1;
         }
+        (void)Condition_Post(http_instance->receive_signal);
     }
 }
 
@@ -440,9 +673,74 @@ static void on_io_error(void* context)
     {
         http_instance->is_io_error = 1;
         LogError("Error signalled by underlying IO");
+        (void)Condition_Post(http_instance->receive_signal);
     }
 }
 
+static void conn_wait_begin(HTTP_HANDLE_DATA* http_instance)
+{
+    tickcounter_ms_t now;
+    if (tickcounter_get_current_ms(http_instance->tick_counter, &now) != 0)
+    {
+        now = 0;
+    }
+    http_instance->receive_deadline = now + HTTP_RECEIVE_TIMEOUT_MS;
+    http_instance->is_receive_progress = 0;
+}
+
+/* blocks until receive_signal is posted or the retry interval elapses. Returns 0 if the receive may go on,
+non zero once HTTP_RECEIVE_TIMEOUT_MS passed without any byte arriving */
+static int conn_wait(HTTP_HANDLE_DATA* http_instance)
+{
+    int result;
+    tickcounter_ms_t now;
+
+    if (tickcounter_get_current_ms(http_instance->tick_counter, &now) != 0)
+    {
+        LogError("Unable to read the tick counter");
+        result = __FAILURE__;
+    }
+    else
+    {
+        if (http_instance->is_receive_progress != 0)
+        {
+            http_instance->receive_deadline = now + HTTP_RECEIVE_TIMEOUT_MS;
+            http_instance->is_receive_progress = 0;
+        }
+
+        if (now >= http_instance->receive_deadline)
+        {
+            /*Codes_SRS_HTTPAPI_COMPACT_21_082: [ If the HTTPAPI_ExecuteRequest retries 20 seconds to receive the message without success, it shall fail and return HTTPAPI_READ_DATA_FAILED. ]*/
+            LogError("Receive timeout. The HTTP request is incomplete");
+            result = __FAILURE__;
+        }
+        else if (Lock(http_instance->receive_lock) != LOCK_OK)
+        {
+            LogError("Unable to take the receive lock");
+            result = __FAILURE__;
+        }
+        else
+        {
+            tickcounter_ms_t remaining = http_instance->receive_deadline - now;
+            COND_RESULT wait_result = Condition_Wait(http_instance->receive_signal, http_instance->receive_lock,
+                (int)((remaining < RETRY_INTERVAL_IN_MICROSECONDS) ? remaining : RETRY_INTERVAL_IN_MICROSECONDS));
+            (void)Unlock(http_instance->receive_lock);
+
+            if ((wait_result == COND_OK) || (wait_result == COND_TIMEOUT))
+            {
+                result = 0;
+            }
+            else
+            {
+                LogError("Waiting for received data failed");
+                result = __FAILURE__;
+            }
+        }
+    }
+
+    return result;
+}
+
 static int conn_receive(HTTP_HANDLE_DATA* http_instance, char* buffer, int count)
 {
     int result;
@@ -454,8 +752,14 @@ static int conn_receive(HTTP_HANDLE_DATA* http_instance, char* buffer, int count
     }
     else
     {
-        result = 0;
-        while (result < count)
+        /* what is already buffered is consumed first, the rest is received straight into buffer */
+        size_t buffered = ring_read(http_instance, (unsigned char*)buffer, (size_t)count);
+        http_instance->direct_bytes = (unsigned char*)buffer + buffered;
+        http_instance->direct_bytes_count = (size_t)count - buffered;
+
+        result = count;
+        conn_wait_begin(http_instance);
+        while (http_instance->direct_bytes_count != 0)
         {
             xio_dowork(http_instance->xio_handle);
 
@@ -467,27 +771,16 @@ static int conn_receive(HTTP_HANDLE_DATA* http_instance, char* buffer, int count
                 break;
             }
 
-            if (http_instance->received_bytes_count >= (size_t)count)
+            if ((http_instance->direct_bytes_count != 0) &&
+                (conn_wait(http_instance) != 0))
             {
-                /* Consuming bytes from the receive buffer */
-                (void)memcpy(buffer, http_instance->received_bytes, count);
-                (void)memmove(http_instance->received_bytes, http_instance->received_bytes + count, http_instance->received_bytes_count - count);
-                http_instance->received_bytes_count -= count;
-
-                /* we're not reallocating at each consumption so that we don't trash due to byte by byte consumption */
-                if (http_instance->received_bytes_count == 0)
-                {
-                    free(http_instance->received_bytes);
-                    http_instance->received_bytes = NULL;
-                }
-
-                result = count;
+                result = -1;
                 break;
             }
-
-            /*Codes_SRS_HTTPAPI_COMPACT_21_083: [ The HTTPAPI_ExecuteRequest shall wait, at least, 100 milliseconds between retries. ]*/
-            ThreadAPI_Sleep(RETRY_INTERVAL_IN_MICROSECONDS);
         }
+
+        http_instance->direct_bytes = NULL;
+        http_instance->direct_bytes_count = 0;
     }
 
     return result;
@@ -497,12 +790,17 @@ static void conn_receive_discard_buffer(HTTP_HANDLE_DATA* http_instance)
 {
     if (http_instance != NULL)
     {
-        if (http_instance->received_bytes != NULL)
+        /* the ring is kept for the next request on this connection, unless it had to grow */
+        if (http_instance->received_bytes_capacity > HTTP_RECEIVE_BUFFER_SIZE)
         {
             free(http_instance->received_bytes);
             http_instance->received_bytes = NULL;
+            http_instance->received_bytes_capacity = 0;
         }
+        http_instance->received_bytes_head = 0;
         http_instance->received_bytes_count = 0;
+        http_instance->direct_bytes = NULL;
+        http_instance->direct_bytes_count = 0;
     }
 }
 
@@ -517,11 +815,12 @@ static int readLine(HTTP_HANDLE_DATA* http_instance, char* buf, const size_t max
     }
     else
     {
-        char* destByte = buf;
-        /*Codes_SRS_HTTPAPI_COMPACT_21_081: [ The HTTPAPI_ExecuteRequest shall try to read the message with the response up to 20 seconds. ]*/
-        int countRetry = MAX_RECEIVE_RETRY;
+        size_t lineSize = 0;
+        bool endOfLine = false; /* the '\r' was found, the '\n' after it is still to be skipped */
         bool endOfSearch = false;
         resultLineSize = -1;
+        /*Codes_SRS_HTTPAPI_COMPACT_21_081: [ The HTTPAPI_ExecuteRequest shall try to read the message with the response up to 20 seconds. ]*/
+        conn_wait_begin(http_instance);
         while (!endOfSearch)
         {
             xio_dowork(http_instance->xio_handle);
@@ -534,61 +833,55 @@ static int readLine(HTTP_HANDLE_DATA* http_instance, char* buf, const size_t max
             }
             else
             {
-                unsigned char* receivedByte = http_instance->received_bytes;
-                while (receivedByte < (http_instance->received_bytes + http_instance->received_bytes_count))
+                const unsigned char* span;
+                size_t spanSize;
+                while ((!endOfSearch) && ((spanSize = ring_peek(http_instance, &span)) > 0))
                 {
-                    if ((*receivedByte) != '\r')
+                    const unsigned char* lineEnd;
+                    size_t copySize;
+                    if (endOfLine)
                     {
-                        (*destByte) = (*receivedByte);
-                        destByte++;
-                        receivedByte++;
-
-                        if (destByte >= (buf + maxBufSize - 1))
+                        if ((*span) == '\n')
                         {
-                            LogError("Received message is bigger than the http buffer");
-                            receivedByte = http_instance->received_bytes + http_instance->received_bytes_count;
-                            endOfSearch = true;
-                            break;
+                            ring_consume(http_instance, 1);
                         }
+                        buf[lineSize] = '\0';
+                        resultLineSize = (int)lineSize;
+                        endOfSearch = true;
+                        break;
+                    }
+
+                    lineEnd = (const unsigned char*)memchr(span, '\r', spanSize);
+                    copySize = (lineEnd == NULL) ? spanSize : (size_t)(lineEnd - span);
+
+                    if (lineSize + copySize >= maxBufSize - 1)
+                    {
+                        LogError("Received message is bigger than the http buffer");
+                        conn_receive_discard_buffer(http_instance);
+                        endOfSearch = true;
                     }
                     else
                     {
-                        receivedByte++;
-                        if ((receivedByte < (http_instance->received_bytes + http_instance->received_bytes_count)) && ((*receivedByte) == '\n'))
+                        (void)memcpy(buf + lineSize, span, copySize);
+                        lineSize += copySize;
+                        if (lineEnd == NULL)
                         {
-                            receivedByte++;
+                            ring_consume(http_instance, copySize);
+                        }
+                        else
+                        {
+                            /* the '\n' is skipped on the next pass, even if it is still on its way */
+                            ring_consume(http_instance, copySize + 1);
+                            endOfLine = true;
                         }
-                        (*destByte) = '\0';
-                        resultLineSize = (int)(destByte - buf);
-                        endOfSearch = true;
-                        break;
                     }
                 }
-
-                http_instance->received_bytes_count -= (receivedByte - http_instance->received_bytes);
-                if (http_instance->received_bytes_count != 0)
-                {
-                    (void)memmove(http_instance->received_bytes, receivedByte, http_instance->received_bytes_count);
-                }
-                else
-                {
-                    conn_receive_discard_buffer(http_instance);
-                }
             }
 
-            if (!endOfSearch)
+            if ((!endOfSearch) &&
+                (conn_wait(http_instance) != 0))
             {
-                if ((countRetry--) > 0)
-                {
-                    /*Codes_SRS_HTTPAPI_COMPACT_21_083: [ The HTTPAPI_ExecuteRequest shall wait, at least, 100 milliseconds between retries. ]*/
-                    ThreadAPI_Sleep(RETRY_INTERVAL_IN_MICROSECONDS);
-                }
-                else
-                {
-                    /*Codes_SRS_HTTPAPI_COMPACT_21_082: [ If the HTTPAPI_ExecuteRequest retries 20 seconds to receive the message without success, it shall fail and return HTTPAPI_READ_DATA_FAILED. ]*/
-                    LogError("Receive timeout. The HTTP request is incomplete");
-                    endOfSearch = true;
-                }
+                endOfSearch = true;
             }
         }
     }
@@ -608,6 +901,12 @@ static int readChunk(HTTP_HANDLE_DATA* http_instance, char* buf, size_t size)
     {
         cur = conn_receive(http_instance, buf + offset, (int)size);
 
+        if (cur < 0)
+        {
+            offset = -1;
+            break;
+        }
+
         // end of stream reached
         if (cur == 0)
         {
@@ -622,9 +921,10 @@ static int readChunk(HTTP_HANDLE_DATA* http_instance, char* buf, size_t size)
     return offset;
 }
 
-static int skipN(HTTP_HANDLE_DATA* http_instance, size_t n)
+static int receiveN(HTTP_HANDLE_DATA* http_instance, size_t n, ON_HTTPAPI_RESPONSE_BODY onResponseBody, void* onResponseBodyContext)
 {
-    // read and abandon response content with specified length
+    // hand the next n bytes of the response content to onResponseBody, or
+    // abandon them if it is NULL. Nothing is buffered on the way.
     // returns -1 in case of error.
 
     int result;
@@ -636,10 +936,43 @@ static int skipN(HTTP_HANDLE_DATA* http_instance, size_t n)
     }
     else
     {
-        /*Codes_SRS_HTTPAPI_COMPACT_21_081: [ The HTTPAPI_ExecuteRequest shall try to read the message with the response up to 20 seconds. ]*/
-        int countRetry = MAX_RECEIVE_RETRY;
         result = (int)n;
-        while (n > 0)
+
+        /* the buffered bytes go first, straight out of the ring */
+        if (onResponseBody == NULL)
+        {
+            n -= ring_read(http_instance, NULL, n);
+        }
+        else
+        {
+            const unsigned char* span;
+            size_t spanSize;
+            while ((n > 0) && ((spanSize = ring_peek(http_instance, &span)) > 0))
+            {
+                if (spanSize > n)
+                {
+                    spanSize = n;
+                }
+                if (onResponseBody(onResponseBodyContext, span, spanSize) != 0)
+                {
+                    LogError("The response body callback aborted the request");
+                    http_instance->is_body_aborted = 1;
+                    result = -1;
+                    break;
+                }
+                ring_consume(http_instance, spanSize);
+                n -= spanSize;
+            }
+        }
+
+        /* the rest is handed over (or dropped) as it arrives, without going through the ring */
+        http_instance->direct_bytes = NULL;
+        http_instance->direct_body = onResponseBody;
+        http_instance->direct_body_context = onResponseBodyContext;
+        http_instance->direct_bytes_count = (result < 0) ? 0 : n;
+        /*Codes_SRS_HTTPAPI_COMPACT_21_081: [ The HTTPAPI_ExecuteRequest shall try to read the message with the response up to 20 seconds. ]*/
+        conn_wait_begin(http_instance);
+        while (http_instance->direct_bytes_count > 0)
         {
             xio_dowork(http_instance->xio_handle);
 
@@ -648,39 +981,18 @@ static int skipN(HTTP_HANDLE_DATA* http_instance, size_t n)
             {
                 LogError("xio reported error on dowork");
                 result = -1;
-                n = 0;
+                break;
             }
-            else
+            else if ((http_instance->direct_bytes_count > 0) &&
+                (conn_wait(http_instance) != 0))
             {
-                if (http_instance->received_bytes_count <= n)
-                {
-                    n -= http_instance->received_bytes_count;
-                    http_instance->received_bytes_count = 0;
-                }
-                else
-                {
-                    http_instance->received_bytes_count -= n;
-                    (void)memmove(http_instance->received_bytes, http_instance->received_bytes + n, http_instance->received_bytes_count);
-                    n = 0;
-                }
-
-                if (n > 0)
-                {
-                    if ((countRetry--) > 0)
-                    {
-                        /*Codes_SRS_HTTPAPI_COMPACT_21_083: [ The HTTPAPI_ExecuteRequest shall wait, at least, 100 milliseconds between retries. ]*/
-                        ThreadAPI_Sleep(RETRY_INTERVAL_IN_MICROSECONDS);
-                    }
-                    else
-                    {
-                        /*Codes_SRS_HTTPAPI_COMPACT_21_082: [ If the HTTPAPI_ExecuteRequest retries 20 seconds to receive the message without success, it shall fail and return HTTPAPI_READ_DATA_FAILED. ]*/
-                        LogError("Receive timeout. The HTTP request is incomplete");
-                        n = 0;
-                        result = -1;
-                    }
-                }
+                result = -1;
+                break;
             }
         }
+        http_instance->direct_bytes_count = 0;
+        http_instance->direct_body = NULL;
+        http_instance->direct_body_context = NULL;
     }
 
     return result;
@@ -777,6 +1089,7 @@ static HTTPAPI_RESULT conn_send_all(HTTP_HANDLE_DATA* http_instance, const unsig
 
     http_instance->send_completed = 0;
     http_instance->is_io_error = 0;
+    http_instance->is_request_sent = 1;
     if (xio_send(http_instance->xio_handle, buf, bufLen, on_send_complete, http_instance) != 0)
     {
         /*Codes_SRS_HTTPAPI_COMPACT_21_028: [ If the HTTPAPI_ExecuteRequest cannot send the request header, it shall return HTTPAPI_HTTP_HEADERS_FAILED. ]*/
@@ -821,6 +1134,63 @@ const char* get_request_type(HTTPAPI_REQUEST_TYPE requestType)
     return (const char*)httpapiRequestString[requestType];
 }
 
+static int send_buffer_append(HTTP_HANDLE_DATA* http_instance, const void* data, size_t size)
+{
+    int result;
+
+    if (http_instance->send_buffer_size + size > http_instance->send_buffer_capacity)
+    {
+        size_t newCapacity = (http_instance->send_buffer_capacity == 0) ? TEMP_BUFFER_SIZE : http_instance->send_buffer_capacity;
+        unsigned char* newBuffer;
+        while (newCapacity < http_instance->send_buffer_size + size)
+        {
+            newCapacity *= 2;
+        }
+        newBuffer = (unsigned char*)realloc(http_instance->send_buffer, newCapacity);
+        if (newBuffer == NULL)
+        {
+            LogError("Unable to grow the send buffer to %lu bytes", (unsigned long)newCapacity);
+            result = __FAILURE__;
+        }
+        else
+        {
+            http_instance->send_buffer = newBuffer;
+            http_instance->send_buffer_capacity = newCapacity;
+            result = 0;
+        }
+    }
+    else
+    {
+        result = 0;
+    }
+
+    if (result == 0)
+    {
+        (void)memcpy(http_instance->send_buffer + http_instance->send_buffer_size, data, size);
+        http_instance->send_buffer_size += size;
+    }
+
+    return result;
+}
+
+/* sends what was assembled in the send buffer */
+static HTTPAPI_RESULT FlushSendBuffer(HTTP_HANDLE_DATA* http_instance)
+{
+    HTTPAPI_RESULT result;
+
+    if (http_instance->send_buffer_size == 0)
+    {
+        result = HTTPAPI_OK;
+    }
+    else
+    {
+        result = conn_send_all(http_instance, http_instance->send_buffer, http_instance->send_buffer_size);
+        http_instance->send_buffer_size = 0;
+    }
+
+    return result;
+}
+
 /*Codes_SRS_HTTPAPI_COMPACT_21_026: [ If the open process succeed, the HTTPAPI_ExecuteRequest shall send the request message to the host. ]*/
 static HTTPAPI_RESULT SendHeadsToXIO(HTTP_HANDLE_DATA* http_instance, HTTPAPI_REQUEST_TYPE requestType, const char* relativePath, HTTP_HEADERS_HANDLE httpHeadersHandle, size_t headersCount)
 {
@@ -837,12 +1207,16 @@ static HTTPAPI_RESULT SendHeadsToXIO(HTTP_HANDLE_DATA* http_instance, HTTPAPI_RE
         /*Codes_SRS_HTTPAPI_COMPACT_21_027: [ If the HTTPAPI_ExecuteRequest cannot create a buffer to send the request, it shall not send any request and return HTTPAPI_STRING_PROCESSING_ERROR. ]*/
         result = HTTPAPI_STRING_PROCESSING_ERROR;
     }
-        /*Codes_SRS_HTTPAPI_COMPACT_21_028: [ If the HTTPAPI_ExecuteRequest cannot send the request header, it shall return HTTPAPI_HTTP_HEADERS_FAILED. ]*/
-    else if ((result = conn_send_all(http_instance, (const unsigned char*)buf, strlen(buf))) == HTTPAPI_OK)
+    else if (send_buffer_append(http_instance, buf, (size_t)ret) != 0)
     {
-		size_t i;
+        result = HTTPAPI_ALLOC_FAILED;
+    }
+    else
+    {
+        size_t i;
         //Send default headers
         /*Codes_SRS_HTTPAPI_COMPACT_21_033: [ If the whole process succeed, the HTTPAPI_ExecuteRequest shall retur HTTPAPI_OK. ]*/
+        result = HTTPAPI_OK;
         for (i = 0; ((i < headersCount) && (result == HTTPAPI_OK)); i++)
         {
             char* header;
@@ -853,18 +1227,20 @@ static HTTPAPI_RESULT SendHeadsToXIO(HTTP_HANDLE_DATA* http_instance, HTTPAPI_RE
             }
             else
             {
-                if ((result = conn_send_all(http_instance, (const unsigned char*)header, strlen(header))) == HTTPAPI_OK)
+                if ((send_buffer_append(http_instance, header, strlen(header)) != 0) ||
+                    (send_buffer_append(http_instance, "\r\n", (size_t)2) != 0))
                 {
-                    result = conn_send_all(http_instance, (const unsigned char*)"\r\n", (size_t)2);
+                    result = HTTPAPI_ALLOC_FAILED;
                 }
                 free(header);
             }
         }
 
         //Close headers
-        if (result == HTTPAPI_OK)
+        if ((result == HTTPAPI_OK) &&
+            (send_buffer_append(http_instance, "\r\n", (size_t)2) != 0))
         {
-            result = conn_send_all(http_instance, (const unsigned char*)"\r\n", (size_t)2);
+            result = HTTPAPI_ALLOC_FAILED;
         }
     }
     return result;
@@ -880,7 +1256,14 @@ static HTTPAPI_RESULT SendContentToXIO(HTTP_HANDLE_DATA* http_instance, const un
     if (content && contentLength > 0)
     {
         /*Codes_SRS_HTTPAPI_COMPACT_21_044: [ If the content is not NULL, the number of bytes in the content shall be provided in contentLength parameter. ]*/
-        result = conn_send_all(http_instance, content, contentLength);
+        if (contentLength <= HTTP_SEND_COALESCE_LIMIT)
+        {
+            result = (send_buffer_append(http_instance, content, contentLength) != 0) ? HTTPAPI_ALLOC_FAILED : HTTPAPI_OK;
+        }
+        else if ((result = FlushSendBuffer(http_instance)) == HTTPAPI_OK)
+        {
+            result = conn_send_all(http_instance, content, contentLength);
+        }
     }
     else
     {
@@ -917,6 +1300,12 @@ static HTTPAPI_RESULT ReceiveHeaderFromXIO(HTTP_HANDLE_DATA* http_instance, unsi
     }
     else
     {
+        /* an HTTP/1.0 host closes the connection after the response */
+        if (strncmp(buf, "HTTP/1.0", 8) == 0)
+        {
+            http_instance->is_close_requested = 1;
+        }
+        http_instance->response_status = (unsigned int)ret;
         /*Codes_SRS_HTTPAPI_COMPACT_21_046: [ The HTTPAPI_ExecuteRequest shall return the http status reported by the host in the received response. ]*/
         /*Codes_SRS_HTTPAPI_COMPACT_21_048: [ If the statusCode is NULL, the HTTPAPI_ExecuteRequest shall report not report any status. ]*/
         if (statusCode)
@@ -944,8 +1333,13 @@ static HTTPAPI_RESULT ReceiveContentInfoFromXIO(HTTP_HANDLE_DATA* http_instance,
     const size_t TransferEncodingSize = sizeof(TransferEncoding) - 1;
     const char Chunked[] = "chunked";
     const size_t ChunkedSize = sizeof(Chunked) - 1;
+    const char Connection[] = "connection:";
+    const size_t ConnectionSize = sizeof(Connection) - 1;
+    const char Close[] = "close";
+    const size_t CloseSize = sizeof(Close) - 1;
 
     http_instance->is_io_error = 0;
+    http_instance->is_body_delimited = 0;
 
     //Read HTTP response headers
     if (readLine(http_instance, buf, sizeof(buf)) < 0)
@@ -972,6 +1366,7 @@ static HTTPAPI_RESULT ReceiveContentInfoFromXIO(HTTP_HANDLE_DATA* http_instance,
                 else
                 {
                     (*bodyLength) = (size_t)lengthInMsg;
+                    http_instance->is_body_delimited = 1;
                 }
             }
             else if (InternStrnicmp(buf, TransferEncoding, TransferEncodingSize) == 0)
@@ -983,6 +1378,18 @@ static HTTPAPI_RESULT ReceiveContentInfoFromXIO(HTTP_HANDLE_DATA* http_instance,
                 if (InternStrnicmp(substr, Chunked, ChunkedSize) == 0)
                 {
                     (*chunked) = true;
+                    http_instance->is_body_delimited = 1;
+                }
+            }
+            else if (InternStrnicmp(buf, Connection, ConnectionSize) == 0)
+            {
+                substr = buf + ConnectionSize;
+
+                while (isspace(*substr)) substr++;
+
+                if (InternStrnicmp(substr, Close, CloseSize) == 0)
+                {
+                    http_instance->is_close_requested = 1;
                 }
             }
 
@@ -1009,13 +1416,14 @@ static HTTPAPI_RESULT ReceiveContentInfoFromXIO(HTTP_HANDLE_DATA* http_instance,
     return result;
 }
 
-static HTTPAPI_RESULT ReadHTTPResponseBodyFromXIO(HTTP_HANDLE_DATA* http_instance, size_t bodyLength, bool chunked, BUFFER_HANDLE responseContent)
+static HTTPAPI_RESULT ReadHTTPResponseBodyFromXIO(HTTP_HANDLE_DATA* http_instance, size_t bodyLength, bool chunked, BUFFER_HANDLE responseContent, ON_HTTPAPI_RESPONSE_BODY onResponseBody, void* onResponseBodyContext)
 {
     HTTPAPI_RESULT result;
     char    buf[TEMP_BUFFER_SIZE];
     const unsigned char* receivedContent;
 
     http_instance->is_io_error = 0;
+    http_instance->is_body_aborted = 0;
 
     //Read HTTP response body
     if (!chunked)
@@ -1050,10 +1458,10 @@ static HTTPAPI_RESULT ReadHTTPResponseBodyFromXIO(HTTP_HANDLE_DATA* http_instanc
             else
             {
                 /*Codes_SRS_HTTPAPI_COMPACT_21_051: [ If the responseContent is NULL, the HTTPAPI_ExecuteRequest shall ignore any content in the response. ]*/
-                if (skipN(http_instance, bodyLength) < 0)
+                if (receiveN(http_instance, bodyLength, onResponseBody, onResponseBodyContext) < 0)
                 {
                     /*Codes_SRS_HTTPAPI_COMPACT_21_082: [ If the HTTPAPI_ExecuteRequest retries 20 seconds to receive the message without success, it shall fail and return HTTPAPI_READ_DATA_FAILED. ]*/
-                    result = HTTPAPI_READ_DATA_FAILED;
+                    result = (http_instance->is_body_aborted != 0) ? HTTPAPI_ERROR : HTTPAPI_READ_DATA_FAILED;
                 }
                 else
                 {
@@ -1061,6 +1469,26 @@ static HTTPAPI_RESULT ReadHTTPResponseBodyFromXIO(HTTP_HANDLE_DATA* http_instanc
                 }
             }
         }
+        else if ((http_instance->is_body_delimited == 0) &&
+            (http_instance->response_status >= 200) &&
+            (http_instance->response_status != 204) &&
+            (http_instance->response_status != 304))
+        {
+            /* without Content-Length the body runs until the host closes the connection, which the xio does not
+            tell apart from an error. The connection is not used again, its next bytes are not a response */
+            http_instance->is_close_requested = 1;
+            if ((responseContent == NULL) &&
+                (onResponseBody == NULL))
+            {
+                /*Codes_SRS_HTTPAPI_COMPACT_21_051: [ If the responseContent is NULL, the HTTPAPI_ExecuteRequest shall ignore any content in the response. ]*/
+                result = HTTPAPI_OK;
+            }
+            else
+            {
+                LogError("The response has neither Content-Length nor chunked Transfer-Encoding, its body cannot be read");
+                result = HTTPAPI_RECEIVE_RESPONSE_FAILED;
+            }
+        }
         else
         {
             /*Codes_SRS_HTTPAPI_COMPACT_21_033: [ If the whole process succeed, the HTTPAPI_ExecuteRequest shall retur HTTPAPI_OK. ]*/
@@ -1125,10 +1553,10 @@ static HTTPAPI_RESULT ReadHTTPResponseBodyFromXIO(HTTP_HANDLE_DATA* http_instanc
                 else
                 {
                     /*Codes_SRS_HTTPAPI_COMPACT_21_051: [ If the responseContent is NULL, the HTTPAPI_ExecuteRequest shall ignore any content in the response. ]*/
-                    if (skipN(http_instance, chunkSize) < 0)
+                    if (receiveN(http_instance, chunkSize, onResponseBody, onResponseBodyContext) < 0)
                     {
                         /*Codes_SRS_HTTPAPI_COMPACT_21_082: [ If the HTTPAPI_ExecuteRequest retries 20 seconds to receive the message without success, it shall fail and return HTTPAPI_READ_DATA_FAILED. ]*/
-                        result = HTTPAPI_READ_DATA_FAILED;
+                        result = (http_instance->is_body_aborted != 0) ? HTTPAPI_ERROR : HTTPAPI_READ_DATA_FAILED;
                     }
                 }
 
@@ -1174,16 +1602,159 @@ static bool validRequestType(HTTPAPI_REQUEST_TYPE requestType)
 /*Codes_SRS_HTTPAPI_COMPACT_21_050: [ If there is a content in the response, the HTTPAPI_ExecuteRequest shall copy it in the responseContent buffer. ]*/
 //Note: This function assumes that "Host:" and "Content-Length:" headers are setup
 //      by the caller of HTTPAPI_ExecuteRequest() (which is true for httptransport.c).
-HTTPAPI_RESULT HTTPAPI_ExecuteRequest(HTTP_HANDLE handle, HTTPAPI_REQUEST_TYPE requestType, const char* relativePath,
-    HTTP_HEADERS_HANDLE httpHeadersHandle, const unsigned char* content,
-    size_t contentLength, unsigned int* statusCode,
-    HTTP_HEADERS_HANDLE responseHeadersHandle, BUFFER_HANDLE responseContent)
+static bool validRequest(const HTTPAPI_REQUEST* request, size_t* headersCount)
+{
+    return ((request->relativePath != NULL) &&
+        (request->httpHeadersHandle != NULL) &&
+        validRequestType(request->requestType) &&
+        (HTTPHeaders_GetHeaderCount(request->httpHeadersHandle, headersCount) == HTTP_HEADERS_OK));
+}
+
+/* sends all the requests, in as few xio_send calls as the content sizes allow, then reads the responses in order */
+static HTTPAPI_RESULT ExecuteRequestsOnXIO(HTTP_HANDLE_DATA* http_instance, const HTTPAPI_REQUEST* requests, size_t requestCount, size_t* completedCount)
 {
-    HTTPAPI_RESULT result = HTTPAPI_ERROR;
+    HTTPAPI_RESULT result;
+    size_t i;
+
+    *completedCount = 0;
+    http_instance->is_close_requested = 0;
+    http_instance->is_request_sent = 0;
+    http_instance->send_buffer_size = 0;
+
+    /*Codes_SRS_HTTPAPI_COMPACT_21_024: [ The HTTPAPI_ExecuteRequest shall open the transport connection with the host to send the request. ]*/
+    if ((result = OpenXIOConnection(http_instance)) != HTTPAPI_OK)
+    {
+        LogError("Open HTTP connection failed (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
+    }
+    else
+    {
+        http_instance->is_response_started = 0;
+        for (i = 0; (i < requestCount) && (result == HTTPAPI_OK); i++)
+        {
+            size_t headersCount;
+            (void)HTTPHeaders_GetHeaderCount(requests[i].httpHeadersHandle, &headersCount);
+            /*Codes_SRS_HTTPAPI_COMPACT_21_026: [ If the open process succeed, the HTTPAPI_ExecuteRequest shall send the request message to the host. ]*/
+            if ((result = SendHeadsToXIO(http_instance, requests[i].requestType, requests[i].relativePath, requests[i].httpHeadersHandle, headersCount)) != HTTPAPI_OK)
+            {
+                LogError("Send heads to HTTP failed (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
+            }
+            /*Codes_SRS_HTTPAPI_COMPACT_21_042: [ The request can contain the a content message, provided in content parameter. ]*/
+            else if ((result = SendContentToXIO(http_instance, requests[i].content, requests[i].contentLength)) != HTTPAPI_OK)
+            {
+                LogError("Send content to HTTP failed (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
+            }
+        }
+
+        if ((result == HTTPAPI_OK) &&
+            ((result = FlushSendBuffer(http_instance)) != HTTPAPI_OK))
+        {
+            LogError("Send request to HTTP failed (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
+        }
+
+        for (i = 0; (i < requestCount) && (result == HTTPAPI_OK); i++)
+        {
+            size_t  bodyLength = 0;
+            bool    chunked = false;
+
+            if (http_instance->is_close_requested != 0)
+            {
+                /* the host closed the connection without answering the rest */
+                LogError("The host closed the connection after %lu of %lu responses", (unsigned long)i, (unsigned long)requestCount);
+                result = HTTPAPI_RECEIVE_RESPONSE_FAILED;
+            }
+            /*Codes_SRS_HTTPAPI_COMPACT_21_030: [ At the end of the transmission, the HTTPAPI_ExecuteRequest shall receive the response from the host. ]*/
+            /*Codes_SRS_HTTPAPI_COMPACT_21_073: [ The message received by the HTTPAPI_ExecuteRequest shall starts with a valid header. ]*/
+            else if ((result = ReceiveHeaderFromXIO(http_instance, requests[i].statusCode)) != HTTPAPI_OK)
+            {
+                LogError("Receive header from HTTP failed (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
+            }
+            /*Codes_SRS_HTTPAPI_COMPACT_21_074: [ After the header, the message received by the HTTPAPI_ExecuteRequest can contain addition information about the content. ]*/
+            else if ((result = ReceiveContentInfoFromXIO(http_instance, requests[i].responseHeadersHandle, &bodyLength, &chunked)) != HTTPAPI_OK)
+            {
+                LogError("Receive content information from HTTP failed (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
+            }
+            /*Codes_SRS_HTTPAPI_COMPACT_21_075: [ The message received by the HTTPAPI_ExecuteRequest can contain a body with the message content. ]*/
+            /* with a body callback nothing is collected in responseContent */
+            else if ((result = ReadHTTPResponseBodyFromXIO(http_instance, bodyLength, chunked,
+                (requests[i].onResponseBody != NULL) ? NULL : requests[i].responseContent,
+                requests[i].onResponseBody, requests[i].onResponseBodyContext)) != HTTPAPI_OK)
+            {
+                LogError("Read HTTP response body from HTTP failed (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
+            }
+            else
+            {
+                (*completedCount)++;
+            }
+        }
+
+        /* the connection is kept for the next request only if it is in a known state */
+        if ((result != HTTPAPI_OK) || (http_instance->is_close_requested != 0))
+        {
+            CloseXIOConnection(http_instance);
+        }
+    }
+
+    conn_receive_discard_buffer(http_instance);
+
+    return result;
+}
+
+/* GET, PUT and DELETE can be sent twice without changing the outcome, POST and PATCH cannot */
+static bool idempotentRequests(const HTTPAPI_REQUEST* requests, size_t requestCount)
+{
+    bool result = true;
+    size_t i;
+
+    for (i = 0; (i < requestCount) && result; i++)
+    {
+        result = ((requests[i].requestType == HTTPAPI_REQUEST_GET) ||
+            (requests[i].requestType == HTTPAPI_REQUEST_PUT) ||
+            (requests[i].requestType == HTTPAPI_REQUEST_DELETE));
+    }
+
+    return result;
+}
+
+/* a connection kept from a previous request may have been closed by the host in the meantime. If it fails
+before any byte of the response arrived, the requests are sent again once on a new connection, provided
+none of their bytes reached the xio or all of them are idempotent: the host may have processed them */
+static HTTPAPI_RESULT ExecuteRequests(HTTP_HANDLE_DATA* http_instance, const HTTPAPI_REQUEST* requests, size_t requestCount, size_t* completedCount)
+{
+    HTTPAPI_RESULT result;
+    size_t completed;
+
+    *completedCount = 0;
+    do
+    {
+        bool isReused = (http_instance->is_connected != 0);
+
+        result = ExecuteRequestsOnXIO(http_instance, requests + *completedCount, requestCount - *completedCount, &completed);
+        if ((result != HTTPAPI_OK) &&
+            isReused &&
+            (completed == 0) &&
+            (http_instance->is_response_started == 0) &&
+            ((http_instance->is_request_sent == 0) || idempotentRequests(requests + *completedCount, requestCount - *completedCount)))
+        {
+            LogInfo("The kept alive connection is gone, sending the request again on a new connection");
+            result = ExecuteRequestsOnXIO(http_instance, requests + *completedCount, requestCount - *completedCount, &completed);
+        }
+        *completedCount += completed;
+
+        /* a host that closes the connection part way through a batch answered the first ones, the rest go on a new
+        connection if sending them again is harmless */
+    } while ((result != HTTPAPI_OK) &&
+        (completed > 0) &&
+        (http_instance->is_close_requested != 0) &&
+        (*completedCount < requestCount) &&
+        idempotentRequests(requests + *completedCount, requestCount - *completedCount));
+
+    return result;
+}
+
+static HTTPAPI_RESULT ExecuteRequest(HTTP_HANDLE_DATA* http_instance, const HTTPAPI_REQUEST* request)
+{
+    HTTPAPI_RESULT result;
     size_t  headersCount;
-    size_t  bodyLength = 0;
-    bool    chunked = false;
-    HTTP_HANDLE_DATA* http_instance = (HTTP_HANDLE_DATA*)handle;
 
     /*Codes_SRS_HTTPAPI_COMPACT_21_034: [ If there is no previous connection, the HTTPAPI_ExecuteRequest shall return HTTPAPI_INVALID_ARG. ]*/
     /*Codes_SRS_HTTPAPI_COMPACT_21_037: [ If the request type is unknown, the HTTPAPI_ExecuteRequest shall return HTTPAPI_INVALID_ARG. ]*/
@@ -1193,48 +1764,110 @@ HTTPAPI_RESULT HTTPAPI_ExecuteRequest(HTTP_HANDLE handle, HTTPAPI_REQUEST_TYPE r
     /*Codes_SRS_HTTPAPI_COMPACT_21_040: [ The request shall contain the http header provided in httpHeadersHandle parameter. ]*/
     /*Codes_SRS_HTTPAPI_COMPACT_21_054: [ If Http header maker cannot provide the number of headers, the HTTPAPI_ExecuteRequest shall return HTTPAPI_INVALID_ARG. ]*/
     if (http_instance == NULL ||
-        relativePath == NULL ||
-        httpHeadersHandle == NULL ||
-        !validRequestType(requestType) ||
-        HTTPHeaders_GetHeaderCount(httpHeadersHandle, &headersCount) != HTTP_HEADERS_OK)
+        !validRequest(request, &headersCount))
     {
         result = HTTPAPI_INVALID_ARG;
         LogError("(result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
     }
-    /*Codes_SRS_HTTPAPI_COMPACT_21_024: [ The HTTPAPI_ExecuteRequest shall open the transport connection with the host to send the request. ]*/
-    else if ((result = OpenXIOConnection(http_instance)) != HTTPAPI_OK)
-    {
-        LogError("Open HTTP connection failed (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
-    }
-    /*Codes_SRS_HTTPAPI_COMPACT_21_026: [ If the open process succeed, the HTTPAPI_ExecuteRequest shall send the request message to the host. ]*/
-    else if ((result = SendHeadsToXIO(http_instance, requestType, relativePath, httpHeadersHandle, headersCount)) != HTTPAPI_OK)
+    else
     {
-        LogError("Send heads to HTTP failed (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
+        size_t completedCount;
+        result = ExecuteRequests(http_instance, request, 1, &completedCount);
     }
-    /*Codes_SRS_HTTPAPI_COMPACT_21_042: [ The request can contain the a content message, provided in content parameter. ]*/
-    else if ((result = SendContentToXIO(http_instance, content, contentLength)) != HTTPAPI_OK)
+
+    return result;
+}
+
+HTTPAPI_RESULT HTTPAPI_ExecuteRequest(HTTP_HANDLE handle, HTTPAPI_REQUEST_TYPE requestType, const char* relativePath,
+    HTTP_HEADERS_HANDLE httpHeadersHandle, const unsigned char* content,
+    size_t contentLength, unsigned int* statusCode,
+    HTTP_HEADERS_HANDLE responseHeadersHandle, BUFFER_HANDLE responseContent)
+{
+    HTTPAPI_REQUEST request;
+
+    request.requestType = requestType;
+    request.relativePath = relativePath;
+    request.httpHeadersHandle = httpHeadersHandle;
+    request.content = content;
+    request.contentLength = contentLength;
+    request.statusCode = statusCode;
+    request.responseHeadersHandle = responseHeadersHandle;
+    request.responseContent = responseContent;
+    request.onResponseBody = NULL;
+    request.onResponseBodyContext = NULL;
+
+    return ExecuteRequest((HTTP_HANDLE_DATA*)handle, &request);
+}
+
+HTTPAPI_RESULT HTTPAPI_ExecuteRequestToCallback(HTTP_HANDLE handle, HTTPAPI_REQUEST_TYPE requestType, const char* relativePath,
+    HTTP_HEADERS_HANDLE httpHeadersHandle, const unsigned char* content,
+    size_t contentLength, unsigned int* statusCode,
+    HTTP_HEADERS_HANDLE responseHeadersHandle, ON_HTTPAPI_RESPONSE_BODY onResponseBody, void* onResponseBodyContext)
+{
+    HTTPAPI_RESULT result;
+
+    if (onResponseBody == NULL)
     {
-        LogError("Send content to HTTP failed (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
+        result = HTTPAPI_INVALID_ARG;
+        LogError("NULL response body callback (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
     }
-    /*Codes_SRS_HTTPAPI_COMPACT_21_030: [ At the end of the transmission, the HTTPAPI_ExecuteRequest shall receive the response from the host. ]*/
-    /*Codes_SRS_HTTPAPI_COMPACT_21_073: [ The message received by the HTTPAPI_ExecuteRequest shall starts with a valid header. ]*/
-    else if ((result = ReceiveHeaderFromXIO(http_instance, statusCode)) != HTTPAPI_OK)
+    else
     {
-        LogError("Receive header from HTTP failed (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
+        HTTPAPI_REQUEST request;
+
+        request.requestType = requestType;
+        request.relativePath = relativePath;
+        request.httpHeadersHandle = httpHeadersHandle;
+        request.content = content;
+        request.contentLength = contentLength;
+        request.statusCode = statusCode;
+        request.responseHeadersHandle = responseHeadersHandle;
+        request.responseContent = NULL;
+        request.onResponseBody = onResponseBody;
+        request.onResponseBodyContext = onResponseBodyContext;
+
+        result = ExecuteRequest((HTTP_HANDLE_DATA*)handle, &request);
     }
-    /*Codes_SRS_HTTPAPI_COMPACT_21_074: [ After the header, the message received by the HTTPAPI_ExecuteRequest can contain addition information about the content. ]*/
-    else if ((result = ReceiveContentInfoFromXIO(http_instance, responseHeadersHandle, &bodyLength, &chunked)) != HTTPAPI_OK)
+
+    return result;
+}
+
+HTTPAPI_RESULT HTTPAPI_ExecuteRequests(HTTP_HANDLE handle, const HTTPAPI_REQUEST* requests, size_t requestCount, size_t* completedCount)
+{
+    HTTPAPI_RESULT result;
+    HTTP_HANDLE_DATA* http_instance = (HTTP_HANDLE_DATA*)handle;
+
+    if ((http_instance == NULL) ||
+        (requests == NULL) ||
+        (requestCount == 0) ||
+        (completedCount == NULL))
     {
-        LogError("Receive content information from HTTP failed (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
+        result = HTTPAPI_INVALID_ARG;
+        LogError("(result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
     }
-    /*Codes_SRS_HTTPAPI_COMPACT_21_075: [ The message received by the HTTPAPI_ExecuteRequest can contain a body with the message content. ]*/
-    else if ((result = ReadHTTPResponseBodyFromXIO(http_instance, bodyLength, chunked, responseContent)) != HTTPAPI_OK)
+    else
     {
-        LogError("Read HTTP response body from HTTP failed (result = %s)", ENUM_TO_STRING(HTTPAPI_RESULT, result));
-    }
-
-    conn_receive_discard_buffer(http_instance);
+        size_t i;
+        size_t headersCount;
+        for (i = 0; i < requestCount; i++)
+        {
+            if (!validRequest(&requests[i], &headersCount))
+            {
+                break;
+            }
+        }
 
+        if (i < requestCount)
+        {
+            *completedCount = 0;
+            result = HTTPAPI_INVALID_ARG;
+            LogError("Invalid request %lu (result = %s)", (unsigned long)i, ENUM_TO_STRING(HTTPAPI_RESULT, result));
+        }
+        else
+        {
+            result = ExecuteRequests(http_instance, requests, requestCount, completedCount);
+        }
+    }
 
     return result;
 }
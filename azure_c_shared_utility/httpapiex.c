@@ -22,6 +22,10 @@ typedef struct HTTPAPIEX_HANDLE_DATA_TAG
     int k;
     HTTP_HANDLE httpHandle;
     VECTOR_HANDLE savedOptions;
+    /*temporaries used when the caller does not pass its own, kept for the lifetime of the handle*/
+    HTTP_HEADERS_HANDLE requestHttpHeaders;
+    HTTP_HEADERS_HANDLE responseHttpHeaders;
+    BUFFER_HANDLE responseContent;
 }HTTPAPIEX_HANDLE_DATA;
 
 DEFINE_ENUM_STRINGS(HTTPAPIEX_RESULT, HTTPAPIEX_RESULT_VALUES);
@@ -70,6 +74,9 @@ HTTPAPIEX_HANDLE HTTPAPIEX_Create(const char* hostName)
                 {
                     handleData->k = -1;
                     handleData->httpHandle = NULL;
+                    handleData->requestHttpHeaders = NULL;
+                    handleData->responseHttpHeaders = NULL;
+                    handleData->responseContent = NULL;
                     result = handleData;
                 }
             }
@@ -81,7 +88,7 @@ HTTPAPIEX_HANDLE HTTPAPIEX_Create(const char* hostName)
 /*this function builds the default request http headers if none are specified*/
 /*returns 0 if no error*/
 /*any other code is error*/
-static int buildRequestHttpHeadersHandle(HTTPAPIEX_HANDLE_DATA *handleData, BUFFER_HANDLE requestContent, HTTP_HEADERS_HANDLE originalRequestHttpHeadersHandle, bool* isOriginalRequestHttpHeadersHandle, HTTP_HEADERS_HANDLE* toBeUsedRequestHttpHeadersHandle)
+static int buildRequestHttpHeadersHandle(HTTPAPIEX_HANDLE_DATA *handleData, size_t requestContentLength, HTTP_HEADERS_HANDLE originalRequestHttpHeadersHandle, HTTP_HEADERS_HANDLE* toBeUsedRequestHttpHeadersHandle)
 {
     int result;
 
@@ -89,8 +96,6 @@ static int buildRequestHttpHeadersHandle(HTTPAPIEX_HANDLE_DATA *handleData, BUFF
     if (originalRequestHttpHeadersHandle != NULL)
     {
         *toBeUsedRequestHttpHeadersHandle = originalRequestHttpHeadersHandle;
-        *isOriginalRequestHttpHeadersHandle = true;
-
     }
     else
     {
@@ -98,8 +103,12 @@ static int buildRequestHttpHeadersHandle(HTTPAPIEX_HANDLE_DATA *handleData, BUFF
         Host:{hostname} - as it was indicated by the call to HTTPAPIEX_Create API call
         Content-Length:the size of the requestContent parameter, and use this instance to all the subsequent calls to HTTPAPI_ExecuteRequest as parameter httpHeadersHandle.]
         */
-        *isOriginalRequestHttpHeadersHandle = false;
-        *toBeUsedRequestHttpHeadersHandle = HTTPHeaders_Alloc();
+        /*the instance is kept between calls, it only ever holds Host and Content-Length and both are replaced below*/
+        if (handleData->requestHttpHeaders == NULL)
+        {
+            handleData->requestHttpHeaders = HTTPHeaders_Alloc();
+        }
+        *toBeUsedRequestHttpHeadersHandle = handleData->requestHttpHeaders;
     }
 
     if (*toBeUsedRequestHttpHeadersHandle == NULL)
@@ -110,7 +119,7 @@ static int buildRequestHttpHeadersHandle(HTTPAPIEX_HANDLE_DATA *handleData, BUFF
     else
     {
         char temp[22] = { 0 };
-        (void)size_tToString(temp, 22, BUFFER_length(requestContent)); /*cannot fail, MAX_uint64 has 19 digits*/
+        (void)size_tToString(temp, 22, requestContentLength); /*cannot fail, MAX_uint64 has 19 digits*/
         /*Codes_SRS_HTTPAPIEX_02_011: [If parameter requestHttpHeadersHandle is not NULL then HTTPAPIEX_ExecuteRequest shall create or update the following headers of the request:
         Host:{hostname}
         Content-Length:the size of the requestContent parameter, and shall use the so constructed HTTPHEADERS object to all calls to HTTPAPI_ExecuteRequest as parameter httpHeadersHandle.]
@@ -124,10 +133,6 @@ static int buildRequestHttpHeadersHandle(HTTPAPIEX_HANDLE_DATA *handleData, BUFF
             (HTTPHeaders_ReplaceHeaderNameValuePair(*toBeUsedRequestHttpHeadersHandle, "Content-Length", temp) == HTTP_HEADERS_OK)
             ))
         {
-            if (! *isOriginalRequestHttpHeadersHandle)
-            { 
-                HTTPHeaders_Free(*toBeUsedRequestHttpHeadersHandle);
-            }
             *toBeUsedRequestHttpHeadersHandle = NULL;
             result = __FAILURE__;
         }
@@ -139,17 +144,20 @@ static int buildRequestHttpHeadersHandle(HTTPAPIEX_HANDLE_DATA *handleData, BUFF
     return result;
 }
 
-static int buildResponseHttpHeadersHandle(HTTP_HEADERS_HANDLE originalResponsetHttpHeadersHandle, bool* isOriginalResponseHttpHeadersHandle, HTTP_HEADERS_HANDLE* toBeUsedResponsetHttpHeadersHandle)
+static int buildResponseHttpHeadersHandle(HTTPAPIEX_HANDLE_DATA *handleData, HTTP_HEADERS_HANDLE originalResponsetHttpHeadersHandle, bool* isOriginalResponseHttpHeadersHandle, HTTP_HEADERS_HANDLE* toBeUsedResponsetHttpHeadersHandle)
 {
     int result;
     if (originalResponsetHttpHeadersHandle == NULL)
     {
-        if ((*toBeUsedResponsetHttpHeadersHandle = HTTPHeaders_Alloc()) == NULL)
+        /*the instance is kept between calls and emptied after every request*/
+        if ((handleData->responseHttpHeaders == NULL) &&
+            ((handleData->responseHttpHeaders = HTTPHeaders_Alloc()) == NULL))
         {
             result = __FAILURE__;
         }
         else
         {
+            *toBeUsedResponsetHttpHeadersHandle = handleData->responseHttpHeaders;
             *isOriginalResponseHttpHeadersHandle = false;
             result = 0;
         }
@@ -164,26 +172,28 @@ static int buildResponseHttpHeadersHandle(HTTP_HEADERS_HANDLE originalResponsetH
 }
 
 
-static int buildBufferIfNotExist(BUFFER_HANDLE originalRequestContent, bool* isOriginalRequestContent, BUFFER_HANDLE* toBeUsedRequestContent)
+static int buildBufferIfNotExist(BUFFER_HANDLE* cachedContent, BUFFER_HANDLE originalContent, bool* isOriginalContent, BUFFER_HANDLE* toBeUsedContent)
 {
     int result;
-    if (originalRequestContent == NULL)
+    if (originalContent == NULL)
     {
-        *toBeUsedRequestContent = BUFFER_new();
-        if (*toBeUsedRequestContent == NULL)
+        /*the buffer is kept between calls and unbuilt after every request*/
+        if ((*cachedContent == NULL) &&
+            ((*cachedContent = BUFFER_new()) == NULL))
         {
             result = __FAILURE__;
         }
         else
         {
-            *isOriginalRequestContent = false;
+            *toBeUsedContent = *cachedContent;
+            *isOriginalContent = false;
             result = 0;
         }
     }
     else
     {
-        *isOriginalRequestContent = true;
-        *toBeUsedRequestContent = originalRequestContent;
+        *isOriginalContent = true;
+        *toBeUsedContent = originalContent;
         result = 0;
     }
     return result;
@@ -196,8 +206,7 @@ static int buildAllRequests(HTTPAPIEX_HANDLE_DATA* handle, HTTPAPI_REQUEST_TYPE
     HTTP_HEADERS_HANDLE responseHttpHeadersHandle, BUFFER_HANDLE responseContent,
 
     const char** toBeUsedRelativePath, 
-    HTTP_HEADERS_HANDLE *toBeUsedRequestHttpHeadersHandle, bool *isOriginalRequestHttpHeadersHandle,
-    BUFFER_HANDLE *toBeUsedRequestContent, bool *isOriginalRequestContent,
+    HTTP_HEADERS_HANDLE *toBeUsedRequestHttpHeadersHandle,
     unsigned int** toBeUsedStatusCode,
     HTTP_HEADERS_HANDLE *toBeUsedResponseHttpHeadersHandle, bool *isOriginalResponseHttpHeadersHandle,
     BUFFER_HANDLE *toBeUsedResponseContent, bool *isOriginalResponseContent)
@@ -206,91 +215,215 @@ static int buildAllRequests(HTTPAPIEX_HANDLE_DATA* handle, HTTPAPI_REQUEST_TYPE
     (void)requestType;
     /*Codes_SRS_HTTPAPIEX_02_013: [If requestContent is NULL then HTTPAPIEX_ExecuteRequest shall behave as if a buffer of zero size would have been used, that is, it shall call HTTPAPI_ExecuteRequest with parameter content = NULL and contentLength = 0.]*/
     /*Codes_SRS_HTTPAPIEX_02_014: [If requestContent is not NULL then its content and its size shall be used for parameters content and contentLength of HTTPAPI_ExecuteRequest.] */
-    if (buildBufferIfNotExist(requestContent, isOriginalRequestContent, toBeUsedRequestContent) != 0)
+    if (buildRequestHttpHeadersHandle(handle, BUFFER_length(requestContent), requestHttpHeadersHandle, toBeUsedRequestHttpHeadersHandle) != 0)
     {
-        LogError("unable to build the request content");
+        /*Codes_SRS_HTTPAPIEX_02_010: [If any of the operations in SRS_HTTAPIEX_02_009 fails, then HTTPAPIEX_ExecuteRequest shall return HTTPAPIEX_ERROR.] */
+        LogError("unable to build the request http headers handle");
         result = __FAILURE__;
     }
     else
     {
-        if (buildRequestHttpHeadersHandle(handle, *toBeUsedRequestContent, requestHttpHeadersHandle, isOriginalRequestHttpHeadersHandle, toBeUsedRequestHttpHeadersHandle) != 0)
+        /*Codes_SRS_HTTPAPIEX_02_008: [If parameter relativePath is NULL then HTTPAPIEX_INVALID_ARG shall not assume a relative path - that is, it will assume an empty path ("").] */
+        if (relativePath == NULL)
         {
-            /*Codes_SRS_HTTPAPIEX_02_010: [If any of the operations in SRS_HTTAPIEX_02_009 fails, then HTTPAPIEX_ExecuteRequest shall return HTTPAPIEX_ERROR.] */
-            if (*isOriginalRequestContent == false) 
-            {
-                BUFFER_delete(*toBeUsedRequestContent);
-            }
-            LogError("unable to build the request http headers handle");
+            *toBeUsedRelativePath = "";
+        }
+        else
+        {
+            *toBeUsedRelativePath = relativePath;
+        }
+
+        /*Codes_SRS_HTTPAPIEX_02_015: [If statusCode is NULL then HTTPAPIEX_ExecuteRequest shall not write in statusCode the HTTP status code, and it will use a temporary internal int for parameter statusCode to the calls of HTTPAPI_ExecuteRequest.] */
+        if (statusCode == NULL)
+        {
+            /*Codes_SRS_HTTPAPIEX_02_016: [If statusCode is not NULL then If statusCode is NULL then HTTPAPIEX_ExecuteRequest shall use it for parameter statusCode to the calls of HTTPAPI_ExecuteRequest.] */
+            *toBeUsedStatusCode = &dummyStatusCode;
+        }
+        else
+        {
+            *toBeUsedStatusCode = statusCode;
+        }
+
+        /*Codes_SRS_HTTPAPIEX_02_017: [If responseHeaders handle is NULL then HTTPAPIEX_ExecuteRequest shall create a temporary internal instance of HTTPHEADERS object and use that for responseHeaders parameter of HTTPAPI_ExecuteRequest call.] */
+        /*Codes_SRS_HTTPAPIEX_02_019: [If responseHeaders is not NULL, then then HTTPAPIEX_ExecuteRequest shall use that object as parameter responseHeaders of HTTPAPI_ExecuteRequest call.] */
+        if (buildResponseHttpHeadersHandle(handle, responseHttpHeadersHandle, isOriginalResponseHttpHeadersHandle, toBeUsedResponseHttpHeadersHandle) != 0)
+        {
+            /*Codes_SRS_HTTPAPIEX_02_018: [If creating the temporary http headers in SRS_HTTPAPIEX_02_017 fails then HTTPAPIEX_ExecuteRequest shall return HTTPAPIEX_ERROR.] */
+            LogError("unable to build response content");
             result = __FAILURE__;
         }
         else
         {
-            /*Codes_SRS_HTTPAPIEX_02_008: [If parameter relativePath is NULL then HTTPAPIEX_INVALID_ARG shall not assume a relative path - that is, it will assume an empty path ("").] */
-            if (relativePath == NULL)
+            /*Codes_SRS_HTTPAPIEX_02_020: [If responseContent is NULL then HTTPAPIEX_ExecuteRequest shall create a temporary internal BUFFER object and use that as parameter responseContent of HTTPAPI_ExecuteRequest call.] */
+            /*Codes_SRS_HTTPAPIEX_02_022: [If responseContent is not NULL then HTTPAPIEX_ExecuteRequest use that as parameter responseContent of HTTPAPI_ExecuteRequest call.] */
+            if (buildBufferIfNotExist(&handle->responseContent, responseContent, isOriginalResponseContent, toBeUsedResponseContent) != 0)
             {
-                *toBeUsedRelativePath = "";
+                /*Codes_SRS_HTTPAPIEX_02_021: [If creating the BUFFER_HANDLE in SRS_HTTPAPIEX_02_020 fails, then HTTPAPIEX_ExecuteRequest shall return HTTPAPIEX_ERROR.] */
+                LogError("unable to build response content");
+                result = __FAILURE__;
             }
             else
             {
-                *toBeUsedRelativePath = relativePath;
+                result = 0;
             }
+        }
+    }
+    return result;
+}
 
-            /*Codes_SRS_HTTPAPIEX_02_015: [If statusCode is NULL then HTTPAPIEX_ExecuteRequest shall not write in statusCode the HTTP status code, and it will use a temporary internal int for parameter statusCode to the calls of HTTPAPI_ExecuteRequest.] */
-            if (statusCode == NULL)
-            {
-                /*Codes_SRS_HTTPAPIEX_02_016: [If statusCode is not NULL then If statusCode is NULL then HTTPAPIEX_ExecuteRequest shall use it for parameter statusCode to the calls of HTTPAPI_ExecuteRequest.] */
-                *toBeUsedStatusCode = &dummyStatusCode;
-            }
-            else
-            {
-                *toBeUsedStatusCode = statusCode;
-            }
+/*runs the requests through the recovery sequence, on a failure only the requests that have not completed yet are sent again*/
+static HTTPAPIEX_RESULT executeWithRecovery(HTTPAPIEX_HANDLE_DATA* handleData, const HTTPAPI_REQUEST* requests, size_t requestCount)
+{
+    HTTPAPIEX_RESULT result;
+    size_t completed = 0;
+
+    /*Codes_SRS_HTTPAPIEX_02_023: [HTTPAPIEX_ExecuteRequest shall try to execute the HTTP call by ensuring the following API call sequence is respected:]*/
+    /*Codes_SRS_HTTPAPIEX_02_024: [If any point in the sequence fails, HTTPAPIEX_ExecuteRequest shall attempt to recover by going back to the previous step and retrying that step.]*/
+    /*Codes_SRS_HTTPAPIEX_02_025: [If the first step fails, then the sequence fails.]*/
+    /*Codes_SRS_HTTPAPIEX_02_026: [A step shall be retried at most once.]*/
+    /*Codes_SRS_HTTPAPIEX_02_027: [If a step has been retried then all subsequent steps shall be retried too.]*/
+    bool st[3] = { false, false, false }; /*the three levels of possible failure in resilient send: HTTAPI_Init, HTTPAPI_CreateConnection, HTTPAPI_ExecuteRequest*/
+    if (handleData->k == -1)
+    {
+        handleData->k = 0;
+    }
+
+    do
+    {
+        bool goOn;
+
+        if (handleData->k > 2)
+        {
+            /* error */
+            break;
+        }
 
-            /*Codes_SRS_HTTPAPIEX_02_017: [If responseHeaders handle is NULL then HTTPAPIEX_ExecuteRequest shall create a temporary internal instance of HTTPHEADERS object and use that for responseHeaders parameter of HTTPAPI_ExecuteRequest call.] */
-            /*Codes_SRS_HTTPAPIEX_02_019: [If responseHeaders is not NULL, then then HTTPAPIEX_ExecuteRequest shall use that object as parameter responseHeaders of HTTPAPI_ExecuteRequest call.] */
-            if (buildResponseHttpHeadersHandle(responseHttpHeadersHandle, isOriginalResponseHttpHeadersHandle, toBeUsedResponseHttpHeadersHandle) != 0)
+        if (st[handleData->k] == true) /*already been tried*/
+        {
+            goOn = false;
+        }
+        else
+        {
+            switch (handleData->k)
+            {
+            case 0:
             {
-                /*Codes_SRS_HTTPAPIEX_02_018: [If creating the temporary http headers in SRS_HTTPAPIEX_02_017 fails then HTTPAPIEX_ExecuteRequest shall return HTTPAPIEX_ERROR.] */
-                if (*isOriginalRequestContent == false)
+                if (HTTPAPI_Init() != HTTPAPI_OK)
                 {
-                    BUFFER_delete(*toBeUsedRequestContent);
+                    goOn = false;
                 }
-                if (*isOriginalRequestHttpHeadersHandle == false)
+                else
                 {
-                    HTTPHeaders_Free(*toBeUsedRequestHttpHeadersHandle);
+                    goOn = true;
                 }
-                LogError("unable to build response content");
-                result = __FAILURE__;
+                break;
             }
-            else
+            case 1:
             {
-                /*Codes_SRS_HTTPAPIEX_02_020: [If responseContent is NULL then HTTPAPIEX_ExecuteRequest shall create a temporary internal BUFFER object and use that as parameter responseContent of HTTPAPI_ExecuteRequest call.] */
-                /*Codes_SRS_HTTPAPIEX_02_022: [If responseContent is not NULL then HTTPAPIEX_ExecuteRequest use that as parameter responseContent of HTTPAPI_ExecuteRequest call.] */
-                if (buildBufferIfNotExist(responseContent, isOriginalResponseContent, toBeUsedResponseContent) != 0)
+                if ((handleData->httpHandle = HTTPAPI_CreateConnection(STRING_c_str(handleData->hostName))) == NULL)
                 {
-                    /*Codes_SRS_HTTPAPIEX_02_021: [If creating the BUFFER_HANDLE in SRS_HTTPAPIEX_02_020 fails, then HTTPAPIEX_ExecuteRequest shall return HTTPAPIEX_ERROR.] */
-                    if (*isOriginalRequestContent == false)
+                    goOn = false;
+                }
+                else
+                {
+                    size_t i;
+                    size_t vectorSize = VECTOR_size(handleData->savedOptions);
+                    for (i = 0; i < vectorSize; i++)
                     {
-                        BUFFER_delete(*toBeUsedRequestContent);
+                        /*Codes_SRS_HTTPAPIEX_02_035: [HTTPAPIEX_ExecuteRequest shall pass all the saved options (see HTTPAPIEX_SetOption) to the newly create HTTPAPI_HANDLE in step 2 by calling HTTPAPI_SetOption.]*/
+                        /*Codes_SRS_HTTPAPIEX_02_036: [If setting the option fails, then the failure shall be ignored.] */
+                        HTTPAPIEX_SAVED_OPTION* option = (HTTPAPIEX_SAVED_OPTION*)VECTOR_element(handleData->savedOptions, i);
+                        if (HTTPAPI_SetOption(handleData->httpHandle, option->optionName, option->value) != HTTPAPI_OK)
+                        {
+                            LogError("HTTPAPI_SetOption failed when called for option %s", option->optionName);
+                        }
                     }
-                    if (*isOriginalRequestHttpHeadersHandle == false)
+                    goOn = true;
+                }
+                break;
+            }
+            case 2:
+            {
+                /*HTTPAPI_ExecuteRequest has no body callback, a request that streams its body goes through HTTPAPI_ExecuteRequests even alone*/
+                if ((requestCount == 1) &&
+                    (requests->onResponseBody == NULL))
+                {
+                    const HTTPAPI_REQUEST* request = requests;
+                    if (HTTPAPI_ExecuteRequest(handleData->httpHandle, request->requestType, request->relativePath, request->httpHeadersHandle, request->content, request->contentLength, request->statusCode, request->responseHeadersHandle, request->responseContent) != HTTPAPI_OK)
                     {
-                        HTTPHeaders_Free(*toBeUsedRequestHttpHeadersHandle);
+                        goOn = false;
                     }
-                    if (*isOriginalResponseHttpHeadersHandle == false)
+                    else
                     {
-                        HTTPHeaders_Free(*toBeUsedResponseHttpHeadersHandle);
+                        completed = 1;
+                        goOn = true;
                     }
-                    LogError("unable to build response content");
-                    result = __FAILURE__;
                 }
                 else
                 {
-                    result = 0;
+                    size_t justCompleted = 0;
+                    HTTPAPI_RESULT httpResult = HTTPAPI_ExecuteRequests(handleData->httpHandle, requests + completed, requestCount - completed, &justCompleted);
+                    completed += justCompleted;
+                    goOn = (httpResult == HTTPAPI_OK);
                 }
+                break;
+            }
+            default:
+            {
+                /*serious error*/
+                goOn = false;
+                break;
+            }
             }
         }
-    }
+
+        if (goOn)
+        {
+            if (handleData->k == 2)
+            {
+                /*Codes_SRS_HTTPAPIEX_02_028: [HTTPAPIEX_ExecuteRequest shall return HTTPAPIEX_OK when a call to HTTPAPI_ExecuteRequest has been completed successfully.]*/
+                result = HTTPAPIEX_OK;
+                goto out;
+            }
+            else
+            {
+                st[handleData->k] = true;
+                handleData->k++;
+                st[handleData->k] = false;
+            }
+        }
+        else
+        {
+            st[handleData->k] = false;
+            handleData->k--;
+            switch (handleData->k)
+            {
+            case 0:
+            {
+                HTTPAPI_Deinit();
+                break;
+            }
+            case 1:
+            {
+                HTTPAPI_CloseConnection(handleData->httpHandle);
+                handleData->httpHandle = NULL;
+                break;
+            }
+            case 2:
+            {
+                break;
+            }
+            default:
+            {
+                break;
+            }
+            }
+        }
+    } while (handleData->k >= 0);
+    /*Codes_SRS_HTTPAPIEX_02_029: [Otherwise, HTTAPIEX_ExecuteRequest shall return HTTPAPIEX_RECOVERYFAILED.] */
+    result = HTTPAPIEX_RECOVERYFAILED;
+    LogError("unable to recover sending to a working state");
+out:;
     return result;
 }
 
@@ -319,16 +452,14 @@ HTTPAPIEX_RESULT HTTPAPIEX_ExecuteRequest(HTTPAPIEX_HANDLE handle, HTTPAPI_REQUE
 
             /*call to buildAll*/
             const char* toBeUsedRelativePath;
-            HTTP_HEADERS_HANDLE toBeUsedRequestHttpHeadersHandle; bool isOriginalRequestHttpHeadersHandle;
-            BUFFER_HANDLE toBeUsedRequestContent; bool isOriginalRequestContent;
+            HTTP_HEADERS_HANDLE toBeUsedRequestHttpHeadersHandle;
             unsigned int* toBeUsedStatusCode;
             HTTP_HEADERS_HANDLE toBeUsedResponseHttpHeadersHandle; bool isOriginalResponseHttpHeadersHandle;
             BUFFER_HANDLE toBeUsedResponseContent;  bool isOriginalResponseContent;
 
             if (buildAllRequests(handleData, requestType, relativePath, requestHttpHeadersHandle, requestContent, statusCode, responseHttpHeadersHandle, responseContent,
                 &toBeUsedRelativePath,
-                &toBeUsedRequestHttpHeadersHandle, &isOriginalRequestHttpHeadersHandle,
-                &toBeUsedRequestContent, &isOriginalRequestContent,
+                &toBeUsedRequestHttpHeadersHandle,
                 &toBeUsedStatusCode,
                 &toBeUsedResponseHttpHeadersHandle, &isOriginalResponseHttpHeadersHandle,
                 &toBeUsedResponseContent, &isOriginalResponseContent) != 0)
@@ -338,166 +469,88 @@ HTTPAPIEX_RESULT HTTPAPIEX_ExecuteRequest(HTTPAPIEX_HANDLE handle, HTTPAPI_REQUE
             }
             else
             {
-
-                /*Codes_SRS_HTTPAPIEX_02_023: [HTTPAPIEX_ExecuteRequest shall try to execute the HTTP call by ensuring the following API call sequence is respected:]*/
-                /*Codes_SRS_HTTPAPIEX_02_024: [If any point in the sequence fails, HTTPAPIEX_ExecuteRequest shall attempt to recover by going back to the previous step and retrying that step.]*/
-                /*Codes_SRS_HTTPAPIEX_02_025: [If the first step fails, then the sequence fails.]*/
-                /*Codes_SRS_HTTPAPIEX_02_026: [A step shall be retried at most once.]*/
-                /*Codes_SRS_HTTPAPIEX_02_027: [If a step has been retried then all subsequent steps shall be retried too.]*/
-                bool st[3] = { false, false, false }; /*the three levels of possible failure in resilient send: HTTAPI_Init, HTTPAPI_CreateConnection, HTTPAPI_ExecuteRequest*/
-                if (handleData->k == -1)
+                HTTPAPI_REQUEST request;
+                request.requestType = requestType;
+                request.relativePath = toBeUsedRelativePath;
+                request.httpHeadersHandle = toBeUsedRequestHttpHeadersHandle;
+                request.content = BUFFER_u_char(requestContent);
+                request.contentLength = BUFFER_length(requestContent);
+                request.statusCode = toBeUsedStatusCode;
+                request.responseHeadersHandle = toBeUsedResponseHttpHeadersHandle;
+                request.responseContent = toBeUsedResponseContent;
+                request.onResponseBody = NULL;
+                request.onResponseBodyContext = NULL;
+
+                result = executeWithRecovery(handleData, &request, 1);
+
+                /*in all cases, empty the temporaries so they are ready for the next call*/
+                if (isOriginalResponseContent == false)
                 {
-                    handleData->k = 0;
+                    (void)BUFFER_unbuild(toBeUsedResponseContent);
                 }
-
-                do
+                if (isOriginalResponseHttpHeadersHandle == false)
                 {
-                    bool goOn;
+                    (void)HTTPHeaders_Clear(toBeUsedResponseHttpHeadersHandle);
+                }
+            }
+        }
+    }
+    return result;
+}
 
-                    if (handleData->k > 2)
-                    {
-                        /* error */
-                        break;
-                    }
+HTTPAPIEX_RESULT HTTPAPIEX_ExecuteRequests(HTTPAPIEX_HANDLE handle, const HTTPAPI_REQUEST* requests, size_t requestCount)
+{
+    HTTPAPIEX_RESULT result;
+    if ((handle == NULL) || (requests == NULL) || (requestCount == 0))
+    {
+        result = HTTPAPIEX_INVALID_ARG;
+        LOG_HTTAPIEX_ERROR();
+    }
+    else
+    {
+        HTTPAPIEX_HANDLE_DATA *handleData = (HTTPAPIEX_HANDLE_DATA *)handle;
+        size_t i;
 
-                    if (st[handleData->k] == true) /*already been tried*/
-                    {
-                        goOn = false;
-                    }
-                    else
-                    {
-                        switch (handleData->k)
-                        {
-                        case 0:
-                        {
-                            if (HTTPAPI_Init() != HTTPAPI_OK)
-                            {
-                                goOn = false;
-                            }
-                            else
-                            {
-                                goOn = true;
-                            }
-                            break;
-                        }
-                        case 1:
-                        {
-                            if ((handleData->httpHandle = HTTPAPI_CreateConnection(STRING_c_str(handleData->hostName))) == NULL)
-                            {
-                                goOn = false;
-                            }
-                            else
-                            {
-                                size_t i;
-                                size_t vectorSize = VECTOR_size(handleData->savedOptions);
-                                for (i = 0; i < vectorSize; i++)
-                                {
-                                    /*Codes_SRS_HTTPAPIEX_02_035: [HTTPAPIEX_ExecuteRequest shall pass all the saved options (see HTTPAPIEX_SetOption) to the newly create HTTPAPI_HANDLE in step 2 by calling HTTPAPI_SetOption.]*/
-                                    /*Codes_SRS_HTTPAPIEX_02_036: [If setting the option fails, then the failure shall be ignored.] */
-                                    HTTPAPIEX_SAVED_OPTION* option = (HTTPAPIEX_SAVED_OPTION*)VECTOR_element(handleData->savedOptions, i);
-                                    if (HTTPAPI_SetOption(handleData->httpHandle, option->optionName, option->value) != HTTPAPI_OK)
-                                    {
-                                        LogError("HTTPAPI_SetOption failed when called for option %s", option->optionName);
-                                    }
-                                }
-                                goOn = true;
-                            }
-                            break;
-                        }
-                        case 2:
-                        {
-                            size_t length = BUFFER_length(toBeUsedRequestContent);
-                            unsigned char* buffer = BUFFER_u_char(toBeUsedRequestContent);
-                            if (HTTPAPI_ExecuteRequest(handleData->httpHandle, requestType, toBeUsedRelativePath, toBeUsedRequestHttpHeadersHandle, buffer, length, toBeUsedStatusCode, toBeUsedResponseHttpHeadersHandle, toBeUsedResponseContent) != HTTPAPI_OK)
-                            {
-                                goOn = false;
-                            }
-                            else
-                            {
-                                goOn = true;
-                            }
-                            break;
-                        }
-                        default:
-                        {
-                            /*serious error*/
-                            goOn = false;
-                            break;
-                        }
-                        }
-                    }
+        for (i = 0; i < requestCount; i++)
+        {
+            if ((requests[i].requestType >= COUNT_ARG(HTTPAPI_REQUEST_TYPE_VALUES)) ||
+                (requests[i].relativePath == NULL) ||
+                (requests[i].httpHeadersHandle == NULL))
+            {
+                break;
+            }
+        }
 
-                    if (goOn)
-                    {
-                        if (handleData->k == 2)
-                        {
-                            /*Codes_SRS_HTTPAPIEX_02_028: [HTTPAPIEX_ExecuteRequest shall return HTTPAPIEX_OK when a call to HTTPAPI_ExecuteRequest has been completed successfully.]*/
-                            result = HTTPAPIEX_OK;
-                            goto out;
-                        }
-                        else
-                        {
-                            st[handleData->k] = true;
-                            handleData->k++;
-                            st[handleData->k] = false;
-                        }
-                    }
-                    else
-                    {
-                        st[handleData->k] = false;
-                        handleData->k--;
-                        switch (handleData->k)
-                        {
-                        case 0:
-                        {
-                            HTTPAPI_Deinit();
-                            break;
-                        }
-                        case 1:
-                        {
-                            HTTPAPI_CloseConnection(handleData->httpHandle);
-                            handleData->httpHandle = NULL;
-                            break;
-                        }
-                        case 2:
-                        {
-                            break;
-                        }
-                        default:
-                        {
-                            break;
-                        }
-                        }
-                    }
-                } while (handleData->k >= 0);
-                /*Codes_SRS_HTTPAPIEX_02_029: [Otherwise, HTTAPIEX_ExecuteRequest shall return HTTPAPIEX_RECOVERYFAILED.] */
-                result = HTTPAPIEX_RECOVERYFAILED;
-                LogError("unable to recover sending to a working state");
-            out:;
-                /*in all cases, unbuild the temporaries*/
-                if (isOriginalRequestContent == false)
-                {
-                    BUFFER_delete(toBeUsedRequestContent);
-                }
-                if (isOriginalRequestHttpHeadersHandle == false)
-                {
-                    HTTPHeaders_Free(toBeUsedRequestHttpHeadersHandle);
-                }
-                if (isOriginalResponseContent == false)
-                {
-                    BUFFER_delete(toBeUsedResponseContent);
-                }
-                if (isOriginalResponseHttpHeadersHandle == false)
+        if (i < requestCount)
+        {
+            result = HTTPAPIEX_INVALID_ARG;
+            LogError("request %lu is not valid", (unsigned long)i);
+        }
+        else
+        {
+            for (i = 0; i < requestCount; i++)
+            {
+                HTTP_HEADERS_HANDLE unused;
+                if (buildRequestHttpHeadersHandle(handleData, requests[i].contentLength, requests[i].httpHeadersHandle, &unused) != 0)
                 {
-                    HTTPHeaders_Free(toBeUsedResponseHttpHeadersHandle);
+                    break;
                 }
             }
+
+            if (i < requestCount)
+            {
+                result = HTTPAPIEX_ERROR;
+                LOG_HTTAPIEX_ERROR();
+            }
+            else
+            {
+                result = executeWithRecovery(handleData, requests, requestCount);
+            }
         }
     }
     return result;
 }
 
-
 void HTTPAPIEX_Destroy(HTTPAPIEX_HANDLE handle)
 {
     if (handle != NULL)
@@ -523,6 +576,19 @@ void HTTPAPIEX_Destroy(HTTPAPIEX_HANDLE handle)
         }
         VECTOR_destroy(handleData->savedOptions);
 
+        if (handleData->requestHttpHeaders != NULL)
+        {
+            HTTPHeaders_Free(handleData->requestHttpHeaders);
+        }
+        if (handleData->responseHttpHeaders != NULL)
+        {
+            HTTPHeaders_Free(handleData->responseHttpHeaders);
+        }
+        if (handleData->responseContent != NULL)
+        {
+            BUFFER_delete(handleData->responseContent);
+        }
+
         free(handle);
     }
     else
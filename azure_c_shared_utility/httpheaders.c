@@ -64,6 +64,30 @@ void HTTPHeaders_Free(HTTP_HEADERS_HANDLE handle)
     }
 }
 
+HTTP_HEADERS_RESULT HTTPHeaders_Clear(HTTP_HEADERS_HANDLE handle)
+{
+    HTTP_HEADERS_RESULT result;
+    if (handle == NULL)
+    {
+        result = HTTP_HEADERS_INVALID_ARG;
+        LogError("invalid arg (NULL) , result= %s", ENUM_TO_STRING(HTTP_HEADERS_RESULT, result));
+    }
+    else
+    {
+        HTTP_HEADERS_HANDLE_DATA* handleData = (HTTP_HEADERS_HANDLE_DATA*)handle;
+        if (Map_Clear(handleData->headers) != MAP_OK)
+        {
+            result = HTTP_HEADERS_ERROR;
+            LogError("Map_Clear failed, result= %s", ENUM_TO_STRING(HTTP_HEADERS_RESULT, result));
+        }
+        else
+        {
+            result = HTTP_HEADERS_OK;
+        }
+    }
+    return result;
+}
+
 /*Codes_SRS_HTTP_HEADERS_99_012:[ Calling this API shall record a header from name and value parameters.]*/
 static HTTP_HEADERS_RESULT headers_ReplaceHeaderNameValuePair(HTTP_HEADERS_HANDLE handle, const char* name, const char* value, bool replace)
 {
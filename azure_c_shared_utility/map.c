@@ -2,24 +2,171 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 #include <stdlib.h>
+#include <stdint.h>
 #include "azure_c_shared_utility/gballoc.h"
 #include "azure_c_shared_utility/map.h"
 #include "azure_c_shared_utility/optimize_size.h"
 #include "azure_c_shared_utility/xlogging.h"
 #include "azure_c_shared_utility/strings.h"
+#include "azure_c_shared_utility/refcount.h"
 
 DEFINE_ENUM_STRINGS(MAP_RESULT, MAP_RESULT_VALUES);
 
+/*keys and values are kept in insertion order (that is what Map_GetInternals hands out), the index is an
+open addressing table of positions into them, looked up by the hash of the key*/
+#if !defined(MAP_MIN_CAPACITY)
+#define MAP_MIN_CAPACITY 4
+#endif
+
+/*maps with no more entries than this are searched linearly (comparing hashes first) and have no index*/
+#if !defined(MAP_LINEAR_SCAN_LIMIT)
+#define MAP_LINEAR_SCAN_LIMIT 8
+#endif
+
+/*every key is allocated behind a small header holding its hash and a reference count. When MAP_INTERN_KEYS
+is defined Map_Clone (and so ConstMap_Create and ConstMap_CloneWriteable) takes a reference on the keys of
+the source map instead of copying them, keys are never modified once created*/
+typedef struct MAP_KEY_TAG
+{
+    uint32_t hash;
+}MAP_KEY;
+
+REFCOUNT_TYPE(MAP_KEY)
+{
+    MAP_KEY counted;
+    COUNT_TYPE count;
+};
+
 typedef struct MAP_HANDLE_DATA_TAG
 {
     char** keys;
     char** values;
     size_t count;
+    size_t capacity;
+    size_t* index; /*position + 1 of the entry, 0 for an empty slot*/
+    size_t indexSize; /*power of 2, at least twice the capacity*/
     MAP_FILTER_CALLBACK mapFilterCallback;
 }MAP_HANDLE_DATA;
 
 #define LOG_MAP_ERROR LogError("result = %s", ENUM_TO_STRING(MAP_RESULT, result));
 
+#define MAP_KEY_HEADER(key) (((REFCOUNT_TYPE(MAP_KEY)*)(key)) - 1)
+
+/*FNV-1a*/
+static uint32_t Map_HashKey(const char* key)
+{
+    uint32_t hash = 2166136261u;
+    while (*key != '\0')
+    {
+        hash ^= (unsigned char)*key++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static char* Map_CreateKey(const char* key, uint32_t hash)
+{
+    char* result;
+    size_t keyLength = strlen(key);
+    REFCOUNT_TYPE(MAP_KEY)* header = (REFCOUNT_TYPE(MAP_KEY)*)malloc(sizeof(REFCOUNT_TYPE(MAP_KEY)) + keyLength + 1);
+    if (header == NULL)
+    {
+        LogError("unable to malloc");
+        result = NULL;
+    }
+    else
+    {
+        header->counted.hash = hash;
+        header->count = 1;
+        result = (char*)(header + 1);
+        (void)memcpy(result, key, keyLength + 1);
+    }
+    return result;
+}
+
+static void Map_ReleaseKey(char* key)
+{
+    REFCOUNT_TYPE(MAP_KEY)* header = MAP_KEY_HEADER(key);
+    if (DEC_REF(MAP_KEY, header) == DEC_RETURN_ZERO)
+    {
+        free(header);
+    }
+}
+
+static size_t Map_IndexSizeFor(size_t capacity)
+{
+    size_t result;
+    if (capacity <= MAP_LINEAR_SCAN_LIMIT)
+    {
+        result = 0;
+    }
+    else
+    {
+        result = 16;
+        while (result < 2 * capacity)
+        {
+            result *= 2;
+        }
+    }
+    return result;
+}
+
+static void Map_IndexInsert(MAP_HANDLE_DATA* handleData, size_t position)
+{
+    size_t mask = handleData->indexSize - 1;
+    size_t slot = MAP_KEY_HEADER(handleData->keys[position])->counted.hash & mask;
+    while (handleData->index[slot] != 0)
+    {
+        slot = (slot + 1) & mask;
+    }
+    handleData->index[slot] = position + 1;
+}
+
+static void Map_RebuildIndex(MAP_HANDLE_DATA* handleData)
+{
+    size_t i;
+    (void)memset(handleData->index, 0, handleData->indexSize * sizeof(size_t));
+    for (i = 0; i < handleData->count; i++)
+    {
+        Map_IndexInsert(handleData, i);
+    }
+}
+
+/*replaces the index with one of indexSize slots (0 drops it), the old index is kept if that fails*/
+static int Map_ResizeIndex(MAP_HANDLE_DATA* handleData, size_t indexSize)
+{
+    int result;
+    if (indexSize == handleData->indexSize)
+    {
+        result = 0;
+    }
+    else if (indexSize == 0)
+    {
+        free(handleData->index);
+        handleData->index = NULL;
+        handleData->indexSize = 0;
+        result = 0;
+    }
+    else
+    {
+        size_t* newIndex = (size_t*)malloc(indexSize * sizeof(size_t));
+        if (newIndex == NULL)
+        {
+            LogError("unable to malloc");
+            result = __FAILURE__;
+        }
+        else
+        {
+            free(handleData->index);
+            handleData->index = newIndex;
+            handleData->indexSize = indexSize;
+            Map_RebuildIndex(handleData);
+            result = 0;
+        }
+    }
+    return result;
+}
+
 MAP_HANDLE Map_Create(MAP_FILTER_CALLBACK mapFilterFunc)
 {
     /*Codes_SRS_MAP_02_001: [Map_Create shall create a new, empty map.]*/
@@ -31,6 +178,9 @@ MAP_HANDLE Map_Create(MAP_FILTER_CALLBACK mapFilterFunc)
         result->keys = NULL;
         result->values = NULL;
         result->count = 0;
+        result->capacity = 0;
+        result->index = NULL;
+        result->indexSize = 0;
         result->mapFilterCallback = mapFilterFunc;
     }
     return (MAP_HANDLE)result;
@@ -47,11 +197,12 @@ void Map_Destroy(MAP_HANDLE handle)
       
         for (i = 0; i < handleData->count; i++)
         {
-            free(handleData->keys[i]);
+            Map_ReleaseKey(handleData->keys[i]);
             free(handleData->values[i]);
         }
         free(handleData->keys);
         free(handleData->values);
+        free(handleData->index);
         free(handleData);
     }
 }
@@ -95,6 +246,49 @@ static char** Map_CloneVector(const char*const * source, size_t count)
     return result;
 }
 
+/*same as Map_CloneVector, for keys. With MAP_INTERN_KEYS the keys are shared, not copied*/
+static char** Map_CloneKeys(char*const * source, size_t count)
+{
+    char** result;
+    result = (char**)malloc(count *sizeof(char*));
+    if (result == NULL)
+    {
+        /*do nothing, just return it (NULL)*/
+    }
+    else
+    {
+        size_t i;
+        for (i = 0; i < count; i++)
+        {
+#if defined(MAP_INTERN_KEYS)
+            (void)INC_REF(MAP_KEY, MAP_KEY_HEADER(source[i]));
+            result[i] = source[i];
+#else
+            if ((result[i] = Map_CreateKey(source[i], MAP_KEY_HEADER(source[i])->counted.hash)) == NULL)
+            {
+                break;
+            }
+#endif
+        }
+
+        if (i == count)
+        {
+            /*it is all good, proceed to return result*/
+        }
+        else
+        {
+            size_t j;
+            for (j = 0; j < i; j++)
+            {
+                Map_ReleaseKey(result[j]);
+            }
+            free(result);
+            result = NULL;
+        }
+    }
+    return result;
+}
+
 /*Codes_SRS_MAP_02_039: [Map_Clone shall make a copy of the map indicated by parameter handle and return a non-NULL handle to it.]*/
 MAP_HANDLE Map_Clone(MAP_HANDLE handle)
 {
@@ -117,9 +311,12 @@ MAP_HANDLE Map_Clone(MAP_HANDLE handle)
         }
         else
         {
+            result->index = NULL;
+            result->indexSize = 0;
             if (handleData->count == 0)  
             {
                 result->count = 0;
+                result->capacity = 0;
                 result->keys = NULL;
                 result->values = NULL;
                 result->mapFilterCallback = NULL;
@@ -128,7 +325,8 @@ MAP_HANDLE Map_Clone(MAP_HANDLE handle)
             {
                 result->mapFilterCallback = handleData->mapFilterCallback;
                 result->count = handleData->count;
-                if( (result->keys = Map_CloneVector((const char* const*)handleData->keys, handleData->count))==NULL)
+                result->capacity = handleData->count;
+                if( (result->keys = Map_CloneKeys(handleData->keys, handleData->count))==NULL)
                 {
                     /*Codes_SRS_MAP_02_047: [If during cloning, any operation fails, then Map_Clone shall return NULL.] */
                     LogError("unable to clone keys");
@@ -142,12 +340,19 @@ MAP_HANDLE Map_Clone(MAP_HANDLE handle)
                     LogError("unable to clone values");
                     for (i = 0; i < result->count; i++)
                     {
-                        free(result->keys[i]); 
+                        Map_ReleaseKey(result->keys[i]);
                     }
                     free(result->keys);
                     free(result);
                     result = NULL;
                 }
+                else if (Map_ResizeIndex(result, Map_IndexSizeFor(result->capacity)) != 0)
+                {
+                    /*Codes_SRS_MAP_02_047: [If during cloning, any operation fails, then Map_Clone shall return NULL.] */
+                    LogError("unable to index the clone");
+                    Map_Destroy((MAP_HANDLE)result);
+                    result = NULL;
+                }
                 else
                 {
                     /*all fine, return it*/
@@ -158,51 +363,56 @@ MAP_HANDLE Map_Clone(MAP_HANDLE handle)
     return (MAP_HANDLE)result;
 }
 
+/*makes room for one more entry, growing the arrays (and the index) geometrically*/
 static int Map_IncreaseStorageKeysValues(MAP_HANDLE_DATA* handleData)
 {
     int result;
-    char** newKeys = (char**)realloc(handleData->keys, (handleData->count + 1) * sizeof(char*));
-    if (newKeys == NULL)
+    if (handleData->count < handleData->capacity)
     {
-        LogError("realloc error");
-        result = __FAILURE__;
+        result = 0;
     }
     else
     {
-        char** newValues;
-        handleData->keys = newKeys;
-        handleData->keys[handleData->count] = NULL;
-        newValues = (char**)realloc(handleData->values, (handleData->count + 1) * sizeof(char*));
-        if (newValues == NULL)
+        size_t newCapacity = (handleData->capacity == 0) ? MAP_MIN_CAPACITY : handleData->capacity + handleData->capacity;
+        char** newKeys = (char**)realloc(handleData->keys, newCapacity * sizeof(char*));
+        if (newKeys == NULL)
         {
             LogError("realloc error");
-            if (handleData->count == 0) /*avoiding an implementation defined behavior */
+            result = __FAILURE__;
+        }
+        else
+        {
+            char** newValues;
+            /*a larger keys array is harmless if the rest fails, capacity only changes when all succeeded*/
+            handleData->keys = newKeys;
+            newValues = (char**)realloc(handleData->values, newCapacity * sizeof(char*));
+            if (newValues == NULL)
             {
-                free(handleData->keys);
-                handleData->keys = NULL;
+                LogError("realloc error");
+                result = __FAILURE__;
             }
             else
             {
-                char** undoneKeys = (char**)realloc(handleData->keys, (handleData->count) * sizeof(char*));
-                if (undoneKeys == NULL)
+                handleData->values = newValues;
+                if (Map_ResizeIndex(handleData, Map_IndexSizeFor(newCapacity)) != 0)
                 {
-                    LogError("CATASTROPHIC error, unable to undo through realloc to a smaller size");
+                    result = __FAILURE__;
                 }
                 else
                 {
-                    handleData->keys = undoneKeys;
+                    handleData->capacity = newCapacity;
+                    result = 0;
                 }
             }
-            result = __FAILURE__;
-        }
-        else
-        {
-            handleData->values = newValues;
-            handleData->values[handleData->count] = NULL;
-            handleData->count++;
-            result = 0;
         }
     }
+
+    if (result == 0)
+    {
+        handleData->keys[handleData->count] = NULL;
+        handleData->values[handleData->count] = NULL;
+        handleData->count++;
+    }
     return result;
 }
 
@@ -214,33 +424,16 @@ static void Map_DecreaseStorageKeysValues(MAP_HANDLE_DATA* handleData)
         handleData->keys = NULL;
         free(handleData->values);
         handleData->values = NULL;
+        free(handleData->index);
+        handleData->index = NULL;
+        handleData->indexSize = 0;
         handleData->count = 0;
+        handleData->capacity = 0;
         handleData->mapFilterCallback = NULL;
     }
     else
     {
-        /*certainly > 1...*/
-        char** undoneValues;
-        char** undoneKeys = (char**)realloc(handleData->keys, sizeof(char*)* (handleData->count - 1)); 
-        if (undoneKeys == NULL)
-        {
-            LogError("CATASTROPHIC error, unable to undo through realloc to a smaller size");
-        }
-        else
-        {
-            handleData->keys = undoneKeys;
-        }
-
-        undoneValues = (char**)realloc(handleData->values, sizeof(char*)* (handleData->count - 1));
-        if (undoneValues == NULL)
-        {
-            LogError("CATASTROPHIC error, unable to undo through realloc to a smaller size");
-        }
-        else
-        {
-            handleData->values = undoneValues;
-        }
-
+        /*certainly > 1... the storage is kept for the next insert*/
         handleData->count--;
     }
 }
@@ -254,14 +447,35 @@ static char** findKey(MAP_HANDLE_DATA* handleData, const char* key)
     }
     else
     {
-        size_t i;
+        uint32_t hash = Map_HashKey(key);
         result = NULL;
-        for (i = 0; i < handleData->count; i++)
+        if (handleData->index == NULL)
         {
-            if (strcmp(handleData->keys[i], key) == 0)
+            size_t i;
+            for (i = 0; i < handleData->count; i++)
             {
-                result = handleData->keys + i;
-                break;
+                if ((MAP_KEY_HEADER(handleData->keys[i])->counted.hash == hash) &&
+                    (strcmp(handleData->keys[i], key) == 0))
+                {
+                    result = handleData->keys + i;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            size_t mask = handleData->indexSize - 1;
+            size_t slot = hash & mask;
+            while (handleData->index[slot] != 0)
+            {
+                char** candidate = handleData->keys + handleData->index[slot] - 1;
+                if ((MAP_KEY_HEADER(*candidate)->counted.hash == hash) &&
+                    (strcmp(*candidate, key) == 0))
+                {
+                    result = candidate;
+                    break;
+                }
+                slot = (slot + 1) & mask;
             }
         }
     }
@@ -300,23 +514,27 @@ static int insertNewKeyValue(MAP_HANDLE_DATA* handleData, const char* key, const
     }
     else
     {
-        if (mallocAndStrcpy_s(&(handleData->keys[handleData->count - 1]), key) != 0)
+        if ((handleData->keys[handleData->count - 1] = Map_CreateKey(key, Map_HashKey(key))) == NULL)
         {
             Map_DecreaseStorageKeysValues(handleData);
-            LogError("unable to mallocAndStrcpy_s");
+            LogError("unable to create the key");
             result = __FAILURE__;
         }
         else
         {
             if (mallocAndStrcpy_s(&(handleData->values[handleData->count - 1]), value) != 0)
             {
-                free(handleData->keys[handleData->count - 1]);
+                Map_ReleaseKey(handleData->keys[handleData->count - 1]);
                 Map_DecreaseStorageKeysValues(handleData);
                 LogError("unable to mallocAndStrcpy_s");
                 result = __FAILURE__;
             }
             else
             {
+                if (handleData->index != NULL)
+                {
+                    Map_IndexInsert(handleData, handleData->count - 1);
+                }
                 result = 0;
             }
         }
@@ -465,11 +683,16 @@ MAP_RESULT Map_Delete(MAP_HANDLE handle, const char* key)
         {
             /*Codes_SRS_MAP_02_023: [Otherwise, Map_Delete shall remove the key and its associated value from the map and return MAP_OK.]*/
             size_t index = whereIsIt - handleData->keys;
-            free(handleData->keys[index]);
+            Map_ReleaseKey(handleData->keys[index]);
             free(handleData->values[index]);
             memmove(handleData->keys + index, handleData->keys + index + 1, (handleData->count - index - 1)*sizeof(char*)); /*if order doesn't matter... then this can be optimized*/
             memmove(handleData->values + index, handleData->values + index + 1, (handleData->count - index - 1)*sizeof(char*));
             Map_DecreaseStorageKeysValues(handleData);
+            if (handleData->index != NULL)
+            {
+                /*positions after the deleted entry have moved down by one*/
+                Map_RebuildIndex(handleData);
+            }
             result = MAP_OK;
         }
 
@@ -477,6 +700,34 @@ MAP_RESULT Map_Delete(MAP_HANDLE handle, const char* key)
     return result;
 }
 
+/*removes every key and value, the storage is kept for the entries added next*/
+MAP_RESULT Map_Clear(MAP_HANDLE handle)
+{
+    MAP_RESULT result;
+    if (handle == NULL)
+    {
+        result = MAP_INVALIDARG;
+        LOG_MAP_ERROR;
+    }
+    else
+    {
+        MAP_HANDLE_DATA* handleData = (MAP_HANDLE_DATA*)handle;
+        size_t i;
+        for (i = 0; i < handleData->count; i++)
+        {
+            Map_ReleaseKey(handleData->keys[i]);
+            free(handleData->values[i]);
+        }
+        handleData->count = 0;
+        if (handleData->index != NULL)
+        {
+            (void)memset(handleData->index, 0, handleData->indexSize * sizeof(size_t));
+        }
+        result = MAP_OK;
+    }
+    return result;
+}
+
 MAP_RESULT Map_ContainsKey(MAP_HANDLE handle, const char* key, bool* keyExists)
 {
     MAP_RESULT result;
@@ -42,8 +42,42 @@
 #include <stdlib.h>
 #include "azure_c_shared_utility/gballoc.h"
 
+#include <string.h>
 #include "azure_c_shared_utility/sha.h"
 #include "azure_c_shared_utility/sha-private.h"
+
+/*
+* Block compression backend, selected at build time:
+*   default               portable C below
+*   SHA256_BACKEND_MBEDTLS mbedtls_internal_sha256_process of the
+*                          software mbedTLS, the midstate is copied
+*                          in and out of its context
+*   SHA256_BACKEND_ALT     SHA256ProcessBlockAlt, provided by the
+*                          application (see sha.h), for a hash unit
+*                          that accepts a midstate
+*/
+#if defined(SHA256_BACKEND_MBEDTLS)
+#include "mbedtls/sha256.h"
+#if defined(MBEDTLS_SHA256_ALT)
+#error "SHA256_BACKEND_MBEDTLS needs the software mbedTLS SHA-256, MBEDTLS_SHA256_ALT contexts have no state to set"
+#endif
+#endif
+
+/* Big-endian 32-bit load from a possibly unaligned pointer */
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define SHA256_LOAD_BE(p) sha256_load_be(p)
+static inline uint32_t sha256_load_be(const uint8_t *p)
+{
+    uint32_t w;
+    memcpy(&w, p, sizeof(w));
+    return __builtin_bswap32(w);
+}
+#else
+#define SHA256_LOAD_BE(p)                                    \
+  ((((uint32_t)(p)[0]) << 24) | (((uint32_t)(p)[1]) << 16) | \
+   (((uint32_t)(p)[2]) << 8) | ((uint32_t)(p)[3]))
+#endif
+
 /* Define the SHA shift, rotate left and rotate right macro */
 #define SHA256_SHR(bits,word)      ((word) >> (bits))
 #define SHA256_ROTL(bits,word)                         \
@@ -75,6 +109,8 @@ static void SHA224_256Finalize(SHA256Context *context,
 static void SHA224_256PadMessage(SHA256Context *context,
     uint8_t Pad_Byte);
 static void SHA224_256ProcessMessageBlock(SHA256Context *context);
+static void SHA224_256Compress(uint32_t Intermediate_Hash[SHA256HashSize / 4],
+    const uint8_t *block);
 static int SHA224_256Reset(SHA256Context *context, uint32_t *H0);
 static int SHA224_256ResultN(SHA256Context *context,
     uint8_t Message_Digest[], int HashSize);
@@ -241,7 +277,20 @@ int SHA256Input(SHA256Context *context, const uint8_t *message_array,
     if (context->Corrupted)
         return context->Corrupted;
 
-    while (length-- && !context->Corrupted) {
+    while (length && !context->Corrupted) {
+        /*
+        * Whole blocks are compressed straight from the caller's
+        * array, only the head and tail go through Message_Block.
+        */
+        if (context->Message_Block_Index == 0 &&
+            length >= SHA256_Message_Block_Size) {
+            if (!SHA224_256AddLength(context, 8 * SHA256_Message_Block_Size))
+                SHA224_256Compress(context->Intermediate_Hash, message_array);
+            message_array += SHA256_Message_Block_Size;
+            length -= SHA256_Message_Block_Size;
+            continue;
+        }
+
         context->Message_Block[context->Message_Block_Index++] =
             (*message_array & 0xFF);
 
@@ -250,6 +299,7 @@ int SHA256Input(SHA256Context *context, const uint8_t *message_array,
             SHA224_256ProcessMessageBlock(context);
 
         message_array++;
+        length--;
     }
 
     return shaSuccess;
@@ -441,13 +491,91 @@ static void SHA224_256PadMessage(SHA256Context *context,
 *
 * Returns:
 *   Nothing.
+*/
+static void SHA224_256ProcessMessageBlock(SHA256Context *context)
+{
+    SHA224_256Compress(context->Intermediate_Hash, context->Message_Block);
+    context->Message_Block_Index = 0;
+}
+
+#if defined(SHA256_BACKEND_MBEDTLS)
+
+static void SHA224_256Compress(uint32_t Intermediate_Hash[SHA256HashSize / 4],
+    const uint8_t *block)
+{
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    memcpy(ctx.state, Intermediate_Hash, sizeof(ctx.state));
+    (void)mbedtls_internal_sha256_process(&ctx, block);
+    memcpy(Intermediate_Hash, ctx.state, sizeof(ctx.state));
+    mbedtls_sha256_free(&ctx);
+}
+
+#elif defined(SHA256_BACKEND_ALT)
+
+static void SHA224_256Compress(uint32_t Intermediate_Hash[SHA256HashSize / 4],
+    const uint8_t *block)
+{
+    SHA256ProcessBlockAlt(Intermediate_Hash, block);
+}
+
+#else
+
+/*
+* One round, the eight working variables rotate through the macro
+* arguments instead of being moved. Only 16 words of the message
+* schedule are kept, W[t & 15] is replaced as it is consumed.
+*/
+#define SHA256_ROUND(a, b, c, d, e, f, g, h, t, Wt)           \
+  do {                                                        \
+    temp1 = (h) + SHA256_SIGMA1(e) + SHA_Ch(e, f, g) + K[t] + (Wt); \
+    (d) += temp1;                                             \
+    (h) = temp1 + SHA256_SIGMA0(a) + SHA_Maj(a, b, c);        \
+  } while (0)
+
+#define SHA256_SCHEDULE(t)                                    \
+  (W[(t) & 15] += SHA256_sigma1(W[((t) - 2) & 15]) +          \
+    W[((t) - 7) & 15] + SHA256_sigma0(W[((t) - 15) & 15]))
+
+#define SHA256_ROUNDS_8(t, Wt)                                \
+  do {                                                        \
+    SHA256_ROUND(A, B, C, D, E, F, G, H, (t) + 0, Wt((t) + 0)); \
+    SHA256_ROUND(H, A, B, C, D, E, F, G, (t) + 1, Wt((t) + 1)); \
+    SHA256_ROUND(G, H, A, B, C, D, E, F, (t) + 2, Wt((t) + 2)); \
+    SHA256_ROUND(F, G, H, A, B, C, D, E, (t) + 3, Wt((t) + 3)); \
+    SHA256_ROUND(E, F, G, H, A, B, C, D, (t) + 4, Wt((t) + 4)); \
+    SHA256_ROUND(D, E, F, G, H, A, B, C, (t) + 5, Wt((t) + 5)); \
+    SHA256_ROUND(C, D, E, F, G, H, A, B, (t) + 6, Wt((t) + 6)); \
+    SHA256_ROUND(B, C, D, E, F, G, H, A, (t) + 7, Wt((t) + 7)); \
+  } while (0)
+
+#define SHA256_LOAD(t)  (W[(t)] = SHA256_LOAD_BE(block + 4 * (t)))
+
+/*
+* SHA224_256Compress
+*
+* Description:
+*   This function will compress one 512-bit block into the
+*   intermediate hash. The first 16 rounds read the block, the
+*   other 48 run 16 at a time over the rolling schedule, so every
+*   W[] index is a constant.
+*
+* Parameters:
+*   Intermediate_Hash: [in/out]
+*     The intermediate hash to update
+*   block: [in]
+*     64 octets of message, no alignment required
+*
+* Returns:
+*   Nothing.
 *
 * Comments:
 *   Many of the variable names in this code, especially the
 *   single character names, were used because those were the
 *   names used in the publication.
 */
-static void SHA224_256ProcessMessageBlock(SHA256Context *context)
+static void SHA224_256Compress(uint32_t Intermediate_Hash[SHA256HashSize / 4],
+    const uint8_t *block)
 {
     /* Constants defined in FIPS-180-2, section 4.2.2 */
     static const uint32_t K[64] = {
@@ -465,58 +593,40 @@ static void SHA224_256ProcessMessageBlock(SHA256Context *context)
         0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
         0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
     };
-    int        t, t4;                   /* Loop counter */
-    uint32_t   temp1, temp2;            /* Temporary word value */
-    uint32_t   W[64];                   /* Word sequence */
+    int        t;                       /* Loop counter */
+    uint32_t   temp1;                   /* Temporary word value */
+    uint32_t   W[16];                   /* Rolling word sequence */
     uint32_t   A, B, C, D, E, F, G, H;  /* Word buffers */
 
-    /*
-    * Initialize the first 16 words in the array W
-    */
-    for (t = t4 = 0; t < 16; t++, t4 += 4)
-        W[t] = (((uint32_t)context->Message_Block[t4]) << 24) |
-        (((uint32_t)context->Message_Block[t4 + 1]) << 16) |
-        (((uint32_t)context->Message_Block[t4 + 2]) << 8) |
-        (((uint32_t)context->Message_Block[t4 + 3]));
-
-    for (t = 16; t < 64; t++)
-        W[t] = SHA256_sigma1(W[t - 2]) + W[t - 7] +
-        SHA256_sigma0(W[t - 15]) + W[t - 16];
-
-    A = context->Intermediate_Hash[0];
-    B = context->Intermediate_Hash[1];
-    C = context->Intermediate_Hash[2];
-    D = context->Intermediate_Hash[3];
-    E = context->Intermediate_Hash[4];
-    F = context->Intermediate_Hash[5];
-    G = context->Intermediate_Hash[6];
-    H = context->Intermediate_Hash[7];
-
-    for (t = 0; t < 64; t++) {
-        temp1 = H + SHA256_SIGMA1(E) + SHA_Ch(E, F, G) + K[t] + W[t];
-        temp2 = SHA256_SIGMA0(A) + SHA_Maj(A, B, C);
-        H = G;
-        G = F;
-        F = E;
-        E = D + temp1;
-        D = C;
-        C = B;
-        B = A;
-        A = temp1 + temp2;
+    A = Intermediate_Hash[0];
+    B = Intermediate_Hash[1];
+    C = Intermediate_Hash[2];
+    D = Intermediate_Hash[3];
+    E = Intermediate_Hash[4];
+    F = Intermediate_Hash[5];
+    G = Intermediate_Hash[6];
+    H = Intermediate_Hash[7];
+
+    SHA256_ROUNDS_8(0, SHA256_LOAD);
+    SHA256_ROUNDS_8(8, SHA256_LOAD);
+
+    for (t = 16; t < 64; t += 16) {
+        SHA256_ROUNDS_8(t, SHA256_SCHEDULE);
+        SHA256_ROUNDS_8(t + 8, SHA256_SCHEDULE);
     }
 
-    context->Intermediate_Hash[0] += A;
-    context->Intermediate_Hash[1] += B;
-    context->Intermediate_Hash[2] += C;
-    context->Intermediate_Hash[3] += D;
-    context->Intermediate_Hash[4] += E;
-    context->Intermediate_Hash[5] += F;
-    context->Intermediate_Hash[6] += G;
-    context->Intermediate_Hash[7] += H;
-
-    context->Message_Block_Index = 0;
+    Intermediate_Hash[0] += A;
+    Intermediate_Hash[1] += B;
+    Intermediate_Hash[2] += C;
+    Intermediate_Hash[3] += D;
+    Intermediate_Hash[4] += E;
+    Intermediate_Hash[5] += F;
+    Intermediate_Hash[6] += G;
+    Intermediate_Hash[7] += H;
 }
 
+#endif /* SHA256_BACKEND_MBEDTLS */
+
 /*
 * SHA224_256Reset
 *
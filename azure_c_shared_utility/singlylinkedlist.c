@@ -13,12 +13,58 @@ typedef struct LIST_ITEM_INSTANCE_TAG
     void* next;
 } LIST_ITEM_INSTANCE;
 
+/*every list carries a small pool of nodes, so a list that stays short (a queue of pending sends) adds and removes
+items without going to the heap. Items past the pool size are malloc'd as before. A list is not thread safe, neither
+is its pool, so no locking is needed. Define SINGLYLINKEDLIST_NODE_POOL_SIZE as 0 to malloc every node*/
+#if !defined(SINGLYLINKEDLIST_NODE_POOL_SIZE)
+#define SINGLYLINKEDLIST_NODE_POOL_SIZE 8
+#endif
+
 typedef struct SINGLYLINKEDLIST_INSTANCE_TAG
 {
     LIST_ITEM_INSTANCE* head;
     LIST_ITEM_INSTANCE* tail;
+#if SINGLYLINKEDLIST_NODE_POOL_SIZE > 0
+    LIST_ITEM_INSTANCE* free_nodes;
+    LIST_ITEM_INSTANCE node_pool[SINGLYLINKEDLIST_NODE_POOL_SIZE];
+#endif
 } LIST_INSTANCE;
 
+static LIST_ITEM_INSTANCE* allocate_node(LIST_INSTANCE* list_instance)
+{
+    LIST_ITEM_INSTANCE* result;
+#if SINGLYLINKEDLIST_NODE_POOL_SIZE > 0
+    if (list_instance->free_nodes != NULL)
+    {
+        result = list_instance->free_nodes;
+        list_instance->free_nodes = (LIST_ITEM_INSTANCE*)result->next;
+    }
+    else
+#endif
+    {
+        (void)list_instance;
+        result = (LIST_ITEM_INSTANCE*)malloc(sizeof(LIST_ITEM_INSTANCE));
+    }
+    return result;
+}
+
+static void release_node(LIST_INSTANCE* list_instance, LIST_ITEM_INSTANCE* node)
+{
+#if SINGLYLINKEDLIST_NODE_POOL_SIZE > 0
+    if ((node >= list_instance->node_pool) &&
+        (node < list_instance->node_pool + SINGLYLINKEDLIST_NODE_POOL_SIZE))
+    {
+        node->next = list_instance->free_nodes;
+        list_instance->free_nodes = node;
+    }
+    else
+#endif
+    {
+        (void)list_instance;
+        free(node);
+    }
+}
+
 SINGLYLINKEDLIST_HANDLE singlylinkedlist_create(void)
 {
     LIST_INSTANCE* result;
@@ -30,6 +76,17 @@ SINGLYLINKEDLIST_HANDLE singlylinkedlist_create(void)
         /* Codes_SRS_LIST_01_002: [If any error occurs during the list creation, singlylinkedlist_create shall return NULL.] */
         result->head = NULL;
         result->tail = NULL;
+#if SINGLYLINKEDLIST_NODE_POOL_SIZE > 0
+        {
+            size_t i;
+            result->free_nodes = NULL;
+            for (i = 0; i < SINGLYLINKEDLIST_NODE_POOL_SIZE; i++)
+            {
+                result->node_pool[i].next = result->free_nodes;
+                result->free_nodes = &result->node_pool[i];
+            }
+        }
+#endif
     }
 
     return result;
@@ -46,7 +103,7 @@ void singlylinkedlist_destroy(SINGLYLINKEDLIST_HANDLE list)
         {
             LIST_ITEM_INSTANCE* current_item = list_instance->head;
             list_instance->head = (LIST_ITEM_INSTANCE*)current_item->next;
-            free(current_item);
+            release_node(list_instance, current_item);
         }
 
         /* Codes_SRS_LIST_01_003: [singlylinkedlist_destroy shall free all resources associated with the list identified by the handle argument.] */
@@ -68,7 +125,7 @@ LIST_ITEM_HANDLE singlylinkedlist_add(SINGLYLINKEDLIST_HANDLE list, const void*
     else
     {
         LIST_INSTANCE* list_instance = (LIST_INSTANCE*)list;
-        result = (LIST_ITEM_INSTANCE*)malloc(sizeof(LIST_ITEM_INSTANCE));
+        result = allocate_node(list_instance);
 
         if (result == NULL)
         {
@@ -132,7 +189,7 @@ int singlylinkedlist_remove(SINGLYLINKEDLIST_HANDLE list, LIST_ITEM_HANDLE item)
                     list_instance->tail = previous_item;
                 }
 
-                free(current_item);
+                release_node(list_instance, current_item);
 
                 break;
             }
@@ -303,7 +360,7 @@ int singlylinkedlist_remove_if(SINGLYLINKEDLIST_HANDLE list, LIST_CONDITION_FUNC
                     list_instance->tail = previous_item;
                 }
 
-                free(current_item);
+                release_node(list_instance, current_item);
             }
             /* Codes_SRS_LIST_09_005: [ If the condition function returns false, singlylinkedlist_find shall consider that item as not to be removed. ] */
             else
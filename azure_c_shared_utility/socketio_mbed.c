@@ -3,17 +3,40 @@
 
 #include <stdlib.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 #include "azure_c_shared_utility/socketio.h"
 #include "azure_c_shared_utility/singlylinkedlist.h"
 #include "azure_c_shared_utility/tcpsocketconnection_c.h"
+#include "azure_c_shared_utility/condition.h"
+#include "azure_c_shared_utility/shared_util_options.h"
 #include "azure_c_shared_utility/optimize_size.h"
 #include "azure_c_shared_utility/xlogging.h"
 
 #define UNABLE_TO_COMPLETE -2
 #define MBED_RECEIVE_BYTES_VALUE    128
 
+/*pending sends are taken from a slab of descriptors kept in the socket instance, payloads up to
+SOCKETIO_PENDING_IO_INLINE_SIZE bytes are copied inside the descriptor. Only sends past the slab or
+larger payloads go to the heap*/
+#if !defined(SOCKETIO_PENDING_IO_SLAB_SIZE)
+#define SOCKETIO_PENDING_IO_SLAB_SIZE       4
+#endif
+#if !defined(SOCKETIO_PENDING_IO_INLINE_SIZE)
+#define SOCKETIO_PENDING_IO_INLINE_SIZE     64
+#endif
+#if (SOCKETIO_PENDING_IO_SLAB_SIZE < 1) || (SOCKETIO_PENDING_IO_SLAB_SIZE > 32)
+#error SOCKETIO_PENDING_IO_SLAB_SIZE must be between 1 and 32
+#endif
+
+/*socketio_dowork receives straight into the instance's buffer and hands on_bytes_received a view of it,
+the view is only valid during the callback. At most SOCKETIO_MAX_RECEIVE_PER_DOWORK bytes are delivered
+per call, what is left stays in the socket (and the peer is held back by the TCP window) until the next one*/
+#if !defined(SOCKETIO_MAX_RECEIVE_PER_DOWORK)
+#define SOCKETIO_MAX_RECEIVE_PER_DOWORK     (8 * MBED_RECEIVE_BYTES_VALUE)
+#endif
+
 typedef enum IO_STATE_TAG
 {
     IO_STATE_CLOSED,
@@ -30,6 +53,7 @@ typedef struct PENDING_SOCKET_IO_TAG
     ON_SEND_COMPLETE on_send_complete;
     void* callback_context;
     SINGLYLINKEDLIST_HANDLE pending_io_list;
+    unsigned char inline_bytes[SOCKETIO_PENDING_IO_INLINE_SIZE];
 } PENDING_SOCKET_IO;
 
 typedef struct SOCKET_IO_INSTANCE_TAG
@@ -43,6 +67,10 @@ typedef struct SOCKET_IO_INSTANCE_TAG
     int port;
     IO_STATE io_state;
     SINGLYLINKEDLIST_HANDLE pending_io_list;
+    PENDING_SOCKET_IO pending_io_slab[SOCKETIO_PENDING_IO_SLAB_SIZE];
+    uint32_t pending_io_slab_used; /*bit i set when pending_io_slab[i] is in use*/
+    unsigned char receive_buffer[MBED_RECEIVE_BYTES_VALUE];
+    COND_HANDLE receive_signal; /*posted when the socket has data to receive, owned by whoever set OPTION_RECEIVE_SIGNAL*/
 } SOCKET_IO_INSTANCE;
 
 /*this function will clone an option given by name and value*/
@@ -86,6 +114,13 @@ static const IO_INTERFACE_DESCRIPTION socket_io_interface_description =
     socketio_setoption
 };
 
+/*called from the socket's sigio, possibly in interrupt context*/
+static void on_receive_ready(void* context)
+{
+    SOCKET_IO_INSTANCE* socket_io_instance = (SOCKET_IO_INSTANCE*)context;
+    (void)Condition_Post(socket_io_instance->receive_signal);
+}
+
 static void indicate_error(SOCKET_IO_INSTANCE* socket_io_instance)
 {
     if (socket_io_instance->on_io_error != NULL)
@@ -94,20 +129,71 @@ static void indicate_error(SOCKET_IO_INSTANCE* socket_io_instance)
     }
 }
 
+static PENDING_SOCKET_IO* allocate_pending_io(SOCKET_IO_INSTANCE* socket_io_instance, size_t size)
+{
+    PENDING_SOCKET_IO* result = NULL;
+    size_t i;
+    for (i = 0; i < SOCKETIO_PENDING_IO_SLAB_SIZE; i++)
+    {
+        if ((socket_io_instance->pending_io_slab_used & ((uint32_t)1 << i)) == 0)
+        {
+            socket_io_instance->pending_io_slab_used |= ((uint32_t)1 << i);
+            result = &socket_io_instance->pending_io_slab[i];
+            break;
+        }
+    }
+
+    if (result == NULL)
+    {
+        result = (PENDING_SOCKET_IO*)malloc(sizeof(PENDING_SOCKET_IO));
+    }
+
+    if (result != NULL)
+    {
+        if (size <= SOCKETIO_PENDING_IO_INLINE_SIZE)
+        {
+            result->bytes = result->inline_bytes;
+        }
+        else
+        {
+            result->bytes = (unsigned char*)malloc(size);
+        }
+    }
+    return result;
+}
+
+static void free_pending_io(SOCKET_IO_INSTANCE* socket_io_instance, PENDING_SOCKET_IO* pending_socket_io)
+{
+    if ((pending_socket_io->bytes != NULL) &&
+        (pending_socket_io->bytes != pending_socket_io->inline_bytes))
+    {
+        free(pending_socket_io->bytes);
+    }
+
+    if ((pending_socket_io >= socket_io_instance->pending_io_slab) &&
+        (pending_socket_io < socket_io_instance->pending_io_slab + SOCKETIO_PENDING_IO_SLAB_SIZE))
+    {
+        socket_io_instance->pending_io_slab_used &= ~((uint32_t)1 << (pending_socket_io - socket_io_instance->pending_io_slab));
+    }
+    else
+    {
+        free(pending_socket_io);
+    }
+}
+
 static int add_pending_io(SOCKET_IO_INSTANCE* socket_io_instance, const unsigned char* buffer, size_t size, ON_SEND_COMPLETE on_send_complete, void* callback_context)
 {
     int result;
-    PENDING_SOCKET_IO* pending_socket_io = (PENDING_SOCKET_IO*)malloc(sizeof(PENDING_SOCKET_IO));
+    PENDING_SOCKET_IO* pending_socket_io = allocate_pending_io(socket_io_instance, size);
     if (pending_socket_io == NULL)
     {
         result = __FAILURE__;
     }
     else
     {
-        pending_socket_io->bytes = (unsigned char*)malloc(size);
         if (pending_socket_io->bytes == NULL)
         {
-            free(pending_socket_io);
+            free_pending_io(socket_io_instance, pending_socket_io);
             result = __FAILURE__;
         }
         else
@@ -120,8 +206,7 @@ static int add_pending_io(SOCKET_IO_INSTANCE* socket_io_instance, const unsigned
 
             if (singlylinkedlist_add(socket_io_instance->pending_io_list, pending_socket_io) == NULL)
             {
-                free(pending_socket_io->bytes);
-                free(pending_socket_io);
+                free_pending_io(socket_io_instance, pending_socket_io);
                 result = __FAILURE__;
             }
             else
@@ -173,6 +258,8 @@ CONCRETE_IO_HANDLE socketio_create(void* io_create_parameters)
                     result->on_io_error_context = NULL;
                     result->io_state = IO_STATE_CLOSED;
                     result->tcp_socket_connection = NULL;
+                    result->pending_io_slab_used = 0;
+                    result->receive_signal = NULL;
                 }
             }
         }
@@ -187,6 +274,10 @@ void socketio_destroy(CONCRETE_IO_HANDLE socket_io)
     {
         SOCKET_IO_INSTANCE* socket_io_instance = (SOCKET_IO_INSTANCE*)socket_io;
 
+        if (socket_io_instance->tcp_socket_connection != NULL)
+        {
+            tcpsocketconnection_set_receive_callback(socket_io_instance->tcp_socket_connection, NULL, NULL);
+        }
         tcpsocketconnection_destroy(socket_io_instance->tcp_socket_connection);
 
         /* clear all pending IOs */
@@ -196,8 +287,7 @@ void socketio_destroy(CONCRETE_IO_HANDLE socket_io)
             PENDING_SOCKET_IO* pending_socket_io = (PENDING_SOCKET_IO*)singlylinkedlist_item_get_value(first_pending_io);
             if (pending_socket_io != NULL)
             {
-                free(pending_socket_io->bytes);
-                free(pending_socket_io);
+                free_pending_io(socket_io_instance, pending_socket_io);
             }
 
             (void)singlylinkedlist_remove(socket_io_instance->pending_io_list, first_pending_io);
@@ -237,6 +327,10 @@ int socketio_open(CONCRETE_IO_HANDLE socket_io, ON_IO_OPEN_COMPLETE on_io_open_c
             else
             {
                 tcpsocketconnection_set_blocking(socket_io_instance->tcp_socket_connection, false, 0);
+                if (socket_io_instance->receive_signal != NULL)
+                {
+                    tcpsocketconnection_set_receive_callback(socket_io_instance->tcp_socket_connection, on_receive_ready, socket_io_instance);
+                }
 
                 socket_io_instance->on_bytes_received = on_bytes_received;
                 socket_io_instance->on_bytes_received_context = on_bytes_received_context;
@@ -278,7 +372,9 @@ int socketio_close(CONCRETE_IO_HANDLE socket_io, ON_IO_CLOSE_COMPLETE on_io_clos
         }
         else
         {
+            tcpsocketconnection_set_receive_callback(socket_io_instance->tcp_socket_connection, NULL, NULL);
             tcpsocketconnection_close(socket_io_instance->tcp_socket_connection);
+            tcpsocketconnection_destroy(socket_io_instance->tcp_socket_connection);
             socket_io_instance->tcp_socket_connection = NULL;
             socket_io_instance->io_state = IO_STATE_CLOSED;
 
@@ -399,6 +495,7 @@ void socketio_dowork(CONCRETE_IO_HANDLE socket_io)
                     {
                         /* send something, wait for the rest */
                         (void)memmove(pending_socket_io->bytes, pending_socket_io->bytes + send_result, pending_socket_io->size - send_result);
+                        pending_socket_io->size -= send_result;
                     }
                 }
                 else
@@ -408,8 +505,7 @@ void socketio_dowork(CONCRETE_IO_HANDLE socket_io)
                         pending_socket_io->on_send_complete(pending_socket_io->callback_context, IO_SEND_OK);
                     }
 
-                    free(pending_socket_io->bytes);
-                    free(pending_socket_io);
+                    free_pending_io(socket_io_instance, pending_socket_io);
                     if (singlylinkedlist_remove(socket_io_instance->pending_io_list, first_pending_io) != 0)
                     {
                         socket_io_instance->io_state = IO_STATE_ERROR;
@@ -420,26 +516,20 @@ void socketio_dowork(CONCRETE_IO_HANDLE socket_io)
                 first_pending_io = singlylinkedlist_get_head_item(socket_io_instance->pending_io_list);
             }
 
-            while (received > 0)
+            size_t received_total = 0;
+            /* the callback may close the socket, the state is checked again after each delivery */
+            while ((received > 0) &&
+                (received_total < SOCKETIO_MAX_RECEIVE_PER_DOWORK) &&
+                (socket_io_instance->io_state == IO_STATE_OPEN))
             {
-                unsigned char* recv_bytes = malloc(MBED_RECEIVE_BYTES_VALUE);
-                if (recv_bytes == NULL)
+                received = tcpsocketconnection_receive(socket_io_instance->tcp_socket_connection, (char*)socket_io_instance->receive_buffer, MBED_RECEIVE_BYTES_VALUE);
+                if (received > 0)
                 {
-                    LogError("Socketio_Failure: NULL allocating input buffer.");
-                    indicate_error(socket_io_instance);
-                }
-                else
-                {
-                    received = tcpsocketconnection_receive(socket_io_instance->tcp_socket_connection, (char*)recv_bytes, MBED_RECEIVE_BYTES_VALUE);
-                    if (received > 0)
+                    received_total += received;
+                    if (socket_io_instance->on_bytes_received != NULL)
                     {
-                        if (socket_io_instance->on_bytes_received != NULL)
-                        {
-                            /* explictly ignoring here the result of the callback */
-                            (void)socket_io_instance->on_bytes_received(socket_io_instance->on_bytes_received_context, recv_bytes, received);
-                        }
+                        socket_io_instance->on_bytes_received(socket_io_instance->on_bytes_received_context, socket_io_instance->receive_buffer, received);
                     }
-                    free(recv_bytes);
                 }
             }
         }
@@ -448,8 +538,31 @@ void socketio_dowork(CONCRETE_IO_HANDLE socket_io)
 
 int socketio_setoption(CONCRETE_IO_HANDLE socket_io, const char* optionName, const void* value)
 {
-    /* Not implementing any options */
-    return __FAILURE__;
+    int result;
+
+    if ((socket_io == NULL) || (optionName == NULL))
+    {
+        result = __FAILURE__;
+    }
+    else if (strcmp(OPTION_RECEIVE_SIGNAL, optionName) == 0)
+    {
+        /* value is a COND_HANDLE posted whenever the socket has data to receive, NULL stops the signal.
+        The caller keeps it alive until the option is reset or the io is destroyed */
+        SOCKET_IO_INSTANCE* socket_io_instance = (SOCKET_IO_INSTANCE*)socket_io;
+        socket_io_instance->receive_signal = (COND_HANDLE)value;
+        if (socket_io_instance->tcp_socket_connection != NULL)
+        {
+            tcpsocketconnection_set_receive_callback(socket_io_instance->tcp_socket_connection,
+                (value == NULL) ? NULL : on_receive_ready, (value == NULL) ? NULL : socket_io_instance);
+        }
+        result = 0;
+    }
+    else
+    {
+        result = __FAILURE__;
+    }
+
+    return result;
 }
 
 const IO_INTERFACE_DESCRIPTION* socketio_get_interface_description(void)
@@ -21,11 +21,78 @@
 
 static const char hexToASCII[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
 
+#if !defined(STRING_MIN_CAPACITY)
+#define STRING_MIN_CAPACITY 16
+#endif
+
+/*length is the number of characters before the '\0', capacity the number of bytes allocated for s*/
 typedef struct STRING_TAG
 {
     char* s;
+    size_t length;
+    size_t capacity;
 } STRING;
 
+/*makes room for length characters plus the '\0'. The buffer grows by half of its size at least, so
+  a string built by appending is only reallocated a logarithmic number of times*/
+static int STRING_grow(STRING* str, size_t length)
+{
+    int result;
+    if (length < str->capacity)
+    {
+        result = 0;
+    }
+    else
+    {
+        size_t newCapacity = str->capacity + str->capacity / 2;
+        char* temp;
+        if (newCapacity < length + 1)
+        {
+            newCapacity = length + 1;
+        }
+        if (newCapacity < STRING_MIN_CAPACITY)
+        {
+            newCapacity = STRING_MIN_CAPACITY;
+        }
+        temp = (char*)realloc(str->s, newCapacity);
+        if (temp == NULL)
+        {
+            /*a minimal size increase is tried before giving up*/
+            newCapacity = length + 1;
+            temp = (char*)realloc(str->s, newCapacity);
+        }
+        if (temp == NULL)
+        {
+            result = __FAILURE__;
+        }
+        else
+        {
+            str->s = temp;
+            str->capacity = newCapacity;
+            result = 0;
+        }
+    }
+    return result;
+}
+
+/*appends n characters, s2 must not point into str*/
+static int STRING_append(STRING* str, const char* s2, size_t n)
+{
+    int result;
+    if (STRING_grow(str, str->length + n) != 0)
+    {
+        result = __FAILURE__;
+    }
+    else
+    {
+        (void)memcpy(str->s + str->length, s2, n);
+        str->length += n;
+        str->s[str->length] = '\0';
+        result = 0;
+    }
+    return result;
+}
+
 /*this function will allocate a new string with just '\0' in it*/
 /*return NULL if it fails*/
 /* Codes_SRS_STRING_07_001: [STRING_new shall allocate a new STRING_HANDLE pointing to an empty string.] */
@@ -37,6 +104,8 @@ STRING_HANDLE STRING_new(void)
         if ((result->s = (char*)malloc(1)) != NULL)
         {
             result->s[0] = '\0';
+            result->length = 0;
+            result->capacity = 1;
         }
         else
         {
@@ -64,7 +133,7 @@ STRING_HANDLE STRING_clone(STRING_HANDLE handle)
         {
             STRING* source = (STRING*)handle;
             /*Codes_SRS_STRING_02_003: [If STRING_clone fails for any reason, it shall return NULL.] */
-            size_t sourceLen = strlen(source->s);
+            size_t sourceLen = source->length;
             if ((result->s = (char*)malloc(sourceLen + 1)) == NULL)
             {
                 free(result);
@@ -73,6 +142,8 @@ STRING_HANDLE STRING_clone(STRING_HANDLE handle)
             else
             {
                 (void)memcpy(result->s, source->s, sourceLen + 1);
+                result->length = sourceLen;
+                result->capacity = sourceLen + 1;
             }
         }
         else
@@ -101,6 +172,8 @@ STRING_HANDLE STRING_construct(const char* psz)
             if ((str->s = (char*)malloc(nLen)) != NULL)
             {
                 (void)memcpy(str->s, psz, nLen);
+                str->length = nLen - 1;
+                str->capacity = nLen;
                 result = (STRING_HANDLE)str;
             }
             /* Codes_SRS_STRING_07_032: [STRING_construct encounters any error it shall return a NULL value.] */
@@ -160,6 +233,11 @@ STRING_HANDLE STRING_construct_sprintf(const char* format, ...)
                         result = NULL;
                         LogError("Failure: vsnprintf formatting failed.");
                     }
+                    else
+                    {
+                        result->length = length;
+                        result->capacity = length + 1;
+                    }
                     va_end(arg_list);
                 }
                 else
@@ -212,6 +290,8 @@ STRING_HANDLE STRING_new_with_memory(const char* memory)
         if ((result = (STRING*)malloc(sizeof(STRING))) != NULL)
         {
             result->s = (char*)memory;
+            result->length = strlen(memory);
+            result->capacity = result->length + 1;
         }
     }
     return (STRING_HANDLE)result;
@@ -235,6 +315,8 @@ STRING_HANDLE STRING_new_quoted(const char* source)
             (void)memcpy(result->s + 1, source, sourceLength);
             result->s[sourceLength + 1] = '"';
             result->s[sourceLength + 2] = '\0';
+            result->length = sourceLength + 2;
+            result->capacity = sourceLength + 3;
         }
         else
         {
@@ -353,6 +435,8 @@ STRING_HANDLE STRING_new_JSON(const char* source)
                 result->s[pos++] = '"';
                 /*zero terminating it*/
                 result->s[pos] = '\0';
+                result->length = pos;
+                result->capacity = vlen + 5 * nControlCharacters + nEscapeCharacters + 3;
             }
         }
 
@@ -375,18 +459,31 @@ int STRING_concat(STRING_HANDLE handle, const char* s2)
     else
     {
         STRING* s1 = (STRING*)handle;
-        size_t s1Length = strlen(s1->s);
         size_t s2Length = strlen(s2);
-        char* temp = (char*)realloc(s1->s, s1Length + s2Length + 1);
-        if (temp == NULL)
+        if ((s2 >= s1->s) && (s2 < s1->s + s1->capacity))
+        {
+            /*s2 is a part of s1, its offset survives the buffer moving*/
+            size_t offset = s2 - s1->s;
+            if (STRING_grow(s1, s1->length + s2Length) != 0)
+            {
+                /* Codes_SRS_STRING_07_013: [STRING_concat shall return a nonzero number if an error is encountered.] */
+                result = __FAILURE__;
+            }
+            else
+            {
+                (void)memmove(s1->s + s1->length, s1->s + offset, s2Length);
+                s1->length += s2Length;
+                s1->s[s1->length] = '\0';
+                result = 0;
+            }
+        }
+        else if (STRING_append(s1, s2, s2Length) != 0)
         {
             /* Codes_SRS_STRING_07_013: [STRING_concat shall return a nonzero number if an error is encountered.] */
             result = __FAILURE__;
         }
         else
         {
-            s1->s = temp;
-            (void)memcpy(s1->s + s1Length, s2, s2Length + 1);
             result = 0;
         }
     }
@@ -410,19 +507,19 @@ int STRING_concat_with_STRING(STRING_HANDLE s1, STRING_HANDLE s2)
         STRING* dest = (STRING*)s1;
         STRING* src = (STRING*)s2;
 
-        size_t s1Length = strlen(dest->s);
-        size_t s2Length = strlen(src->s);
-        char* temp = (char*)realloc(dest->s, s1Length + s2Length + 1);
-        if (temp == NULL)
+        size_t s2Length = src->length;
+        if (STRING_grow(dest, dest->length + s2Length) != 0)
         {
             /* Codes_SRS_STRING_07_035: [String_Concat_with_STRING shall return a nonzero number if an error is encountered.] */
             result = __FAILURE__;
         }
         else
         {
-            dest->s = temp;
             /* Codes_SRS_STRING_07_034: [String_Concat_with_STRING shall concatenate a given STRING_HANDLE variable with a source STRING_HANDLE.] */
-            (void)memcpy(dest->s + s1Length, src->s, s2Length + 1);
+            /*src->s is read after growing, dest and src may be the same STRING*/
+            (void)memcpy(dest->s + dest->length, src->s, s2Length);
+            dest->length += s2Length;
+            dest->s[dest->length] = '\0';
             result = 0;
         }
     }
@@ -448,16 +545,16 @@ int STRING_copy(STRING_HANDLE handle, const char* s2)
         if (s1->s != s2)
         {
             size_t s2Length = strlen(s2);
-            char* temp = (char*)realloc(s1->s, s2Length + 1);
-            if (temp == NULL)
+            /*the buffer only moves when s2 does not fit, s2 cannot be a part of it then*/
+            if (STRING_grow(s1, s2Length) != 0)
             {
                 /* Codes_SRS_STRING_07_027: [STRING_copy shall return a nonzero value if any error is encountered.] */
                 result = __FAILURE__;
             }
             else
             {
-                s1->s = temp;
                 memmove(s1->s, s2, s2Length + 1);
+                s1->length = s2Length;
                 result = 0;
             }
         }
@@ -486,23 +583,21 @@ int STRING_copy_n(STRING_HANDLE handle, const char* s2, size_t n)
     {
         STRING* s1 = (STRING*)handle;
         size_t s2Length = strlen(s2);
-        char* temp;
         if (s2Length > n)
         {
             s2Length = n;
         }
 
-        temp = (char*)realloc(s1->s, s2Length + 1);
-        if (temp == NULL)
+        if (STRING_grow(s1, s2Length) != 0)
         {
             /* Codes_SRS_STRING_07_028: [STRING_copy_n shall return a nonzero value if any error is encountered.] */
             result = __FAILURE__;
         }
         else
         {
-            s1->s = temp;
-            (void)memcpy(s1->s, s2, s2Length);
+            (void)memmove(s1->s, s2, s2Length);
             s1->s[s2Length] = 0;
+            s1->length = s2Length;
             result = 0;
         }
 
@@ -553,14 +648,11 @@ int STRING_sprintf(STRING_HANDLE handle, const char* format, ...)
         else
         {
             STRING* s1 = (STRING*)handle;
-            char* temp;
-            size_t s1Length = strlen(s1->s);
-            temp = (char*)realloc(s1->s, s1Length + s2Length + 1);
-            if (temp != NULL)
+            size_t s1Length = s1->length;
+            if (STRING_grow(s1, s1Length + s2Length) == 0)
             {
-                s1->s = temp;
                 va_start(arg_list, format);
-                if (vsnprintf(s1->s + s1Length, s1Length + s2Length + 1, format, arg_list) < 0)
+                if (vsnprintf(s1->s + s1Length, s2Length + 1, format, arg_list) < 0)
                 {
                     /* Codes_SRS_STRING_07_043: [If any error is encountered STRING_sprintf shall return a non zero value.] */
                     LogError("Failure vsnprintf formatting error");
@@ -570,6 +662,7 @@ int STRING_sprintf(STRING_HANDLE handle, const char* format, ...)
                 else
                 {
                     /* Codes_SRS_STRING_07_044: [On success STRING_sprintf shall return 0.]*/
+                    s1->length = s1Length + s2Length;
                     result = 0;
                 }
                 va_end(arg_list);
@@ -600,20 +693,19 @@ int STRING_quote(STRING_HANDLE handle)
     else
     {
         STRING* s1 = (STRING*)handle;
-        size_t s1Length = strlen(s1->s);
-        char* temp = (char*)realloc(s1->s, s1Length + 2 + 1);/*2 because 2 quotes, 1 because '\0'*/
-        if (temp == NULL)
+        size_t s1Length = s1->length;
+        if (STRING_grow(s1, s1Length + 2) != 0)/*2 because 2 quotes*/
         {
             /* Codes_SRS_STRING_07_029: [STRING_quote shall return a nonzero value if any error is encountered.] */
             result = __FAILURE__;
         }
         else
         {
-            s1->s = temp;
             memmove(s1->s + 1, s1->s, s1Length);
             s1->s[0] = '"';
             s1->s[s1Length + 1] = '"';
             s1->s[s1Length + 2] = '\0';
+            s1->length = s1Length + 2;
             result = 0;
         }
     }
@@ -632,19 +724,11 @@ int STRING_empty(STRING_HANDLE handle)
     }
     else
     {
+        /*the buffer is kept for the next use of the string*/
         STRING* s1 = (STRING*)handle;
-        char* temp = (char*)realloc(s1->s, 1);
-        if (temp == NULL)
-        {
-            /* Codes_SRS_STRING_07_030: [STRING_empty shall return a nonzero value if the STRING_HANDLE is NULL.] */
-            result = __FAILURE__;
-        }
-        else
-        {
-            s1->s = temp;
-            s1->s[0] = '\0';
-            result = 0;
-        }
+        s1->s[0] = '\0';
+        s1->length = 0;
+        result = 0;
     }
     return result;
 }
@@ -687,7 +771,7 @@ size_t STRING_length(STRING_HANDLE handle)
     if (handle != NULL)
     {
         STRING* value = (STRING*)handle;
-        result = strlen(value->s);
+        result = value->length;
     }
     return result;
 }
@@ -716,10 +800,12 @@ STRING_HANDLE STRING_construct_n(const char* psz, size_t n)
             STRING* str;
             if ((str = (STRING*)malloc(sizeof(STRING))) != NULL)
             {
-                if ((str->s = (char*)malloc(len + 1)) != NULL)
+                if ((str->s = (char*)malloc(n + 1)) != NULL)
                 {
                     (void)memcpy(str->s, psz, n);
                     str->s[n] = '\0';
+                    str->length = n;
+                    str->capacity = n + 1;
                     result = (STRING_HANDLE)str;
                 }
                 /* Codes_SRS_STRING_02_010: [In all other error cases, STRING_construct_n shall return NULL.]  */
@@ -802,6 +888,9 @@ STRING_HANDLE STRING_from_byte_array(const unsigned char* source, size_t size)
             {
                 (void)memcpy(result->s, source, size);
                 result->s[size] = '\0'; /*all is fine*/
+                /*the length stops at the first '\0', as with strlen, when source has some*/
+                result->length = strlen(result->s);
+                result->capacity = size + 1;
             }
         }
     }
@@ -827,7 +916,7 @@ int STRING_replace(STRING_HANDLE handle, char target, char replace)
         size_t index;
         /* Codes_SRS_STRING_07_047: [ STRING_replace shall replace all instances of target with replace. ] */
         STRING* str_value = (STRING*)handle;
-        length = strlen(str_value->s);
+        length = str_value->length;
         for (index = 0; index < length; index++)
         {
             if (str_value->s[index] == target)
@@ -835,8 +924,198 @@ int STRING_replace(STRING_HANDLE handle, char target, char replace)
                 str_value->s[index] = replace;
             }
         }
+        if (replace == '\0')
+        {
+            str_value->length = strlen(str_value->s);
+        }
         /* Codes_SRS_STRING_07_049: [ On success STRING_replace shall return zero. ] */
         result = 0;
     }
     return result;
 }
+
+/*a STRING_BUILDER is a STRING that is only appended to, STRING_BUILDER_finish hands the very same
+  object over as a STRING_HANDLE*/
+STRING_BUILDER_HANDLE STRING_BUILDER_create(size_t capacity)
+{
+    STRING* result;
+    if ((result = (STRING*)malloc(sizeof(STRING))) == NULL)
+    {
+        LogError("oom - unable to malloc");
+    }
+    else if ((result->s = (char*)malloc(capacity + 1)) == NULL)
+    {
+        LogError("oom - unable to malloc");
+        free(result);
+        result = NULL;
+    }
+    else
+    {
+        result->s[0] = '\0';
+        result->length = 0;
+        result->capacity = capacity + 1;
+    }
+    return (STRING_BUILDER_HANDLE)result;
+}
+
+void STRING_BUILDER_destroy(STRING_BUILDER_HANDLE builder)
+{
+    STRING_delete((STRING_HANDLE)builder);
+}
+
+int STRING_BUILDER_reserve(STRING_BUILDER_HANDLE builder, size_t capacity)
+{
+    int result;
+    if (builder == NULL)
+    {
+        LogError("invalid arg (NULL)");
+        result = __FAILURE__;
+    }
+    else
+    {
+        STRING* str = (STRING*)builder;
+        if (capacity < str->capacity)
+        {
+            result = 0;
+        }
+        else
+        {
+            /*exact size, the caller knows what is coming*/
+            char* temp = (char*)realloc(str->s, capacity + 1);
+            if (temp == NULL)
+            {
+                LogError("oom - unable to realloc");
+                result = __FAILURE__;
+            }
+            else
+            {
+                str->s = temp;
+                str->capacity = capacity + 1;
+                result = 0;
+            }
+        }
+    }
+    return result;
+}
+
+int STRING_BUILDER_append(STRING_BUILDER_HANDLE builder, const char* s)
+{
+    int result;
+    if ((builder == NULL) || (s == NULL))
+    {
+        LogError("invalid arg (NULL)");
+        result = __FAILURE__;
+    }
+    else
+    {
+        result = STRING_append((STRING*)builder, s, strlen(s));
+    }
+    return result;
+}
+
+int STRING_BUILDER_append_n(STRING_BUILDER_HANDLE builder, const char* s, size_t n)
+{
+    int result;
+    if ((builder == NULL) || ((s == NULL) && (n > 0)))
+    {
+        LogError("invalid arg (NULL)");
+        result = __FAILURE__;
+    }
+    else
+    {
+        result = STRING_append((STRING*)builder, s, n);
+    }
+    return result;
+}
+
+int STRING_BUILDER_append_char(STRING_BUILDER_HANDLE builder, char c)
+{
+    int result;
+    if (builder == NULL)
+    {
+        LogError("invalid arg (NULL)");
+        result = __FAILURE__;
+    }
+    else
+    {
+        STRING* str = (STRING*)builder;
+        if (STRING_grow(str, str->length + 1) != 0)
+        {
+            result = __FAILURE__;
+        }
+        else
+        {
+            str->s[str->length++] = c;
+            str->s[str->length] = '\0';
+            result = 0;
+        }
+    }
+    return result;
+}
+
+#if defined(__GNUC__)
+__attribute__ ((format (printf, 2, 3)))
+#endif
+int STRING_BUILDER_format(STRING_BUILDER_HANDLE builder, const char* format, ...)
+{
+    int result;
+    if ((builder == NULL) || (format == NULL))
+    {
+        LogError("invalid arg (NULL)");
+        result = __FAILURE__;
+    }
+    else
+    {
+        STRING* str = (STRING*)builder;
+        size_t available = str->capacity - str->length;
+        va_list arg_list;
+        int length;
+
+        /*formatted straight into the spare capacity, a second time only if it did not fit*/
+        va_start(arg_list, format);
+        length = vsnprintf(str->s + str->length, available, format, arg_list);
+        va_end(arg_list);
+        if (length < 0)
+        {
+            LogError("Failure vsnprintf return < 0");
+            str->s[str->length] = '\0';
+            result = __FAILURE__;
+        }
+        else if ((size_t)length < available)
+        {
+            str->length += length;
+            result = 0;
+        }
+        else if (STRING_grow(str, str->length + length) != 0)
+        {
+            LogError("Failure unable to reallocate memory");
+            str->s[str->length] = '\0';
+            result = __FAILURE__;
+        }
+        else
+        {
+            va_start(arg_list, format);
+            (void)vsnprintf(str->s + str->length, length + 1, format, arg_list);
+            va_end(arg_list);
+            str->length += length;
+            result = 0;
+        }
+    }
+    return result;
+}
+
+size_t STRING_BUILDER_length(STRING_BUILDER_HANDLE builder)
+{
+    return STRING_length((STRING_HANDLE)builder);
+}
+
+const char* STRING_BUILDER_c_str(STRING_BUILDER_HANDLE builder)
+{
+    return STRING_c_str((STRING_HANDLE)builder);
+}
+
+/*the builder is consumed, its buffer becomes the STRING without being copied*/
+STRING_HANDLE STRING_BUILDER_finish(STRING_BUILDER_HANDLE builder)
+{
+    return (STRING_HANDLE)builder;
+}
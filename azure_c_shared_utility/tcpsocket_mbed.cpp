@@ -75,10 +75,24 @@ static Timer gettingData_timer;
 
 static int  ioBufCnt = 0;
 
+static void (*on_receive_ready)(void* context) = NULL;
+static void* on_receive_ready_context = NULL;
+
 
 void rxData(void)
 {
     gettingData = false;
+    if( on_receive_ready != NULL )
+        on_receive_ready(on_receive_ready_context);
+}
+
+// on_receive_ready is called from the socket's sigio once data is waiting after a receive
+// returned NSAPI_ERROR_WOULD_BLOCK, it may run in interrupt context.
+void tcpsocketconnection_set_receive_callback(TCPSOCKETCONNECTION_HANDLE tcpSocketHandle, void (*callback)(void* context), void* context)
+{
+    (void)tcpSocketHandle;
+    on_receive_ready = callback;
+    on_receive_ready_context = context;
 }
 
 int tcpsocketconnection_receive(TCPSOCKETCONNECTION_HANDLE tcpSocketHandle, char* data, int length)
@@ -2,6 +2,7 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 #include <stdlib.h>
+#include <stdint.h>
 #include "azure_c_shared_utility/threadapi.h"
 #include "azure_c_shared_utility/xlogging.h"
 #include "rtos.h"
@@ -19,6 +20,48 @@ typedef struct _thread
 } mbedThread;
 static mbedThread threads[MAX_THREADS] = { 0 };
 
+/*submitted tasks run on workers started by the first ThreadAPI_Submit. The worker stacks and the task slots
+are allocated once, a slot holds a task from ThreadAPI_Submit until it ran (or until ThreadAPI_Join when the
+task has a handle)*/
+#if !defined(THREADAPI_POOL_WORKERS)
+#define THREADAPI_POOL_WORKERS 2
+#endif
+#if !defined(THREADAPI_POOL_STACK_SIZE)
+#define THREADAPI_POOL_STACK_SIZE OS_STACK_SIZE
+#endif
+#if !defined(THREADAPI_POOL_QUEUE_LENGTH)
+#define THREADAPI_POOL_QUEUE_LENGTH 8
+#endif
+
+typedef enum _task_state
+{
+    TASK_FREE,
+    TASK_QUEUED,
+    TASK_RUNNING,
+    TASK_DONE
+} task_state;
+
+typedef struct _task
+{
+    THREAD_START_FUNC func;
+    void*      arg;
+    int        result;
+    bool       joinable;
+    task_state state;
+} poolTask;
+static poolTask tasks[THREADAPI_POOL_QUEUE_LENGTH];
+static Semaphore task_done[THREADAPI_POOL_QUEUE_LENGTH];
+
+/*queued slots, oldest first*/
+static size_t task_queue[THREADAPI_POOL_QUEUE_LENGTH];
+static size_t task_queue_head = 0;
+static size_t task_queue_count = 0;
+static Mutex pool_mutex;
+static Semaphore pool_work(0);
+
+static uint64_t worker_stacks[THREADAPI_POOL_WORKERS][(THREADAPI_POOL_STACK_SIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+static Thread* workers[THREADAPI_POOL_WORKERS] = { 0 };
+
 typedef struct _create_param
 {
     THREAD_START_FUNC func;
@@ -80,11 +123,149 @@ THREADAPI_RESULT ThreadAPI_Create(THREAD_HANDLE* threadHandle, THREAD_START_FUNC
     return result;
 }
 
+static void pool_worker(void)
+{
+    while (true)
+    {
+        poolTask* task;
+        (void)pool_work.wait();
+
+        pool_mutex.lock();
+        task = &tasks[task_queue[task_queue_head]];
+        task_queue_head = (task_queue_head + 1) % THREADAPI_POOL_QUEUE_LENGTH;
+        task_queue_count--;
+        task->state = TASK_RUNNING;
+        pool_mutex.unlock();
+
+        int res = (*(task->func))(task->arg);
+
+        pool_mutex.lock();
+        task->result = res;
+        if (task->joinable)
+        {
+            task->state = TASK_DONE;
+            (void)task_done[task - tasks].release();
+        }
+        else
+        {
+            task->state = TASK_FREE;
+        }
+        pool_mutex.unlock();
+    }
+}
+
+/*called with pool_mutex taken*/
+static bool start_workers(void)
+{
+    bool result = true;
+    size_t i;
+    for (i = 0; (i < THREADAPI_POOL_WORKERS) && result; i++)
+    {
+        if (workers[i] == NULL)
+        {
+            workers[i] = new Thread(osPriorityNormal, THREADAPI_POOL_STACK_SIZE, (unsigned char*)worker_stacks[i]);
+            if ((workers[i] == NULL) ||
+                (workers[i]->start(pool_worker) != osOK))
+            {
+                delete workers[i];
+                workers[i] = NULL;
+                result = false;
+            }
+        }
+    }
+    return result;
+}
+
+THREADAPI_RESULT ThreadAPI_Submit(THREAD_HANDLE* taskHandle, THREAD_START_FUNC func, void* arg)
+{
+    THREADAPI_RESULT result;
+    if (func == NULL)
+    {
+        result = THREADAPI_INVALID_ARG;
+        LogError("(result = %s)", ENUM_TO_STRING(THREADAPI_RESULT, result));
+    }
+    else
+    {
+        pool_mutex.lock();
+        size_t slot;
+        for (slot = 0; slot < THREADAPI_POOL_QUEUE_LENGTH; slot++)
+        {
+            if (tasks[slot].state == TASK_FREE)
+                break;
+        }
+
+        if (!start_workers())
+        {
+            result = THREADAPI_ERROR;
+            LogError("(result = %s)", ENUM_TO_STRING(THREADAPI_RESULT, result));
+        }
+        else if (slot == THREADAPI_POOL_QUEUE_LENGTH)
+        {
+            result = THREADAPI_NO_MEMORY;
+            LogError("(result = %s)", ENUM_TO_STRING(THREADAPI_RESULT, result));
+        }
+        else
+        {
+            tasks[slot].func = func;
+            tasks[slot].arg = arg;
+            tasks[slot].joinable = (taskHandle != NULL);
+            tasks[slot].state = TASK_QUEUED;
+            task_queue[(task_queue_head + task_queue_count) % THREADAPI_POOL_QUEUE_LENGTH] = slot;
+            task_queue_count++;
+            if (taskHandle != NULL)
+            {
+                *taskHandle = (THREAD_HANDLE)(tasks + slot);
+            }
+            (void)pool_work.release();
+            result = THREADAPI_OK;
+        }
+        pool_mutex.unlock();
+    }
+
+    return result;
+}
+
+static THREADAPI_RESULT join_task(poolTask* task, int *res)
+{
+    THREADAPI_RESULT result;
+    pool_mutex.lock();
+    bool joinable = task->joinable && (task->state != TASK_FREE);
+    pool_mutex.unlock();
+    if (!joinable)
+    {
+        result = THREADAPI_INVALID_ARG;
+        LogError("(result = %s)", ENUM_TO_STRING(THREADAPI_RESULT, result));
+    }
+    else if (task_done[task - tasks].wait() <= 0)
+    {
+        result = THREADAPI_ERROR;
+        LogError("(result = %s)", ENUM_TO_STRING(THREADAPI_RESULT, result));
+    }
+    else
+    {
+        pool_mutex.lock();
+        if (res)
+        {
+            *res = task->result;
+        }
+        task->joinable = false;
+        task->state = TASK_FREE;
+        pool_mutex.unlock();
+        result = THREADAPI_OK;
+    }
+    return result;
+}
+
 THREADAPI_RESULT ThreadAPI_Join(THREAD_HANDLE thr, int *res)
 {
     THREADAPI_RESULT result = THREADAPI_OK;
     mbedThread* p = (mbedThread*)thr;
-    if (p)
+    if (((poolTask*)thr >= tasks) &&
+        ((poolTask*)thr < tasks + THREADAPI_POOL_QUEUE_LENGTH))
+    {
+        result = join_task((poolTask*)thr, res);
+    }
+    else if (p)
     {
         osEvent evt = p->result.get();
         if (evt.status == osEventMessage) {
@@ -4,94 +4,104 @@
 #include <stdlib.h>
 #include <stddef.h>
 #include <string.h>
+#include <stdint.h>
 #include "azure_c_shared_utility/gballoc.h"
 #include "azure_c_shared_utility/urlencode.h"
 #include "azure_c_shared_utility/xlogging.h"
 #include "azure_c_shared_utility/strings.h"
 
-#define NIBBLE_STR(c) (char)(c < 10 ? c + '0' : c - 10 + 'a')
-#define IS_PRINTABLE(c) (                           \
-    (c == 0) ||                                     \
-    (c == '!') ||                                   \
-    (c == '(') || (c == ')') || (c == '*') ||       \
-    (c == '-') || (c == '.') ||                     \
-    ((c >= '0') && (c <= '9')) ||                   \
-    ((c >= 'A') && (c <= 'Z')) ||                   \
-    (c == '_') ||                                   \
-    ((c >= 'a') && (c <= 'z'))                      \
-)
+/*one bit per byte value, set for the characters copied as they are: ! ( ) * - . 0-9 A-Z _ a-z*/
+static const uint32_t urlSafeChars[256 / 32] =
+{
+    0x00000000,
+    0x03FF6702, /* '!' '(' ')' '*' '-' '.' '0'-'9' */
+    0x87FFFFFE, /* 'A'-'Z' '_' */
+    0x07FFFFFE, /* 'a'-'z' */
+    0x00000000,
+    0x00000000,
+    0x00000000,
+    0x00000000
+};
+
+#define IS_PRINTABLE(c) ((urlSafeChars[(unsigned char)(c) >> 5] >> ((unsigned char)(c) & 31)) & 1)
+
+static const char nibbleChars[16] =
+{
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+};
 
-static size_t URL_PrintableChar(unsigned char charVal, char* buffer)
+/*writes the escape sequence of a byte that is not printable, returns its length*/
+/*bytes from 0x80 up are written as the two byte UTF-8 sequence %c2%xx or %c3%xx*/
+static size_t URL_EscapedChar(unsigned char charVal, char* buffer)
 {
     size_t size;
-    if (IS_PRINTABLE(charVal))
+
+    buffer[0] = '%';
+
+    if (charVal < 0x80)
     {
-        buffer[0] = (char)charVal;
-        size = 1;
+        buffer[1] = nibbleChars[charVal >> 4];
+        buffer[2] = nibbleChars[charVal & 0x0F];
+        size = 3;
     }
     else
     {
-        char bigNibbleStr;
-        char littleNibbleStr;
-        unsigned char bigNibbleVal = charVal >> 4;
-        unsigned char littleNibbleVal = charVal & 0x0F;
-
-        if (bigNibbleVal >= 0x0C)
-        {
-            bigNibbleVal -= 0x04;
-        }
-
-        bigNibbleStr = NIBBLE_STR(bigNibbleVal);
-        littleNibbleStr = NIBBLE_STR(littleNibbleVal);
+        buffer[1] = 'c';
+        buffer[2] = (charVal < 0xC0) ? '2' : '3';
+        buffer[3] = '%';
+        buffer[4] = nibbleChars[(charVal >> 4) & 0x0B];
+        buffer[5] = nibbleChars[charVal & 0x0F];
+        size = 6;
+    }
 
-        buffer[0] = '%';
+    return size;
+}
 
-        if (charVal < 0x80)
+/*length of the encoding of a '\0' terminated text, terminator excluded*/
+static size_t URL_EncodedLength(const char* text)
+{
+    size_t size = 0;
+    const unsigned char* current = (const unsigned char*)text;
+    while (*current != 0)
+    {
+        if (IS_PRINTABLE(*current))
         {
-            buffer[1] = bigNibbleStr;
-            buffer[2] = littleNibbleStr;
-            size = 3;
+            size += 1;
         }
         else
         {
-            buffer[1] = 'c';
-            buffer[3] = '%';
-            buffer[4] = bigNibbleStr;
-            buffer[5] = littleNibbleStr;
-            if (charVal < 0xC0)
-            {
-                buffer[2] = '2';
-            }
-            else
-            {
-                buffer[2] = '3';
-            }
-            size = 6;
+            size += (*current < 0x80) ? 3 : 6;
         }
+        current++;
     }
-
     return size;
 }
 
-static size_t URL_PrintableCharSize(unsigned char charVal)
+/*encodes a '\0' terminated text in one pass, runs of printable characters are copied at once. Returns the length written, terminator included.*/
+static size_t URL_EncodeText(const char* text, char* encoded)
 {
-    size_t size;
-    if (IS_PRINTABLE(charVal))
+    const unsigned char* current = (const unsigned char*)text;
+    char* destination = encoded;
+    while (*current != 0)
     {
-        size = 1;
-    }
-    else
-    {
-        if (charVal < 0x80)
+        const unsigned char* run = current;
+        while (IS_PRINTABLE(*current))
         {
-            size = 3;
+            current++;
         }
-        else
+        if (current != run)
+        {
+            (void)memcpy(destination, run, current - run);
+            destination += current - run;
+        }
+        if (*current != 0)
         {
-            size = 6;
+            destination += URL_EscapedChar(*current, destination);
+            current++;
         }
     }
-    return size;
+    *destination++ = '\0';
+    return (size_t)(destination - encoded);
 }
 
 STRING_HANDLE URL_EncodeString(const char* textEncode)
@@ -128,18 +138,10 @@ STRING_HANDLE URL_Encode(STRING_HANDLE input)
     }
     else
     {
-        size_t lengthOfResult = 0;
         char* encodedURL;
-        const char* currentInput;
-        unsigned char currentUnsignedChar;
-        currentInput = STRING_c_str(input);
+        const char* text = STRING_c_str(input);
         /*Codes_SRS_URL_ENCODE_06_003: [If input is a zero length string then URL_Encode will return a zero length string.]*/
-        do
-        {
-            currentUnsignedChar = (unsigned char)(*currentInput++);
-            lengthOfResult += URL_PrintableCharSize(currentUnsignedChar);
-        } while (currentUnsignedChar != 0);
-        if ((encodedURL = (char*)malloc(lengthOfResult)) == NULL)
+        if ((encodedURL = (char*)malloc(URL_EncodedLength(text) + 1)) == NULL)
         {
             /*Codes_SRS_URL_ENCODE_06_002: [If an error occurs during the encoding of input then URL_Encode will return NULL.]*/
             result = NULL;
@@ -147,13 +149,7 @@ STRING_HANDLE URL_Encode(STRING_HANDLE input)
         }
         else
         {
-            size_t currentEncodePosition = 0;
-            currentInput = STRING_c_str(input);
-            do
-            {
-                currentUnsignedChar = (unsigned char)(*currentInput++);
-                currentEncodePosition += URL_PrintableChar(currentUnsignedChar, &encodedURL[currentEncodePosition]);
-            } while (currentUnsignedChar != 0);
+            (void)URL_EncodeText(text, encodedURL);
 
             result = STRING_new_with_memory(encodedURL);
             if (result == NULL)
@@ -165,3 +161,24 @@ STRING_HANDLE URL_Encode(STRING_HANDLE input)
     }
     return result;
 }
+
+int URL_EncodeString_Into(const char* textEncode, char* destination, size_t destinationSize)
+{
+    int result;
+    if (textEncode == NULL || destination == NULL)
+    {
+        LogError("URL_EncodeString_Into:: NULL input");
+        result = __FAILURE__;
+    }
+    else if (URL_EncodedLength(textEncode) + 1 > destinationSize)
+    {
+        LogError("URL_EncodeString_Into:: destination too small");
+        result = __FAILURE__;
+    }
+    else
+    {
+        (void)URL_EncodeText(textEncode, destination);
+        result = 0;
+    }
+    return result;
+}
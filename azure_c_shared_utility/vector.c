@@ -9,6 +9,74 @@
 
 #include "azure_c_shared_utility/vector_types_internal.h"
 
+#if !defined(VECTOR_MIN_CAPACITY)
+#define VECTOR_MIN_CAPACITY 4
+#endif
+
+/*reallocates storage to hold exactly capacity elements (capacity > 0)*/
+static int VECTOR_resize_storage(VECTOR* handle, size_t capacity)
+{
+    int result;
+    void* temp;
+    if (capacity > ((size_t)-1) / handle->elementSize)
+    {
+        LogError("capacity(%zd) overflows.", capacity);
+        result = __FAILURE__;
+    }
+    else if ((temp = realloc(handle->storage, capacity * handle->elementSize)) == NULL)
+    {
+        LogError("realloc failed.");
+        result = __FAILURE__;
+    }
+    else
+    {
+        handle->storage = temp;
+        handle->capacity = capacity;
+        result = 0;
+    }
+    return result;
+}
+
+/*makes room for numElements more elements. The storage grows by half of its size at least, so a vector
+  filled one element at a time is only reallocated a logarithmic number of times*/
+static int VECTOR_grow(VECTOR* handle, size_t numElements)
+{
+    int result;
+    if (numElements > ((size_t)-1) - handle->count)
+    {
+        LogError("numElements(%zd) overflows.", numElements);
+        result = __FAILURE__;
+    }
+    else if (handle->count + numElements <= handle->capacity)
+    {
+        result = 0;
+    }
+    else
+    {
+        size_t needed = handle->count + numElements;
+        size_t newCapacity = handle->capacity + handle->capacity / 2;
+        if (newCapacity < needed)
+        {
+            newCapacity = needed;
+        }
+        if (newCapacity < VECTOR_MIN_CAPACITY)
+        {
+            newCapacity = VECTOR_MIN_CAPACITY;
+        }
+        if ((VECTOR_resize_storage(handle, newCapacity) != 0) &&
+            /*a minimal size increase is tried before giving up*/
+            ((newCapacity == needed) || (VECTOR_resize_storage(handle, needed) != 0)))
+        {
+            result = __FAILURE__;
+        }
+        else
+        {
+            result = 0;
+        }
+    }
+    return result;
+}
+
 VECTOR_HANDLE VECTOR_create(size_t elementSize)
 {
     VECTOR_HANDLE result;
@@ -32,6 +100,7 @@ VECTOR_HANDLE VECTOR_create(size_t elementSize)
             /* Codes_SRS_VECTOR_10_001: [VECTOR_create shall allocate a VECTOR_HANDLE that will contain an empty vector.The size of each element is given with the parameter elementSize.] */
             result->storage = NULL;
             result->count = 0;
+            result->capacity = 0;
             result->elementSize = elementSize;
         }
     }
@@ -74,11 +143,13 @@ VECTOR_HANDLE VECTOR_move(VECTOR_HANDLE handle)
         {
             /* Codes_SRS_VECTOR_10_004: [VECTOR_move shall allocate a VECTOR_HANDLE and move the data to it from the given handle.] */
             result->count = handle->count;
+            result->capacity = handle->capacity;
             result->elementSize = handle->elementSize;
             result->storage = handle->storage;
 
             handle->storage = NULL;
             handle->count = 0;
+            handle->capacity = 0;
         }
     }
     return result;
@@ -99,21 +170,46 @@ int VECTOR_push_back(VECTOR_HANDLE handle, const void* elements, size_t numEleme
     }
     else
     {
-        size_t curSize = handle->elementSize * handle->count;
-        size_t appendSize = handle->elementSize * numElements;
-
-        void* temp = realloc(handle->storage, curSize + appendSize);
-        if (temp == NULL)
+        if (VECTOR_grow(handle, numElements) != 0)
         {
            /* Codes_SRS_VECTOR_10_012: [VECTOR_push_back shall fail and return non-zero if memory allocation fails.] */
-            LogError("realloc failed.");
             result = __FAILURE__;
         }
         else
         {
             /* Codes_SRS_VECTOR_10_013: [VECTOR_push_back shall append the given elements and return 0 indicating success.] */
-            (void)memcpy((unsigned char*)temp + curSize, elements, appendSize);
-            handle->storage = temp;
+            (void)memcpy((unsigned char*)handle->storage + (handle->elementSize * handle->count), elements, handle->elementSize * numElements);
+            handle->count += numElements;
+            result = 0;
+        }
+    }
+    return result;
+}
+
+/*appends numElements copies of element, growing the storage once*/
+int VECTOR_push_back_n(VECTOR_HANDLE handle, const void* element, size_t numElements)
+{
+    int result;
+    if (handle == NULL || element == NULL || numElements == 0)
+    {
+        LogError("invalid argument - handle(%p), element(%p), numElements(%zd).", handle, element, numElements);
+        result = __FAILURE__;
+    }
+    else
+    {
+        if (VECTOR_grow(handle, numElements) != 0)
+        {
+            result = __FAILURE__;
+        }
+        else
+        {
+            unsigned char* dest = (unsigned char*)handle->storage + (handle->elementSize * handle->count);
+            size_t i;
+            for (i = 0; i < numElements; i++)
+            {
+                (void)memcpy(dest, element, handle->elementSize);
+                dest += handle->elementSize;
+            }
             handle->count += numElements;
             result = 0;
         }
@@ -160,32 +256,48 @@ void VECTOR_erase(VECTOR_HANDLE handle, void* elements, size_t numElements)
                 else
                 {
                     /* Codes_SRS_VECTOR_10_014: [VECTOR_erase shall remove the 'numElements' starting at 'elements' and reduce its internal storage.] */
+                    /*the storage is kept for the elements pushed next, VECTOR_shrink_to_fit releases it*/
                     handle->count -= numElements;
-                    if (handle->count == 0)
-                    {
-                        free(handle->storage);
-                        handle->storage = NULL;
-                    }
-                    else
-                    {
-                        void* tmp;
-                        (void)memmove(elements, src, srcEnd - src);
-                        tmp = realloc(handle->storage, (handle->elementSize * handle->count));
-                        if (tmp == NULL)
-                        {
-                            LogInfo("realloc failed. Keeping original internal storage pointer.");
-                        }
-                        else
-                        {
-                            handle->storage = tmp;
-                        }
-                    }
+                    (void)memmove(elements, src, srcEnd - src);
                 }
             }
         }
     }
 }
 
+/*removes one element by moving the last one in its place, the order of the elements is not kept*/
+void VECTOR_swap_remove(VECTOR_HANDLE handle, void* element)
+{
+    if (handle == NULL || element == NULL)
+    {
+        LogError("invalid argument - handle(%p), element(%p).", handle, element);
+    }
+    else if (handle->count == 0)
+    {
+        LogError("invalid argument element(%p) is not a member of this object.", element);
+    }
+    else
+    {
+        unsigned char* last = (unsigned char*)handle->storage + (handle->elementSize * (handle->count - 1));
+        if ((element < handle->storage) || ((unsigned char*)element > last))
+        {
+            LogError("invalid argument element(%p) is not a member of this object.", element);
+        }
+        else if (((((unsigned char*)element) - ((unsigned char*)handle->storage)) % handle->elementSize) != 0)
+        {
+            LogError("invalid argument - element(%p) is misaligned", element);
+        }
+        else
+        {
+            if ((unsigned char*)element != last)
+            {
+                (void)memcpy(element, last, handle->elementSize);
+            }
+            handle->count--;
+        }
+    }
+}
+
 void VECTOR_clear(VECTOR_HANDLE handle)
 {
     /* Codes_SRS_VECTOR_10_017: [VECTOR_clear shall if the object is NULL or empty.] */
@@ -199,6 +311,7 @@ void VECTOR_clear(VECTOR_HANDLE handle)
         free(handle->storage);
         handle->storage = NULL;
         handle->count = 0;
+        handle->capacity = 0;
     }
 }
 
@@ -336,3 +449,61 @@ size_t VECTOR_size(VECTOR_HANDLE handle)
     }
     return result;
 }
+
+size_t VECTOR_capacity(VECTOR_HANDLE handle)
+{
+    size_t result;
+    if (handle == NULL)
+    {
+        LogError("invalid argument handle(NULL).");
+        result = 0;
+    }
+    else
+    {
+        result = handle->capacity;
+    }
+    return result;
+}
+
+/*makes room for numElements elements in total, so that many can be pushed without reallocating*/
+int VECTOR_reserve(VECTOR_HANDLE handle, size_t numElements)
+{
+    int result;
+    if (handle == NULL)
+    {
+        LogError("invalid argument handle(NULL).");
+        result = __FAILURE__;
+    }
+    else if (numElements <= handle->capacity)
+    {
+        result = 0;
+    }
+    else
+    {
+        result = VECTOR_resize_storage(handle, numElements);
+    }
+    return result;
+}
+
+/*releases the storage not used by the elements*/
+void VECTOR_shrink_to_fit(VECTOR_HANDLE handle)
+{
+    if (handle == NULL)
+    {
+        LogError("invalid argument handle(NULL).");
+    }
+    else if (handle->count == handle->capacity)
+    {
+        /*nothing to release*/
+    }
+    else if (handle->count == 0)
+    {
+        free(handle->storage);
+        handle->storage = NULL;
+        handle->capacity = 0;
+    }
+    else if (VECTOR_resize_storage(handle, handle->count) != 0)
+    {
+        LogInfo("realloc failed. Keeping original internal storage pointer.");
+    }
+}
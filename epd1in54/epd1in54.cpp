@@ -25,6 +25,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include "epd1in54.h"
 
 const unsigned char lut_full_update[] =
@@ -188,6 +189,41 @@ void Epd::SetFrameMemory(
     }
 }
 
+/**
+ *  @brief: put the part of a full size frame buffer covering the display
+ *          area [x, x + area_width) x [y, y + area_height) to the frame
+ *          memory, for partial updates. the area is widened to whole
+ *          bytes of the frame buffer.
+ *          this won't update the display.
+ */
+void Epd::SetFrameMemoryArea(
+    const unsigned char* frame_buffer,
+    int x,
+    int y,
+    int area_width,
+    int area_height
+) {
+    int x0 = x;
+    int y0 = y;
+    int x1 = x + area_width;
+    int y1 = y + area_height;
+
+    if (frame_buffer == NULL || !GetAbsoluteArea(x0, y0, x1, y1)) {
+        return;
+    }
+    /* x point must be the multiple of 8 or the last 3 bits will be ignored */
+    x0 &= 0xF8;
+    x1 = (x1 + 7) & 0xF8;
+    SetMemoryArea(x0, y0, x1 - 1, y1 - 1);
+    SetMemoryPointer(x0, y0);
+    SendCommand(WRITE_RAM);
+    for (int j = y0; j < y1; j++) {
+        for (int i = x0 / 8; i < x1 / 8; i++) {
+            SendData(frame_buffer[i + j * (EPD_WIDTH / 8)]);
+        }
+    }
+}
+
 /**
  *  @brief: clear the frame memory with the specified color.
  *          this won't update the display.
@@ -323,7 +359,109 @@ void Epd::SetAbsolutePixel(unsigned char *frame_buffer, int x, int y, int colore
     }
 }
 
+/**
+ *  @brief: private function to color or clear the pixels of mask in one byte
+ */
+static inline void ApplyMask(unsigned char* dst, unsigned char mask, int colored) {
+    if (colored) {
+        *dst &= ~mask;
+    }
+    else{
+        *dst |= mask;
+    }
+}
+
+/**
+ *  @brief: private function filling the absolute area [x0, x1) x [y0, y1).
+ *          inner bytes of each line are set with memset, partial bytes at
+ *          either end with a mask, lines are reached by stepping the stride.
+ */
+void Epd::FillAbsoluteRect(unsigned char *frame_buffer, int x0, int y0, int x1, int y1, int colored) {
+    const int stride = EPD_WIDTH / 8;
+    x0 = x0 < 0 ? 0 : x0;
+    y0 = y0 < 0 ? 0 : y0;
+    x1 = x1 > EPD_WIDTH ? EPD_WIDTH : x1;
+    y1 = y1 > EPD_HEIGHT ? EPD_HEIGHT : y1;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    int first = x0 / 8;
+    int last = (x1 - 1) / 8;
+    unsigned char head = 0xFF >> (x0 % 8);
+    unsigned char tail = (unsigned char)(0xFF << (7 - (x1 - 1) % 8));
+    if (first == last) {
+        head &= tail;
+    }
+    unsigned char* line = &frame_buffer[y0 * stride];
+    for (int y = y0; y < y1; y++, line += stride) {
+        ApplyMask(&line[first], head, colored);
+        if (first != last) {
+            if (last - first > 1) {
+                memset(&line[first + 1], colored ? 0x00 : 0xFF, last - first - 1);
+            }
+            ApplyMask(&line[last], tail, colored);
+        }
+    }
+}
+
+/**
+ *  @brief: turns the area [x0, x1) x [y0, y1) given in display coordinates
+ *          into the absolute frame buffer area holding it, following the
+ *          rotation like SetPixel. the area is clipped to the display,
+ *          returns false when nothing of it is left.
+ */
+bool Epd::GetAbsoluteArea(int &x0, int &y0, int &x1, int &y1) {
+    int ax0, ay0, ax1, ay1;
+    x0 = x0 < 0 ? 0 : x0;
+    y0 = y0 < 0 ? 0 : y0;
+    x1 = x1 > (int)width ? (int)width : x1;
+    y1 = y1 > (int)height ? (int)height : y1;
+    if (x0 >= x1 || y0 >= y1) {
+        return false;
+    }
+    if (rotate == ROTATE_0){
+        ax0 = x0; ay0 = y0; ax1 = x1; ay1 = y1;
+    }
+    else if (rotate == ROTATE_90){
+        ax0 = EPD_WIDTH + 1 - y1; ay0 = x0; ax1 = EPD_WIDTH + 1 - y0; ay1 = x1;
+    }
+    else if (rotate == ROTATE_180){
+        ax0 = EPD_WIDTH + 1 - x1; ay0 = EPD_HEIGHT + 1 - y1;
+        ax1 = EPD_WIDTH + 1 - x0; ay1 = EPD_HEIGHT + 1 - y0;
+    }
+    else if (rotate == ROTATE_270){
+        ax0 = y0; ay0 = EPD_HEIGHT + 1 - x1; ax1 = y1; ay1 = EPD_HEIGHT + 1 - x0;
+    }
+    else{
+        return false;
+    }
+    x0 = ax0 < 0 ? 0 : ax0;
+    y0 = ay0 < 0 ? 0 : ay0;
+    x1 = ax1 > EPD_WIDTH ? EPD_WIDTH : ax1;
+    y1 = ay1 > EPD_HEIGHT ? EPD_HEIGHT : ay1;
+    return x0 < x1 && y0 < y1;
+}
+
+/**
+ *  @brief: private function filling the area [x0, x1) x [y0, y1) given in
+ *          display coordinates.
+ */
+void Epd::FillRect(unsigned char *frame_buffer, int x0, int y0, int x1, int y1, int colored) {
+    if (GetAbsoluteArea(x0, y0, x1, y1)) {
+        FillAbsoluteRect(frame_buffer, x0, y0, x1, y1, colored);
+    }
+}
+
 void Epd::DrawLine(unsigned char*frame_buffer, int x0, int y0, int x1, int y1, int colored){
+    // Straight lines are filled as spans
+    if (y0 == y1){
+        FillRect(frame_buffer, x0 < x1 ? x0 : x1, y0, (x0 < x1 ? x1 : x0) + 1, y0 + 1, colored);
+        return;
+    }
+    if (x0 == x1){
+        FillRect(frame_buffer, x0, y0 < y1 ? y0 : y1, x0 + 1, (y0 < y1 ? y1 : y0) + 1, colored);
+        return;
+    }
     // Bresenham algorithm
     int dx = x1 - x0 >= 0 ? x1 - x0 : x0 - x1;
     int sx = x0 < x1 ? 1 : -1;
@@ -344,15 +482,11 @@ void Epd::DrawLine(unsigned char*frame_buffer, int x0, int y0, int x1, int y1, i
 }
 
  void Epd::DrawHorizontalLine(unsigned char *frame_buffer, int x, int y, int width, int colored){
-    for (int i=x; i<x + width; i++){
-        SetPixel(frame_buffer, i, y, colored);
-    }
+    FillRect(frame_buffer, x, y, x + width, y + 1, colored);
 }
 
  void Epd::DrawVerticalLine(unsigned char *frame_buffer, int x, int y, int height, int colored){
-    for (int i=y; i<y + height; i++){
-        SetPixel(frame_buffer, x, i, colored);
-    }
+    FillRect(frame_buffer, x, y, x + 1, y + height, colored);
 }
 
  void Epd::DrawRectangle(unsigned char *frame_buffer, int x0, int y0, int x1, int y1, int colored){
@@ -373,9 +507,7 @@ void Epd::DrawFilledRectangle(unsigned char *frame_buffer, int x0, int y0, int x
     int min_y = y1 > y0 ? y0 : y1;
     int max_y = y1 > y0 ? y1 : y0;
 
-    for (int i=min_x; i < max_x+1; i++){
-        DrawVerticalLine(frame_buffer, i, min_y, max_y - min_y + 1, colored);
-    }
+    FillRect(frame_buffer, min_x, min_y, max_x + 1, max_y + 1, colored);
 }
 
 void Epd::DrawCircle(unsigned char *frame_buffer, int x, int y, int radius, int colored){
@@ -418,10 +550,7 @@ void Epd::DrawFilledCircle(unsigned char* frame_buffer, int x, int y, int radius
         return;
     }
     while ( 1 ){
-        SetPixel(frame_buffer, x - x_pos, y + y_pos, colored);
-        SetPixel(frame_buffer, x + x_pos, y + y_pos, colored);
-        SetPixel(frame_buffer, x + x_pos, y - y_pos, colored);
-        SetPixel(frame_buffer, x - x_pos, y - y_pos, colored);
+        // the spans cover the outline pixels as well
         DrawHorizontalLine(frame_buffer, x + x_pos, y + y_pos, 2 * (-x_pos) + 1, colored);
         DrawHorizontalLine(frame_buffer, x + x_pos, y - y_pos, 2 * (-x_pos) + 1, colored);
         int e2 = err;
@@ -444,45 +573,241 @@ void Epd::DrawFilledCircle(unsigned char* frame_buffer, int x, int y, int radius
 
 
 
+/**
+ *  @brief: private function that loads one glyph row into a 64 bit word,
+ *          leftmost pixel in the most significant bit.
+ *          padding bits beyond the glyph width are cleared.
+ */
+static uint64_t LoadGlyphRow(const unsigned char* row, int row_bytes, int glyph_width) {
+    uint64_t bits = 0;
+    for (int k = 0; k < row_bytes; k++) {
+        bits |= (uint64_t)row[k] << (56 - 8 * k);
+    }
+    return bits & (~0ULL << (64 - glyph_width));
+}
+
+/**
+ *  @brief: private function reversing the pixel order of a glyph row
+ */
+static uint64_t ReverseGlyphRow(uint64_t bits) {
+    bits = ((bits >> 1) & 0x5555555555555555ULL) | ((bits & 0x5555555555555555ULL) << 1);
+    bits = ((bits >> 2) & 0x3333333333333333ULL) | ((bits & 0x3333333333333333ULL) << 2);
+    bits = ((bits >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((bits & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    bits = ((bits >> 8) & 0x00FF00FF00FF00FFULL) | ((bits & 0x00FF00FF00FF00FFULL) << 8);
+    bits = ((bits >> 16) & 0x0000FFFF0000FFFFULL) | ((bits & 0x0000FFFF0000FFFFULL) << 16);
+    return (bits >> 32) | (bits << 32);
+}
+
+/**
+ *  @brief: private function writing a run of pixels into one frame buffer line.
+ *          bit 63 of bits is the pixel at absolute column col, pixels outside
+ *          [clip_min, clip_max) are dropped. Writes a byte at a time.
+ */
+static void BlitRow(unsigned char* line, uint64_t bits, int col, int clip_min, int clip_max, int colored) {
+    if (col < clip_min) {
+        if (clip_min - col >= 64) {
+            return;
+        }
+        bits <<= clip_min - col;
+        col = clip_min;
+    }
+    if (col >= clip_max) {
+        return;
+    }
+    if (clip_max - col < 64) {
+        bits &= ~0ULL << (64 - (clip_max - col));
+    }
+    if (bits == 0) {
+        return;
+    }
+    unsigned char* dst = &line[col / 8];
+    unsigned char mask = (unsigned char)(bits >> (56 + col % 8));
+    bits <<= 8 - col % 8;
+    while (1) {
+        ApplyMask(dst, mask, colored);
+        if (bits == 0) {
+            break;
+        }
+        dst++;
+        mask = (unsigned char)(bits >> 56);
+        bits <<= 8;
+    }
+}
+
+/**
+ *  @brief: private function writing a run of pixels down one frame buffer
+ *          column, used when the display is rotated by 90 or 270 degrees.
+ *          count pixels are taken from the top of bits, stepping by stride.
+ */
+static void BlitColumn(unsigned char* dst, unsigned char mask, int stride, uint64_t bits, int count, int colored) {
+    for (int i = 0; i < count && bits != 0; i++) {
+        if (bits & 0x8000000000000000ULL) {
+            ApplyMask(dst, mask, colored);
+        }
+        bits <<= 1;
+        dst += stride;
+    }
+}
+
+/* Expands the glyphs of a font packed by Utilities/Fonts/fontpack.py */
+typedef struct {
+    const unsigned char* src;
+    int count;          /* bytes left in the current run */
+    int repeat;         /* the current run repeats *src */
+    int row_bytes;
+    unsigned char row[EPD_MAX_PACKED_ROW_BYTES];
+} GlyphDecoder;
+
+/**
+ *  @brief: private function to start decoding a packed glyph
+ */
+static void InitGlyphDecoder(GlyphDecoder* decoder, const unsigned char* src, int row_bytes) {
+    decoder->src = src;
+    decoder->count = 0;
+    decoder->repeat = 0;
+    decoder->row_bytes = row_bytes;
+    memset(decoder->row, 0, sizeof(decoder->row));
+}
+
+/**
+ *  @brief: private function expanding the next row of a packed glyph into
+ *          decoder->row. rows are stored XORed with the row above and
+ *          run-length coded, see fontpack.py for the format.
+ */
+static void DecodeGlyphRow(GlyphDecoder* decoder) {
+    for (int k = 0; k < decoder->row_bytes; k++) {
+        if (decoder->count == 0) {
+            unsigned char header = *decoder->src++;
+            decoder->repeat = header & 0x80;
+            decoder->count = (header & 0x7F) + 1;
+        }
+        decoder->row[k] ^= decoder->repeat ? *decoder->src : *decoder->src++;
+        if (--decoder->count == 0 && decoder->repeat) {
+            decoder->src++;
+        }
+    }
+}
+
 /**
  *  @brief: this draws a charactor on the frame buffer but not refresh
  */
 void Epd::DrawCharAt(unsigned char *frame_buffer, int x, int y, char ascii_char, sFONT* font, int colored) {
     int i, j;
-    unsigned int char_offset = (ascii_char - ' ') * font->Height * (font->Width / 8 + (font->Width % 8 ? 1 : 0));
-    const unsigned char* ptr = &font->table[char_offset];
+    int row_bytes = font->Width / 8 + (font->Width % 8 ? 1 : 0);
+    const unsigned char* ptr;
+    const int stride = EPD_WIDTH / 8;
+    GlyphDecoder decoder;
+    int glyph = ascii_char - ' ';
+
+    if (font->charmap != NULL) {
+        /* subset font, only the characters listed in charmap have a glyph */
+        const char* slot = ascii_char != 0 ? strchr(font->charmap, ascii_char) : NULL;
+        if (slot == NULL) {
+            return;
+        }
+        glyph = slot - font->charmap;
+    }
+    if (font->index != NULL) {
+        /* packed font, rows are expanded one at a time into decoder.row */
+        if (row_bytes > EPD_MAX_PACKED_ROW_BYTES) {
+            return;
+        }
+        InitGlyphDecoder(&decoder, &font->table[font->index[glyph]], row_bytes);
+        ptr = decoder.row;
+    }
+    else{
+        ptr = &font->table[glyph * font->Height * row_bytes];
+    }
 
     for (j = 0; j < font->Height; j++) {
-        for (i = 0; i < font->Width; i++) {
-            if (*ptr & (0x80 >> (i % 8))) {
-                SetPixel(frame_buffer, x + i, y + j, colored);
+        const unsigned char* row_ptr = ptr;
+        if (font->index != NULL) {
+            DecodeGlyphRow(&decoder);
+        }
+        else{
+            ptr += row_bytes;
+        }
+        if (font->Width > EPD_MAX_BLIT_GLYPH_WIDTH) {
+            /* too wide for the row blitter, draw pixel by pixel */
+            for (i = 0; i < font->Width; i++) {
+                if (row_ptr[i / 8] & (0x80 >> (i % 8))) {
+                    SetPixel(frame_buffer, x + i, y + j, colored);
+                }
             }
-            if (i % 8 == 7) {
-                ptr++;
+            continue;
+        }
+        int row = y + j;
+        if (row < 0 || row >= (int)height) {
+            continue;
+        }
+        uint64_t bits = LoadGlyphRow(row_ptr, row_bytes, font->Width);
+        if (bits == 0) {
+            continue;
+        }
+        if (rotate == ROTATE_0) {
+            if (row >= EPD_HEIGHT) {
+                continue;
             }
+            int clip_max = (int)width < EPD_WIDTH ? (int)width : EPD_WIDTH;
+            BlitRow(&frame_buffer[row * stride], bits, x, 0, clip_max, colored);
         }
-        if (font->Width % 8 != 0) {
-            ptr++;
+        else if (rotate == ROTATE_180) {
+            int abs_row = EPD_HEIGHT - row;
+            if (abs_row >= EPD_HEIGHT) {
+                continue;
+            }
+            int clip_min = EPD_WIDTH - (int)width + 1;
+            BlitRow(&frame_buffer[abs_row * stride],
+                    ReverseGlyphRow(bits) << (64 - font->Width),
+                    EPD_WIDTH - x - font->Width + 1,
+                    clip_min > 0 ? clip_min : 0, EPD_WIDTH, colored);
+        }
+        else if (rotate == ROTATE_90 || rotate == ROTATE_270) {
+            /* glyph rows become frame buffer columns */
+            int abs_col = rotate == ROTATE_90 ? EPD_WIDTH - row : row;
+            if (abs_col < 0 || abs_col >= EPD_WIDTH) {
+                continue;
+            }
+            /* visible logical columns, restricted to the panel */
+            int first = rotate == ROTATE_90 ? 0 : 1;
+            int last = rotate == ROTATE_90 ? EPD_HEIGHT : EPD_HEIGHT + 1;
+            if (last > (int)width) {
+                last = width;
+            }
+            int i0 = first - x > 0 ? first - x : 0;
+            int i1 = last - x < font->Width ? last - x : font->Width;
+            if (i0 >= i1) {
+                continue;
+            }
+            int abs_row = rotate == ROTATE_90 ? x + i0 : EPD_HEIGHT - x - i0;
+            BlitColumn(&frame_buffer[abs_row * stride + abs_col / 8],
+                       0x80 >> (abs_col % 8),
+                       rotate == ROTATE_90 ? stride : -stride,
+                       bits << i0, i1 - i0, colored);
         }
     }
 }
 
 /**
-*  @brief: this displays a string on the frame buffer but not refresh
+*  @brief: this displays a string on the frame buffer but not refresh.
+*          characters falling completely outside the display are skipped.
 */
 void Epd::DrawStringAt(unsigned char *frame_buffer, int x, int y, const char* text, sFONT* font, int colored) {
     const char* p_text = text;
-    unsigned int counter = 0;
     int refcolumn = x;
-    
+
+    if (y >= (int)height || y + font->Height <= 0) {
+        return;
+    }
     /* Send the string character by character on EPD */
-    while (*p_text != 0) {
+    while (*p_text != 0 && refcolumn < (int)width) {
         /* Display one character on EPD */
-        DrawCharAt(frame_buffer, refcolumn, y, *p_text, font, colored);
-        /* Decrement the column position by 16 */
+        if (refcolumn + font->Width > 0) {
+            DrawCharAt(frame_buffer, refcolumn, y, *p_text, font, colored);
+        }
+        /* Increment the column position by the font width */
         refcolumn += font->Width;
         /* Point on the next character */
         p_text++;
-        counter++;
     }
-}
\ No newline at end of file
+}
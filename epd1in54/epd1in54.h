@@ -69,6 +69,11 @@
 #define ROTATE_180                                   2
 #define ROTATE_270                                   3
 
+// Widest glyph DrawCharAt can copy a row at a time, wider fonts fall back to SetPixel
+#define EPD_MAX_BLIT_GLYPH_WIDTH                     57
+// Widest glyph row of a packed font (fontpack.py), in bytes
+#define EPD_MAX_PACKED_ROW_BYTES                     8
+
 extern const unsigned char lut_full_update[];
 extern const unsigned char lut_partial_update[];
 
@@ -98,6 +103,7 @@ public:
     void SetMemoryArea(int x_start, int y_start, int x_end, int y_end);
     void SetMemoryPointer(int x, int y);
     void SetFrameMemory(const unsigned char* image_buffer, int x, int y, int image_width, int image_height);
+    void SetFrameMemoryArea(const unsigned char* frame_buffer, int x, int y, int area_width, int area_height);
     void ClearFrameMemory(unsigned char color);
     void DisplayFrame(void);
     
@@ -114,6 +120,11 @@ public:
     void DrawFilledCircle(unsigned char *frame_buffer, int x, int y, int radius, int colored);
     void DrawCharAt(unsigned char *frame_buffer, int x, int y, char ascii_char, sFONT* font, int colored);
     void DrawStringAt(unsigned char *frame_buffer, int x, int y, const char* text, sFONT* font, int colored);
+    bool GetAbsoluteArea(int &x0, int &y0, int &x1, int &y1);
+
+private:
+    void FillRect(unsigned char *frame_buffer, int x0, int y0, int x1, int y1, int colored);
+    void FillAbsoluteRect(unsigned char *frame_buffer, int x0, int y0, int x1, int y1, int colored);
 
 
 };